@@ -150,6 +150,7 @@ PD_LIB_DLL_EXPORT const int run_peridigm(int argc, char *argv[], const bool fina
 
   PeridigmNS::Timer::self().stopTimer("Total");
   PeridigmNS::Timer::self().printTimingData(cout);
+  PeridigmNS::Timer::self().writeTrace();
 
 #ifdef HAVE_MPI
   if(finalize)
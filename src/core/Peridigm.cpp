@@ -59,6 +59,7 @@
 #include <unordered_set>
 #include <iterator>
 #include <cmath>
+#include <cerrno>
 
 #include "Peridigm_Field.hpp"
 #include "Peridigm_HorizonManager.hpp"
@@ -70,11 +71,11 @@
 #include "Peridigm_BoundaryAndInitialConditionManager.hpp"
 #include "Peridigm_DegreesOfFreedomManager.hpp"
 #include "Peridigm_CriticalTimeStep.hpp"
+#include "Peridigm_QuasiStaticMatrixFreeOperator.hpp"
 #include "Peridigm_Timer.hpp"
 #include "Peridigm_MaterialFactory.hpp"
 #include "Peridigm_DamageModelFactory.hpp"
 #include "Peridigm_InterfaceAwareDamageModel.hpp"
-#include "Peridigm_UserDefinedTimeDependentCriticalStretchDamageModel.hpp"
 #include "Peridigm_ShortRangeForceContactModel.hpp"
 #include "Peridigm_UserDefinedTimeDependentShortRangeForceContactModel.hpp"
 #include "Peridigm.hpp"
@@ -95,9 +96,6 @@
 #include <Teuchos_VerboseObject.hpp>
 
 // required for restart
-#include "EpetraExt_MultiVectorIn.h"
-#include "EpetraExt_VectorIn.h"
-#include "EpetraExt_VectorOut.h"
 #include <sys/stat.h>
 
 using namespace std;
@@ -158,6 +156,15 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
   Memstat * memstat = Memstat::Instance();
   memstat->setComm(peridigmComm);
 
+  // Optional timing diagnostics beyond the flat wallclock table
+  if(peridigmParams->isSublist("Timing")){
+    Teuchos::ParameterList& timingParams = peridigmParams->sublist("Timing");
+    PeridigmNS::Timer::self().setHierarchicalReport(timingParams.get<bool>("Hierarchical Report", false));
+    if(timingParams.isParameter("Trace File"))
+      PeridigmNS::Timer::self().enableTrace(timingParams.get<string>("Trace File"),
+                                            timingParams.get<int>("Maximum Trace Events", 1000000));
+  }
+
   // Tracker for recording the total number of iterations taken by the nonlinear solver
   nonlinearSolverIterations = Teuchos::rcp(new int);
   *nonlinearSolverIterations = 0;
@@ -242,6 +249,12 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     if(solverParameters[i]->isSublist("ImplicitDiffusion")){
       implicitTimeIntegration = true;
     }
+    // The matrix-free quasi-static solver needs only the 3x3 blocks, which are used to build its preconditioner
+    if(solverParameters[i]->isSublist("QuasiStatic")){
+      Teuchos::ParameterList& quasiStaticParams = solverParameters[i]->sublist("QuasiStatic");
+      if(quasiStaticParams.isParameter("Jacobian Operator") && quasiStaticParams.get<string>("Jacobian Operator") == "Matrix-Free")
+        userSpecifiedBlockDiagonalTangent = true;
+    }
     if(solverParameters[i]->isParameter("Peridigm Preconditioner")){
       std::string peridigmPreconditionerType = solverParameters[i]->get<string>("Peridigm Preconditioner");
       if(peridigmPreconditionerType == "Full Tangent")
@@ -448,10 +461,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
 
 
     // Set the damage model (if any)
-    double currentValue = 0.0;
-    double previousValue = 0.0;
-    double timeCurrent = 0.0;
-    double timePrevious = 0.0;
+    // The damage model persists for the whole analysis; time-dependent models are advanced through Block::damageModelPreStep()
     string damageModelName = blockIt->getDamageModelName();
     if(damageModelName != "None"){
       Teuchos::ParameterList damageParams = damageModelParams.sublist(damageModelName, true);
@@ -461,10 +471,7 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
         Teuchos::RCP< PeridigmNS::InterfaceAwareDamageModel > IADamageModel = Teuchos::rcp_dynamic_cast< PeridigmNS::InterfaceAwareDamageModel >(damageModel);
         IADamageModel->setBCManager(boundaryAndInitialConditionManager);
       }
-      else if(damageModel->Name() =="Time Dependent Critical Stretch"){
-        CSDamageModel = Teuchos::rcp_dynamic_cast< PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel >(damageModel);
-        CSDamageModel->evaluateParserDmg(currentValue, previousValue, timeCurrent, timePrevious);
-      }
+      damageModel->updateTime(0.0, 0.0);
     }
   }
 
@@ -801,6 +808,8 @@ PeridigmNS::Peridigm::Peridigm(const MPI_Comm& comm,
     if(jacobianType == PeridigmNS::Material::UNDEFINED)
       jacobianType = PeridigmNS::Material::BLOCK_DIAGONAL;
   }
+  updateMemoryStats();
+
   //Initialize restart if requested in the input file
   if(peridigmParams->isParameter("Restart")){
 	 InitializeRestart();
@@ -812,7 +821,9 @@ void PeridigmNS::Peridigm::checkContactSearchRadius(const Teuchos::ParameterList
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Search Radius\" not specified.");
 
   const double maxRatio = 10.0;  // TODO: this might need to be adjusted
-  const double contactRad = contactParams.get<double>("Search Radius");
+  double contactRad = contactParams.get<double>("Search Radius");
+  if(contactParams.isParameter("Verlet Skin"))
+    contactRad += contactParams.get<double>("Verlet Skin");
   const double maxRad = peridigmDisc->getMaxElementRadius();
 
   if(contactRad/maxRad >= maxRatio){
@@ -864,7 +875,7 @@ void PeridigmNS::Peridigm::initializeDiscretization(Teuchos::RCP<Discretization>
   if(analysisHasMultiphysics)
     numOneDimensionalMothershipVectors += 7;
   if(analysisHasBondAssociatedHypoelasticModel)
-    numOneDimensionalMothershipVectors += 3;
+    numOneDimensionalMothershipVectors += 2;
 
   oneDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*oneDimensionalMap, numOneDimensionalMothershipVectors, initializeToZero));
   blockIDs = Teuchos::rcp((*oneDimensionalMothership)(0), false);                    // block ID
@@ -887,7 +898,6 @@ void PeridigmNS::Peridigm::initializeDiscretization(Teuchos::RCP<Discretization>
     if(analysisHasBondAssociatedHypoelasticModel){
       damage = Teuchos::rcp((*oneDimensionalMothership)(16), false);              // damage
       jacobianDeterminant = Teuchos::rcp((*oneDimensionalMothership)(17), false); // jacobian determinant (J)
-      weightedVolume = Teuchos::rcp((*oneDimensionalMothership)(18), false);      // weighted volume
       damage->PutScalar(0.0);
       jacobianDeterminant->PutScalar(1.0);
     }
@@ -895,14 +905,11 @@ void PeridigmNS::Peridigm::initializeDiscretization(Teuchos::RCP<Discretization>
   if(analysisHasBondAssociatedHypoelasticModel){
     damage = Teuchos::rcp((*oneDimensionalMothership)(9), false);              // damage
     jacobianDeterminant = Teuchos::rcp((*oneDimensionalMothership)(10), false); // jacobian determinant (J)
-    weightedVolume = Teuchos::rcp((*oneDimensionalMothership)(11), false);      // weighted volume
     damage->PutScalar(0.0);
     jacobianDeterminant->PutScalar(1.0);
   }
 
   int numThreeDimensionalMothershipVectors = 10;
-  if(analysisHasBondAssociatedHypoelasticModel)
-    numThreeDimensionalMothershipVectors += 3;
 
   threeDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*threeDimensionalMap, numThreeDimensionalMothershipVectors, initializeToZero));
   x = Teuchos::rcp((*threeDimensionalMothership)(0), false);             // initial positions
@@ -915,11 +922,6 @@ void PeridigmNS::Peridigm::initializeDiscretization(Teuchos::RCP<Discretization>
   externalForce = Teuchos::rcp((*threeDimensionalMothership)(7), false); // external force
   deltaU = Teuchos::rcp((*threeDimensionalMothership)(8), false);        // increment in displacement (used only for implicit time integration)
   scratch = Teuchos::rcp((*threeDimensionalMothership)(9), false);       // scratch space
-  if(analysisHasBondAssociatedHypoelasticModel){
-    velocityGradientX = Teuchos::rcp((*threeDimensionalMothership)(10), false);  // velocity gradient XX XY XZ (L)
-    velocityGradientY = Teuchos::rcp((*threeDimensionalMothership)(11), false); // velocity gradient YX YY YZ (L)
-    velocityGradientZ = Teuchos::rcp((*threeDimensionalMothership)(12), false); // velocity gradient ZX ZY ZZ (L)
-  }
 
   unknownsMothership = Teuchos::rcp(new Epetra_MultiVector(*unknownsMap, 5, initializeToZero));
   unknownsU = Teuchos::rcp((*unknownsMothership)(0), false);             // abstract displacement
@@ -976,6 +978,10 @@ void PeridigmNS::Peridigm::initializeWorkset() {
     workset->contactManager = contactManager;
   workset->jacobianType = Teuchos::rcpFromRef(jacobianType);
   workset->jacobian = overlapJacobian;
+  // A calibration run times the internal force evaluation of each block to measure the cost factors for weighted load balancing
+  const Teuchos::ParameterList& discParams = peridigmParams->sublist("Discretization");
+  if(discParams.isSublist("Load Balance"))
+    workset->timeBlockForces = discParams.sublist("Load Balance").get<bool>("Calibrate Cost Factors", false);
 }
 
 std::string getCmdOutput(const std::string& mStr)
@@ -1047,64 +1053,7 @@ restartFiles["path"] = restart_directory_namePtr;
 //Current time restart file
 sprintf(pathname,"%s/currentTime.txt",restart_directory_namePtr);
 restartFiles["currentTime"] = pathname;
-//blockIDs restart file
-sprintf(pathname,"%s/blockIDs.mat",restart_directory_namePtr);
-restartFiles["blockIDs"] = pathname;
-//horizon restart file
-sprintf(pathname,"%s/horizon.mat",restart_directory_namePtr);
-restartFiles["horizon"] = pathname;
-
-//volume restart file
-sprintf(pathname,"%s/volume.mat",restart_directory_namePtr);
-restartFiles["volume"] = pathname;
-
-//density restart file
-sprintf(pathname,"%s/density.mat",restart_directory_namePtr);
-restartFiles["density"] = pathname;
-
-//deltaTemperature restart file
-sprintf(pathname,"%s/deltaTemperature.mat",restart_directory_namePtr);
-restartFiles["deltaTemperature"] = pathname;
-
-//x restart file
-sprintf(pathname,"%s/x.mat",restart_directory_namePtr);
-restartFiles["x"] = pathname;
-
-//u restart file
-sprintf(pathname,"%s/u.mat",restart_directory_namePtr);
-restartFiles["u"] = pathname;
-
-//y restart file
-sprintf(pathname,"%s/y.mat",restart_directory_namePtr);
-restartFiles["y"] = pathname;
-
-//v restart file
-sprintf(pathname,"%s/v.mat",restart_directory_namePtr);
-restartFiles["v"] = pathname;
-
-//a restart file
-sprintf(pathname,"%s/a.mat",restart_directory_namePtr);
-restartFiles["a"] = pathname;
-
-//force restart file
-sprintf(pathname,"%s/force.mat",restart_directory_namePtr);
-restartFiles["force"] = pathname;
-
-//contactForce restart file
-sprintf(pathname,"%s/contactForce.mat",restart_directory_namePtr);
-restartFiles["contactForce"] = pathname;
-
-//externalForce restart file
-sprintf(pathname,"%s/externalForce.mat",restart_directory_namePtr);
-restartFiles["externalForce"] = pathname;
-
-//deltaU restart file
-sprintf(pathname,"%s/deltaU.mat",restart_directory_namePtr);
-restartFiles["deltaU"] = pathname;
-
-//scratch restart file
-sprintf(pathname,"%s/scratch.mat",restart_directory_namePtr);
-restartFiles["scratch"] = pathname;
+//Binary restart data is stored in one file per rank next to restart.index, see Peridigm_RestartFile.hpp
 }
 void PeridigmNS::Peridigm::instantiateComputeManager(Teuchos::RCP<Discretization> peridigmDiscretization) {
 
@@ -1306,9 +1255,112 @@ void PeridigmNS::Peridigm::execute(Teuchos::RCP<Teuchos::ParameterList> solverPa
     TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error: Unrecognized time integration scheme.\n");
   }
 
+  if(workset->timeBlockForces)
+    printBlockCostFactors();
+
   PeridigmNS::Memstat * memstat = PeridigmNS::Memstat::Instance();
   const std::string statTag = "Post Execute";
   memstat->addStat(statTag);
+  updateMemoryStats();
+}
+
+//! Memory used by the values, column indices, and row offsets of a CrsMatrix, in megabytes.
+static double crsMatrixMemorySize(const Epetra_CrsMatrix& matrix)
+{
+  double sizeInBytes = static_cast<double>(matrix.NumMyNonzeros())*(sizeof(double) + sizeof(int)) +
+    static_cast<double>(matrix.NumMyRows() + 1)*sizeof(int);
+  return sizeInBytes/1048576.0;
+}
+
+void PeridigmNS::Peridigm::updateMemoryStats() {
+
+  double pointData(0.0), bondData(0.0), neighborhoodData(0.0), singlePrecisionSaving(0.0);
+  int localSinglePrecision(0), globalSinglePrecision(0);
+  if(!blocks.is_null()){
+    for(std::vector<PeridigmNS::Block>::iterator it = blocks->begin() ; it != blocks->end() ; it++){
+      Teuchos::RCP<PeridigmNS::DataManager> dataManager = it->getDataManager();
+      if(!dataManager.is_null()){
+        pointData += dataManager->pointDataMemorySize();
+        bondData += dataManager->bondDataMemorySize();
+        singlePrecisionSaving += dataManager->singlePrecisionMemorySaving();
+        if(dataManager->hasSinglePrecisionData())
+          localSinglePrecision = 1;
+      }
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> blockNeighborhoodData = it->getNeighborhoodData();
+      if(!blockNeighborhoodData.is_null())
+        neighborhoodData += blockNeighborhoodData->memorySize();
+    }
+  }
+  if(!globalNeighborhoodData.is_null())
+    neighborhoodData += globalNeighborhoodData->memorySize();
+
+  double jacobian(0.0);
+  if(!tangent.is_null())
+    jacobian += crsMatrixMemorySize(*tangent);
+  if(!blockDiagonalTangent.is_null() && blockDiagonalTangent.get() != tangent.get())
+    jacobian += crsMatrixMemorySize(*blockDiagonalTangent);
+  if(!overlapJacobian.is_null())
+    jacobian += overlapJacobian->bufferMemorySize();
+
+  double contact(0.0);
+  if(!contactManager.is_null())
+    contact = contactManager->memorySize();
+
+  double output(0.0);
+  if(!outputManager.is_null())
+    output = outputManager->memorySize();
+
+  // Every category is recorded on every processor so that the statistics can be reduced
+  PeridigmNS::Memstat * memstat = PeridigmNS::Memstat::Instance();
+  memstat->setComponentStat("Point Data", pointData);
+  memstat->setComponentStat("Bond Data", bondData);
+  memstat->setComponentStat("Neighborhood Data", neighborhoodData);
+  memstat->setComponentStat("Jacobian", jacobian);
+  memstat->setComponentStat("Contact", contact);
+  memstat->setComponentStat("Output Staging", output);
+
+  // The saving from single-precision step N bond data is reported only if some block uses it
+  peridigmComm->MaxAll(&localSinglePrecision, &globalSinglePrecision, 1);
+  if(globalSinglePrecision)
+    memstat->setComponentStat("Bond Data Single Precision Saving", singlePrecisionSaving);
+}
+
+void PeridigmNS::Peridigm::printBlockCostFactors() {
+
+  // The cost of a block is the time spent in its internal force evaluation, summed over all
+  // processors, per unit of work, where the work of a point is one plus its number of bonds
+  // (the same measure used for the load balance weights)
+  vector<double> blockCosts;
+  double minCost(0.0);
+  for(unsigned int iBlock=0 ; iBlock<blocks->size() ; ++iBlock){
+    PeridigmNS::Block& block = (*blocks)[iBlock];
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = block.getNeighborhoodData();
+    double localData[2], globalData[2];
+    localData[0] = PeridigmNS::Timer::self().elapsedTime("Internal Force: " + block.getName());
+    localData[1] = neighborhoodData->NeighborhoodListSize();
+    peridigmComm->SumAll(localData, globalData, 2);
+    double cost = globalData[1] > 0.0 ? globalData[0]/globalData[1] : 0.0;
+    blockCosts.push_back(cost);
+    if(cost > 0.0 && (minCost == 0.0 || cost < minCost))
+      minCost = cost;
+  }
+
+  if(peridigmComm->MyPID() == 0){
+    cout << "Measured block cost factors (add to the \"Block Cost Factors\" list in the \"Load Balance\" sublist of \"Discretization\"):" << endl;
+    for(unsigned int iBlock=0 ; iBlock<blocks->size() ; ++iBlock)
+      cout << "  " << (*blocks)[iBlock].getName() << ": " << (minCost > 0.0 ? blockCosts[iBlock]/minCost : 1.0) << endl;
+    cout << endl;
+  }
+}
+
+//! Throws on every rank if the error message is not empty on any rank (collective); ranks without an error of their own throw with otherRankMessage.
+static void throwOnAnyRank(const Epetra_Comm& comm, const string& errorMessage, const string& otherRankMessage)
+{
+  int localOk = errorMessage.empty() ? 1 : 0;
+  int globalOk(0);
+  comm.MinAll(&localOk, &globalOk, 1);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!errorMessage.empty(), errorMessage);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(globalOk != 1, otherRankMessage);
 }
 
 void PeridigmNS::Peridigm::executeSolvers() {
@@ -1318,6 +1370,28 @@ void PeridigmNS::Peridigm::executeSolvers() {
     	writeRestart(solverParameters[i]);
     }
   }
+  // The run is not complete until the output and the last restart are on disk
+  string outputError;
+  try{
+    outputManager->flush();
+  }
+  catch(const std::exception& e){
+    outputError = e.what();
+  }
+  throwOnAnyRank(*peridigmComm, outputError, "**** Error:  Writing output failed on another rank.\n");
+  completeRestart();
+}
+
+//! Number of steps of size dt needed to cover the given interval, the last step possibly being shorter.
+static int numberOfRemainingTimeSteps(double interval, double dt)
+{
+  // The tolerance avoids a vanishingly small final step due to round-off
+  double steps = std::ceil(interval/dt - 1.0e-8);
+  if(steps < 1.0)
+    return 1;
+  if(steps > static_cast<double>(INT_MAX))
+    return INT_MAX;
+  return static_cast<int>(steps);
 }
 
 void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList> solverParams) {
@@ -1326,8 +1400,10 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
 
   // Compute the approximate critical time step
   double criticalTimeStep = 1.0e50;
+  std::vector<double> blockCriticalTimeSteps;
   for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
     double blockCriticalTimeStep = ComputeCriticalTimeStep(*peridigmComm, *blockIt);
+    blockCriticalTimeSteps.push_back(blockCriticalTimeStep);
     if(blockCriticalTimeStep < criticalTimeStep)
       criticalTimeStep = blockCriticalTimeStep;
   }
@@ -1350,9 +1426,60 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   double timeFinal   = solverParams->get("Final Time", 1.0);
   double timeCurrent = timeInitial;
   double timePrevious = timeCurrent;
+
+  // Adaptive time stepping parameters
+  // The stable time step is periodically re-estimated from the current configuration and bond damage.
+  // The output schedule is not adjusted, "Output Frequency" remains a number of steps.
+  bool adaptiveTimeStep = false;
+  int timeStepUpdateInterval = 100;
+  double minimumTimeStep = 0.0;
+  double maximumTimeStep = 1.0e50;
+  double maximumTimeStepGrowth = 1.1;
+  if(verletParams->isSublist("Adaptive Time Step")){
+    adaptiveTimeStep = true;
+    Teuchos::RCP<Teuchos::ParameterList> adaptiveParams = sublist(verletParams, "Adaptive Time Step", true);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(verletParams->isParameter("Fixed dt"), "**** 'Fixed dt' cannot be combined with adaptive time stepping, use 'Minimum Time Step' and 'Maximum Time Step' to bound the time step. ****");
+    timeStepUpdateInterval = adaptiveParams->get<int>("Update Interval", 100);
+    minimumTimeStep = adaptiveParams->get<double>("Minimum Time Step", 0.0);
+    maximumTimeStep = adaptiveParams->get<double>("Maximum Time Step", 1.0e50);
+    maximumTimeStepGrowth = adaptiveParams->get<double>("Maximum Growth Factor", 1.1);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(timeStepUpdateInterval < 1, "**** 'Update Interval' for adaptive time stepping must be at least one. ****");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(minimumTimeStep > maximumTimeStep, "**** 'Minimum Time Step' cannot be larger than 'Maximum Time Step'. ****");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(maximumTimeStepGrowth < 1.0, "**** 'Maximum Growth Factor' for adaptive time stepping cannot be smaller than one. ****");
+    dt = std::min(std::max(dt, minimumTimeStep), maximumTimeStep);
+  }
+
+  // Subcycling parameters
+  // Each block is advanced with a period of 2^k base steps that keeps it within its own stable time step.
+  // The internal force of a block is evaluated once per period and applied as a velocity impulse of half
+  // the period at the start and at the end of the period (impulse multiple time stepping), so that
+  // interface forces acting on the points of other blocks are exchanged consistently.  Contact and body
+  // forces are applied at every base step.
+  bool subcycling = false;
+  std::vector<int> blockSubcyclePeriods(blocks->size(), 1);
+  if(verletParams->isSublist("Subcycling")){
+    subcycling = true;
+    Teuchos::RCP<Teuchos::ParameterList> subcycleParams = sublist(verletParams, "Subcycling", true);
+    int maximumSubcycles = subcycleParams->get<int>("Maximum Subcycles", 8);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(maximumSubcycles < 1, "**** 'Maximum Subcycles' must be at least one. ****");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(adaptiveTimeStep, "**** Subcycling cannot be combined with adaptive time stepping. ****");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasBondAssociatedHypoelasticModel, "**** Subcycling is not supported for bond-associated hypoelastic models. ****");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "**** Subcycling is not supported for multiphysics analyses. ****");
+    for(unsigned int iBlock=0 ; iBlock<blocks->size() ; ++iBlock){
+      int period = 1;
+      while(2*period <= maximumSubcycles && 2*period*dt <= safetyFactor*blockCriticalTimeSteps[iBlock])
+        period *= 2;
+      blockSubcyclePeriods[iBlock] = period;
+    }
+  }
+
   workset->timeStep = dt;
   double dt2 = dt/2.0;
   int nsteps = static_cast<int>( floor((timeFinal-timeInitial)/dt) );
+  // With adaptive time stepping the last step is shortened to end exactly at the final time,
+  // and nsteps is re-estimated whenever the time step changes
+  if(adaptiveTimeStep)
+    nsteps = numberOfRemainingTimeSteps(timeFinal-timeInitial, dt);
 
   // Check to make sure the number of time steps is sane
   if(floor((timeFinal-timeInitial)/dt) > static_cast<double>(INT_MAX)){
@@ -1376,8 +1503,22 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
       cout << "  Safety factor       " << safetyFactor << endl;
     else
       cout << "  Safety factor       not provided " << endl;
-    cout << "  Time step           " << dt << "\n" << endl;
-    cout << "Total number of time steps " << nsteps << "\n" << endl;
+    if(adaptiveTimeStep)
+      cout << "  Adaptive            updated every " << timeStepUpdateInterval << " steps, bounds [" << minimumTimeStep << ", " << maximumTimeStep << "]" << endl;
+    if(adaptiveTimeStep)
+      cout << "  Initial time step   " << dt << "\n" << endl;
+    else
+      cout << "  Time step           " << dt << "\n" << endl;
+    if(subcycling){
+      cout << "Subcycling (base steps per force evaluation):" << endl;
+      for(unsigned int iBlock=0 ; iBlock<blocks->size() ; ++iBlock)
+        cout << "  " << (*blocks)[iBlock].getName() << "  " << blockSubcyclePeriods[iBlock] << endl;
+      cout << endl;
+    }
+    if(adaptiveTimeStep)
+      cout << "Estimated number of time steps " << nsteps << "\n" << endl;
+    else
+      cout << "Total number of time steps " << nsteps << "\n" << endl;
   }
 
   // Pointer index into sub-vectors for use with BLAS
@@ -1389,6 +1530,65 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   a->ExtractView( &aPtr );
   int length = a->MyLength();
 
+  // Group the blocks by subcycling period; the base period always exists because contact and
+  // body forces are applied at every step
+  struct SubcycleLevel {
+    int period;
+    std::vector<int> blockIndices;
+    Teuchos::RCP<Workset> workset;
+    //! Force density from the blocks of this level at their last evaluation
+    Teuchos::RCP<Epetra_Vector> force;
+    //! Acceleration applied as an impulse at the start and end of each period
+    Teuchos::RCP<Epetra_Vector> acceleration;
+  };
+  std::vector<SubcycleLevel> subcycleLevels;
+  if(subcycling){
+    std::set<int> periods(blockSubcyclePeriods.begin(), blockSubcyclePeriods.end());
+    periods.insert(1);
+    for(std::set<int>::iterator it=periods.begin() ; it!=periods.end() ; ++it){
+      SubcycleLevel level;
+      level.period = *it;
+      for(unsigned int iBlock=0 ; iBlock<blocks->size() ; ++iBlock)
+        if(blockSubcyclePeriods[iBlock] == level.period)
+          level.blockIndices.push_back(iBlock);
+      // The blocks of a level share their data with the blocks in the mothership vector, so the level
+      // workset is built once and reused for every evaluation
+      level.workset = Teuchos::rcp(new Workset(*workset));
+      level.workset->blocks = Teuchos::rcp(new std::vector<PeridigmNS::Block>);
+      for(unsigned int i=0 ; i<level.blockIndices.size() ; ++i)
+        level.workset->blocks->push_back((*blocks)[level.blockIndices[i]]);
+      level.workset->timeStep = level.period*dt;
+      if(level.period != 1)
+        level.workset->contactManager = Teuchos::null;
+      level.force = Teuchos::rcp(new Epetra_Vector(*force));
+      level.acceleration = Teuchos::rcp(new Epetra_Vector(*a));
+      subcycleLevels.push_back(level);
+    }
+  }
+
+  // Sums the force density of the blocks of a subcycling level into level.force
+  auto gatherLevelForce = [&](SubcycleLevel& level){
+    level.force->PutScalar(0.0);
+    for(unsigned int i=0 ; i<level.blockIndices.size() ; ++i){
+      scratch->PutScalar(0.0);
+      (*blocks)[level.blockIndices[i]].exportData(scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
+      level.force->Update(1.0, *scratch, 1.0);
+    }
+  };
+
+  // Converts level.force to an acceleration; the base level also carries the contact and body forces
+  auto computeLevelAcceleration = [&](SubcycleLevel& level){
+    Epetra_Vector& acceleration = *level.acceleration;
+    acceleration = *level.force;
+    if(level.period == 1){
+      acceleration.Update(1.0, *externalForce, 1.0);
+      if(analysisHasContact)
+        acceleration.Update(1.0, *contactForce, 1.0);
+    }
+    for(int i=0 ; i<acceleration.MyLength() ; ++i)
+      acceleration[i] /= (*density)[i/3];
+  };
+
   // Set the prescribed displacements (allow for nonzero initial displacements).
   // Then back compute the displacement vector.  Leave the velocity as zero.
   // \todo How do we really want to handle nonzero initial displacements?
@@ -1414,6 +1614,14 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     contactManager->importData(volume, y, v);
   PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
 
+  // Fields of the bond-associated hypoelastic model that are synchronized after the velocity gradient is computed
+  PeridigmNS::DataManagerSynchronizer& dataManagerSynchronizer = PeridigmNS::DataManagerSynchronizer::self();
+  std::vector<int> velocityGradientFieldIds;
+  velocityGradientFieldIds.push_back(weightedVolumeFieldId);
+  velocityGradientFieldIds.push_back(velocityGradientXFieldId);
+  velocityGradientFieldIds.push_back(velocityGradientYFieldId);
+  velocityGradientFieldIds.push_back(velocityGradientZFieldId);
+
   if(analysisHasBondAssociatedHypoelasticModel){
     PeridigmNS::Timer::self().startTimer("Internal Force");
     modelEvaluator->computeVelocityGradient(workset);
@@ -1427,42 +1635,8 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
       blockIt->exportData(scalarScratch, jacobianDeterminantFieldId, PeridigmField::STEP_NP1, Add);
       jacobianDeterminant->Update(1.0, *scalarScratch, 1.0);
     }
-    weightedVolume->PutScalar(0.0);
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      scalarScratch->PutScalar(0.0);
-      blockIt->exportData(scalarScratch, weightedVolumeFieldId, PeridigmField::STEP_NONE, Add);
-      weightedVolume->Update(1.0, *scalarScratch, 1.0);
-    }
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      blockIt->importData(weightedVolume, weightedVolumeFieldId, PeridigmField::STEP_NONE, Insert); 
-    }
-    velocityGradientX->PutScalar(0.0);
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      scratch->PutScalar(0.0);
-      blockIt->exportData(scratch, velocityGradientXFieldId, PeridigmField::STEP_NONE, Add);
-      velocityGradientX->Update(1.0, *scratch, 1.0);
-    }
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      blockIt->importData(velocityGradientX, velocityGradientXFieldId, PeridigmField::STEP_NONE, Insert); 
-    }
-    velocityGradientY->PutScalar(0.0);
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      scratch->PutScalar(0.0);
-      blockIt->exportData(scratch, velocityGradientYFieldId, PeridigmField::STEP_NONE, Add);
-      velocityGradientY->Update(1.0, *scratch, 1.0);
-    }
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      blockIt->importData(velocityGradientY, velocityGradientYFieldId, PeridigmField::STEP_NONE, Insert); 
-    }
-    velocityGradientZ->PutScalar(0.0);
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      scratch->PutScalar(0.0);
-      blockIt->exportData(scratch, velocityGradientZFieldId, PeridigmField::STEP_NONE, Add);
-      velocityGradientZ->Update(1.0, *scratch, 1.0);
-    }
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      blockIt->importData(velocityGradientZ, velocityGradientZFieldId, PeridigmField::STEP_NONE, Insert); 
-    }
+    // The weighted volume and the velocity gradient are summed across blocks and copied back in one exchange
+    dataManagerSynchronizer.synchronize(blocks, velocityGradientFieldIds);
     PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
 
     // Compute bond-level velocity gradient
@@ -1521,6 +1695,12 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     (*a)[i] += (*externalForce)[i];
     (*a)[i] /= (*density)[i/3];
   }
+  if(subcycling){
+    for(unsigned int iLevel=0 ; iLevel<subcycleLevels.size() ; ++iLevel){
+      gatherLevelForce(subcycleLevels[iLevel]);
+      computeLevelAcceleration(subcycleLevels[iLevel]);
+    }
+  }
   // Write initial configuration to disk
   PeridigmNS::Timer::self().startTimer("Output");
   synchDataManagers();
@@ -1534,60 +1714,112 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
   if(displayTrigger == 0)
     displayTrigger = 1;
 
-  Teuchos::ParameterList damageModelParams;
-  if(peridigmParams->isSublist("Damage Models"))
-    damageModelParams = peridigmParams->sublist("Damage Models");
-  DamageModelFactory damageModelFactory;
-
   double currentValue = 0.0;
   double previousValue = 0.0;
 
+  // Timers used inside the time-step loop are looked up once; "Time Step" encloses the phases of each step
+  PeridigmNS::Timer& timer = PeridigmNS::Timer::self();
+  const int timeStepTimerId = timer.timerId("Time Step");
+  const int gatherScatterTimerId = timer.timerId("Gather/Scatter");
+  const int internalForceTimerId = timer.timerId("Internal Force");
+  const int kinematicBCTimerId = timer.timerId("Apply Kinematic B.C.");
+  const int bodyForceTimerId = timer.timerId("Apply Body Forces");
+  const int rebalanceTimerId = timer.timerId("Rebalance");
+  const int outputTimerId = timer.timerId("Output");
+  const int dataLoaderTimerId = timer.timerId("Data Loader");
+  const int criticalTimeStepTimerId = timer.timerId("Critical Time Step");
+
+  // Damage gathered for the contact manager at each search check, when the search is restricted to candidate points
+  Teuchos::RCP<Epetra_Vector> contactPointDamage;
+  if(analysisHasContact && contactManager->restrictsSearchToCandidates())
+    contactPointDamage = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
+
   for(int step=1; step<=nsteps; step++){
+    timer.startTimer(timeStepTimerId);
 
     timePrevious = timeCurrent;
-    timeCurrent = timeInitial + (step*dt);
 
-    // TODO this should not be here
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      string damageModelName = blockIt->getDamageModelName();
-      if(damageModelName != "None"){
-         Teuchos::ParameterList damageParams = damageModelParams.sublist(damageModelName, true);
-         Teuchos::RCP<PeridigmNS::DamageModel> damageModel = damageModelFactory.create(damageParams);
-         blockIt->setDamageModel(damageModel);
-         if(damageModel->Name() == "Time Dependent Critical Stretch"){
-           CSDamageModel = Teuchos::rcp_dynamic_cast< PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel >(damageModel);
-           CSDamageModel->evaluateParserDmg(currentValue, previousValue, timeCurrent, timePrevious);
-         }
+    if(adaptiveTimeStep){
+      // Re-estimate the stable time step from the configuration at the end of the previous step
+      if(step > 1 && (step-1)%timeStepUpdateInterval == 0){
+        timer.startTimer(criticalTimeStepTimerId);
+        double currentCriticalTimeStep = 1.0e50;
+        for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+          currentCriticalTimeStep = std::min(currentCriticalTimeStep, ComputeCriticalTimeStep(*peridigmComm, *blockIt, true));
+        timer.stopTimer(criticalTimeStepTimerId);
+        dt = AdaptiveTimeStep(currentCriticalTimeStep, safetyFactor, dt, maximumTimeStepGrowth, minimumTimeStep, maximumTimeStep);
+        nsteps = step - 1 + numberOfRemainingTimeSteps(timeFinal-timePrevious, dt);
       }
+      // Land exactly on the final time
+      if(step == nsteps)
+        dt = timeFinal - timePrevious;
+      workset->timeStep = dt;
+      dt2 = dt/2.0;
+      timeCurrent = timePrevious + dt;
+    }
+    else{
+      timeCurrent = timeInitial + (step*dt);
+    }
+
+    // A subcycled block is advanced over its full period, so its damage model sees the same time step
+    // in damageModelPreStep() as in damageModelPostStep()
+    for(unsigned int iBlock=0 ; iBlock<blocks->size() ; ++iBlock){
+      int period = blockSubcyclePeriods[iBlock];
+      if((step-1)%period == 0)
+        (*blocks)[iBlock].damageModelPreStep(period == 1 ? timeCurrent : timeInitial + (step-1+period)*dt, timePrevious);
     }
 
-    if((step-1)%displayTrigger==0)
-      displayProgress("Explicit time integration", (step-1)*100.0/nsteps);
+    if((step-1)%displayTrigger==0){
+      if(adaptiveTimeStep)
+        displayProgress("Explicit time integration", (timePrevious-timeInitial)*100.0/(timeFinal-timeInitial));
+      else
+        displayProgress("Explicit time integration", (step-1)*100.0/nsteps);
+    }
 
     // rebalance, if requested
-    PeridigmNS::Timer::self().startTimer("Rebalance");
+    timer.startTimer(rebalanceTimerId);
     // \todo Should we load updated information first?  If so, only do this if we're really going to rebalance.
-    if(analysisHasContact)
+    if(analysisHasContact){
+      // Points that have lost bonds become contact candidates; the damage is gathered only when a search may follow
+      if(contactManager->restrictsSearchToCandidates() && step%contactManager->getSearchFrequency() == 0){
+        contactPointDamage->PutScalar(0.0);
+        for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+          scalarScratch->PutScalar(0.0);
+          blockIt->exportData(scalarScratch, damageFieldId, PeridigmField::STEP_N, Add);
+          contactPointDamage->Update(1.0, *scalarScratch, 1.0);
+        }
+        contactManager->updateContactCandidates(contactPointDamage);
+      }
       contactManager->rebalance(step);
-    PeridigmNS::Timer::self().stopTimer("Rebalance");
+    }
+    timer.stopTimer(rebalanceTimerId);
 
     // Do one step of velocity-Verlet
 
     // V^{n+1/2} = V^{n} + (dt/2)*A^{n}
     // blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
-    blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
+    if(subcycling){
+      // Opening impulse of every level whose period starts with this step
+      for(unsigned int iLevel=0 ; iLevel<subcycleLevels.size() ; ++iLevel){
+        SubcycleLevel& level = subcycleLevels[iLevel];
+        if((step-1)%level.period == 0)
+          blas.AXPY(length, level.period*dt2, level.acceleration->Values(), vPtr, 1, 1);
+      }
+    }
+    else
+      blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
 
     // Set the velocities for dof with kinematic boundary conditions.
     // This will propagate through the Verlet integrator and result in the proper
     // displacement boundary conditions on y and consistent values for v and u.
-    PeridigmNS::Timer::self().startTimer("Apply Kinematic B.C.");
+    timer.startTimer(kinematicBCTimerId);
     boundaryAndInitialConditionManager->applyBoundaryConditions(timeCurrent, timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Kinematic B.C.");
+    timer.stopTimer(kinematicBCTimerId);
 
     // evaluate the external (body) forces:
-    PeridigmNS::Timer::self().startTimer("Apply Body Forces");
+    timer.startTimer(bodyForceTimerId);
     boundaryAndInitialConditionManager->applyForceContributions(timeCurrent, timePrevious);
-    PeridigmNS::Timer::self().stopTimer("Apply Body Forces");
+    timer.stopTimer(bodyForceTimerId);
 
     // Y^{n+1} = X_{o} + U^{n} + (dt)*V^{n+1/2}
     // \todo Replace with blas call
@@ -1601,7 +1833,7 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
     // \todo The velocity copied into the DataManager is actually the midstep velocity, not the NP1 velocity; this can be fixed by creating a midstep velocity field in the DataManager and setting the NP1 value as invalid.
 
     // Copy data from mothership vectors to overlap vectors in data manager
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+    timer.startTimer(gatherScatterTimerId);
     for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
       blockIt->importData(u, displacementFieldId, PeridigmField::STEP_NP1, Insert);
       blockIt->importData(y, coordinatesFieldId, PeridigmField::STEP_NP1, Insert);
@@ -1624,83 +1856,69 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
       }
       contactManager->importData(volume, y, v);
     }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+    timer.stopTimer(gatherScatterTimerId);
 
     if(analysisHasBondAssociatedHypoelasticModel){
-      PeridigmNS::Timer::self().startTimer("Internal Force");
+      timer.startTimer(internalForceTimerId);
       modelEvaluator->computeVelocityGradient(workset);
-      PeridigmNS::Timer::self().stopTimer("Internal Force");
+      timer.stopTimer(internalForceTimerId);
       
       // Copy data from mothership vectors to overlap vectors in data manager
-      PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+      timer.startTimer(gatherScatterTimerId);
       jacobianDeterminant->PutScalar(0.0);
       for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
         scalarScratch->PutScalar(0.0);
         blockIt->exportData(scalarScratch, jacobianDeterminantFieldId, PeridigmField::STEP_NP1, Add);
         jacobianDeterminant->Update(1.0, *scalarScratch, 1.0);
       }
-      weightedVolume->PutScalar(0.0);
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        scalarScratch->PutScalar(0.0);
-        blockIt->exportData(scalarScratch, weightedVolumeFieldId, PeridigmField::STEP_NONE, Add);
-        weightedVolume->Update(1.0, *scalarScratch, 1.0);
-      }
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        blockIt->importData(weightedVolume, weightedVolumeFieldId, PeridigmField::STEP_NONE, Insert); 
-      }
-      velocityGradientX->PutScalar(0.0);
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        scratch->PutScalar(0.0);
-        blockIt->exportData(scratch, velocityGradientXFieldId, PeridigmField::STEP_NONE, Add);
-        velocityGradientX->Update(1.0, *scratch, 1.0);
-      }
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        blockIt->importData(velocityGradientX, velocityGradientXFieldId, PeridigmField::STEP_NONE, Insert); 
-      }
-      velocityGradientY->PutScalar(0.0);
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        scratch->PutScalar(0.0);
-        blockIt->exportData(scratch, velocityGradientYFieldId, PeridigmField::STEP_NONE, Add);
-        velocityGradientY->Update(1.0, *scratch, 1.0);
-      }
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        blockIt->importData(velocityGradientY, velocityGradientYFieldId, PeridigmField::STEP_NONE, Insert); 
-      }
-      velocityGradientZ->PutScalar(0.0);
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        scratch->PutScalar(0.0);
-        blockIt->exportData(scratch, velocityGradientZFieldId, PeridigmField::STEP_NONE, Add);
-        velocityGradientZ->Update(1.0, *scratch, 1.0);
-      }
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        blockIt->importData(velocityGradientZ, velocityGradientZFieldId, PeridigmField::STEP_NONE, Insert); 
-      }
-      PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+      // The weighted volume and the velocity gradient are summed across blocks and copied back in one exchange
+      dataManagerSynchronizer.synchronize(blocks, velocityGradientFieldIds);
+      timer.stopTimer(gatherScatterTimerId);
 
       // Compute bond-level velocity gradient
-      PeridigmNS::Timer::self().startTimer("Internal Force");
+      timer.startTimer(internalForceTimerId);
       modelEvaluator->computeBondVelocityGradient(workset);
-      PeridigmNS::Timer::self().stopTimer("Internal Force");
+      timer.stopTimer(internalForceTimerId);
     }
     // Load the data manager with data from disk, if requested
     if(analysisHasDataLoader){
-      PeridigmNS::Timer::self().startTimer("Data Loader");
+      timer.startTimer(dataLoaderTimerId);
       dataLoader->loadData(timeCurrent, blocks);
-      PeridigmNS::Timer::self().stopTimer("Data Loader");
+      timer.stopTimer(dataLoaderTimerId);
     }
 
     // Update forces based on new positions
-    PeridigmNS::Timer::self().startTimer("Internal Force");
-    modelEvaluator->evalModel(workset);
-    PeridigmNS::Timer::self().stopTimer("Internal Force");
+    timer.startTimer(internalForceTimerId);
+    if(subcycling){
+      // Evaluate the blocks whose period ends with this step, over their full period
+      for(unsigned int iLevel=0 ; iLevel<subcycleLevels.size() ; ++iLevel){
+        SubcycleLevel& level = subcycleLevels[iLevel];
+        if(step%level.period == 0)
+          modelEvaluator->evalModel(level.workset);
+      }
+    }
+    else
+      modelEvaluator->evalModel(workset);
+    timer.stopTimer(internalForceTimerId);
 
     // Copy force from the data manager to the mothership vector
-    PeridigmNS::Timer::self().startTimer("Gather/Scatter");
+    timer.startTimer(gatherScatterTimerId);
     force->PutScalar(0.0);
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-      scratch->PutScalar(0.0);
-      blockIt->exportData(scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
-      force->Update(1.0, *scratch, 1.0);
+    if(subcycling){
+      // Blocks that were not evaluated contribute their force from the last evaluation
+      for(unsigned int iLevel=0 ; iLevel<subcycleLevels.size() ; ++iLevel){
+        SubcycleLevel& level = subcycleLevels[iLevel];
+        if(step%level.period == 0)
+          gatherLevelForce(level);
+        force->Update(1.0, *level.force, 1.0);
+      }
+    }
+    else{
+      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+        scratch->PutScalar(0.0);
+        blockIt->exportData(scratch, forceDensityFieldId, PeridigmField::STEP_NP1, Add);
+        force->Update(1.0, *scratch, 1.0);
+      }
     }
     if(analysisHasBondAssociatedHypoelasticModel){
       damage->PutScalar(0.0);
@@ -1710,7 +1928,7 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
         damage->Update(1.0, *scalarScratch, 1.0);
       }
     }
-    PeridigmNS::Timer::self().stopTimer("Gather/Scatter");
+    timer.stopTimer(gatherScatterTimerId);
 
     // Check for NaNs in force evaluation
     // We'd like to know now because a NaN will likely cause a difficult-to-unravel crash downstream.
@@ -1740,22 +1958,48 @@ void PeridigmNS::Peridigm::executeExplicit(Teuchos::RCP<Teuchos::ParameterList>
 
     // V^{n+1}   = V^{n+1/2} + (dt/2)*A^{n+1}
     //blas.AXPY(const int N, const double ALPHA, const double *X, double *Y, const int INCX=1, const int INCY=1) const
-    blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
-
-    PeridigmNS::Timer::self().startTimer("Output");
-    synchDataManagers();
-    if(analysisHasDataLoader){
-      dataLoader->loadData(timeCurrent, blocks);
+    if(subcycling){
+      // Closing impulse of every level whose period ends with this step
+      for(unsigned int iLevel=0 ; iLevel<subcycleLevels.size() ; ++iLevel){
+        SubcycleLevel& level = subcycleLevels[iLevel];
+        if(step%level.period == 0){
+          computeLevelAcceleration(level);
+          blas.AXPY(length, level.period*dt2, level.acceleration->Values(), vPtr, 1, 1);
+        }
+      }
+    }
+    else
+      blas.AXPY(length, dt2, aPtr, vPtr, 1, 1);
+
+    timer.startTimer(outputTimerId);
+    // The block data is only needed by the output managers and compute classes, so the gather is
+    // skipped on steps that do not write.  It is also performed on the step preceding an output
+    // step, so that two-step fields read at STEP_N by the compute classes are fully assembled,
+    // and on the final step, so that the blocks are current when the solver returns.
+    if(analysisHasMultiphysics || step == nsteps || outputManager->willWrite(0) || outputManager->willWrite(1)){
+      synchDataManagers();
+      if(analysisHasDataLoader){
+        dataLoader->loadData(timeCurrent, blocks);
+      }
     }
     outputManager->write(blocks, timeCurrent);
-    PeridigmNS::Timer::self().stopTimer("Output");
+    timer.stopTimer(outputTimerId);
 
     // swap state N and state NP1
-    for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
-      blockIt->updateState();
+    // A subcycled block keeps its state between evaluations, so that its next evaluation advances
+    // the state over the full period
+    for(unsigned int iBlock=0 ; iBlock<blocks->size() ; ++iBlock){
+      if(step%blockSubcyclePeriods[iBlock] == 0){
+        (*blocks)[iBlock].damageModelPostStep(blockSubcyclePeriods[iBlock]*dt);
+        (*blocks)[iBlock].updateState();
+      }
+    }
+    timer.stopTimer(timeStepTimerId);
   }
   displayProgress("Explicit time integration", 100.0);
   *out << "\n\n";
+  if(adaptiveTimeStep && peridigmComm->MyPID() == 0)
+    cout << "Adaptive time stepping completed " << nsteps << " steps, final time step " << dt << "\n" << endl;
 }
 
 bool PeridigmNS::Peridigm::computeF(const Epetra_Vector& x, Epetra_Vector& FVec, NOX::Epetra::Interface::Required::FillType fillType) {
@@ -1778,29 +2022,47 @@ bool PeridigmNS::Peridigm::computePreconditioner(const Epetra_Vector& x, Epetra_
   evaluateNOX(NOX::Epetra::Interface::Required::Jac, &x, NULL);
 
   // Invert the 3x3 block tangent
+  invertBlockDiagonalTangent();
+
+  return true;
+}
+
+void PeridigmNS::Peridigm::invertBlockDiagonalTangent(bool diagonalOnly) {
+
   PeridigmNS::Timer::self().startTimer("Invert 3x3 Block Tangent");
-  TEUCHOS_TEST_FOR_EXCEPT_MSG(tangent->NumMyRows()%3 != 0, "****Error in Peridigm::computePreconditioner(), invalid number of rows.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(tangent->NumMyRows()%3 != 0, "****Error in Peridigm::invertBlockDiagonalTangent(), invalid number of rows.\n");
   int numEntries, err;
   double *valuesRow1, *valuesRow2, *valuesRow3;
   double matrix[9], determinant, inverse[9];
   for(int iBlock=0 ; iBlock<tangent->NumMyRows() ; iBlock+=3){
     err = tangent->ExtractMyRowView(iBlock, numEntries, valuesRow1);
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::computePreconditioner(), tangent->ExtractMyRowView() returned nonzero error code.\n");
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(numEntries != 3, "**** PeridigmNS::Peridigm::computePreconditioner(), number of row entries not equal to three (block 3x3 matrix required).\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::invertBlockDiagonalTangent(), tangent->ExtractMyRowView() returned nonzero error code.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(numEntries != 3, "**** PeridigmNS::Peridigm::invertBlockDiagonalTangent(), number of row entries not equal to three (block 3x3 matrix required).\n");
     for(int i=0 ; i<3 ; ++i)
       matrix[i] = valuesRow1[i];
     err = tangent->ExtractMyRowView(iBlock+1, numEntries, valuesRow2);
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::computePreconditioner(), tangent->ExtractMyRowView() returned nonzero error code.\n");
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(numEntries != 3, "**** PeridigmNS::Peridigm::computePreconditioner(), number of row entries not equal to three (block 3x3 matrix required).\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::invertBlockDiagonalTangent(), tangent->ExtractMyRowView() returned nonzero error code.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(numEntries != 3, "**** PeridigmNS::Peridigm::invertBlockDiagonalTangent(), number of row entries not equal to three (block 3x3 matrix required).\n");
     for(int i=0 ; i<3 ; ++i)
       matrix[3+i] = valuesRow2[i];
     err = tangent->ExtractMyRowView(iBlock+2, numEntries, valuesRow3);
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::computePreconditioner(), tangent->ExtractMyRowView() returned nonzero error code.\n");
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(numEntries != 3, "**** PeridigmNS::Peridigm::computePreconditioner(), number of row entries not equal to three (block 3x3 matrix required).\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::invertBlockDiagonalTangent(), tangent->ExtractMyRowView() returned nonzero error code.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(numEntries != 3, "**** PeridigmNS::Peridigm::invertBlockDiagonalTangent(), number of row entries not equal to three (block 3x3 matrix required).\n");
     for(int i=0 ; i<3 ; ++i)
       matrix[6+i] = valuesRow3[i];
-    err = CORRESPONDENCE::Invert3by3Matrix(matrix, determinant, inverse);
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::computePreconditioner(), Invert3by3Matrix() returned nonzero error code.\n");
+    if(diagonalOnly){
+      // Point Jacobi:  discard the off-diagonal coupling between the three components
+      for(int i=0 ; i<9 ; ++i)
+        inverse[i] = 0.0;
+      for(int i=0 ; i<3 ; ++i){
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(matrix[4*i] == 0.0, "**** PeridigmNS::Peridigm::invertBlockDiagonalTangent(), zero on the diagonal of the tangent.\n");
+        inverse[4*i] = 1.0/matrix[4*i];
+      }
+    }
+    else{
+      err = CORRESPONDENCE::Invert3by3Matrix(matrix, determinant, inverse);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::invertBlockDiagonalTangent(), Invert3by3Matrix() returned nonzero error code.\n");
+    }
     for(int i=0 ; i<3 ; ++i){
       valuesRow1[i] = inverse[i];
       valuesRow2[i] = inverse[3+i];
@@ -1808,8 +2070,6 @@ bool PeridigmNS::Peridigm::computePreconditioner(const Epetra_Vector& x, Epetra_
     }
   }
   PeridigmNS::Timer::self().stopTimer("Invert 3x3 Block Tangent");
-
-  return true;
 }
 
 bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillType flag, 
@@ -1989,7 +2249,7 @@ bool PeridigmNS::Peridigm::evaluateNOX(NOX::Epetra::Interface::Required::FillTyp
     tangent->PutScalar(0.0);
     PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
     modelEvaluator->evalJacobian(workset);
-    int err = tangent->GlobalAssemble();
+    int err = overlapJacobian->globalAssemble();
     TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::evaluateNOX(), GlobalAssemble() returned nonzero error code.\n");
     PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
     boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent);
@@ -2667,6 +2927,27 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
     tolerance = quasiStaticParams->get<double>("Absolute Tolerance");
   }
 
+  // Jacobian-free Newton-Krylov option:  the tangent is applied by finite differencing the residual, and only the
+  // 3x3 blocks of the tangent are assembled, for use as a preconditioner
+  string jacobianOperator = quasiStaticParams->get("Jacobian Operator", "Matrix");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(jacobianOperator != "Matrix" && jacobianOperator != "Matrix-Free",
+                              "\n****Error: Invalid QuasiStatic \"Jacobian Operator\", valid options are \"Matrix\" and \"Matrix-Free\".\n");
+  bool matrixFree = (jacobianOperator == "Matrix-Free");
+  string matrixFreePreconditioner = "None";
+  Teuchos::RCP<PeridigmNS::QuasiStaticMatrixFreeOperator> matrixFreeOperator;
+  if(matrixFree){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(analysisHasMultiphysics, "\n****Error: The matrix-free QuasiStatic solver does not support multiphysics.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(residual->MyLength() != deltaU->MyLength(), "\n****Error: The matrix-free QuasiStatic solver requires displacement to be the only unknown.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(tangent.get() != blockDiagonalTangent.get(), "\n****Error: The matrix-free QuasiStatic solver requires the block 3x3 tangent.\n");
+    matrixFreePreconditioner = quasiStaticParams->get("Matrix-Free Preconditioner", "Block 3x3");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(matrixFreePreconditioner != "Block 3x3" && matrixFreePreconditioner != "Diagonal" && matrixFreePreconditioner != "None",
+                                "\n****Error: Invalid QuasiStatic \"Matrix-Free Preconditioner\", valid options are \"Block 3x3\", \"Diagonal\", and \"None\".\n");
+    double matrixFreePerturbation = quasiStaticParams->get("Matrix-Free Perturbation", 1.0e-6);
+    matrixFreeOperator = Teuchos::rcp(new PeridigmNS::QuasiStaticMatrixFreeOperator(this, residual, matrixFreePerturbation));
+    if(peridigmComm->MyPID() == 0)
+      cout << "\nQuasiStatic solver using a matrix-free tangent, preconditioner = " << matrixFreePreconditioner << "\n" << endl;
+  }
+
   // Pointer index into sub-vectors for use with BLAS
   // Pointers into mothership vectors
   double *xPtr, *uPtr, *yPtr, *vPtr, *aPtr, *deltaUPtr;
@@ -2937,11 +3218,18 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
         if(disableHeuristics) usePreconditioner = false;
 
         // Compute the tangent
-        if( !dampedNewton || (solverIteration-numPureNewtonSteps-1)%dampedNewtonNumStepsBetweenTangentUpdates==0 ){
+        if( matrixFree ){
+          // Only the preconditioner is assembled; it is refreshed on the same schedule as the tangent
+          if( matrixFreePreconditioner != "None" && (!dampedNewton || (solverIteration-numPureNewtonSteps-1)%dampedNewtonNumStepsBetweenTangentUpdates==0) ){
+            quasiStaticsComputeBlockDiagonalPreconditioner(matrixFreePreconditioner == "Diagonal");
+            linearProblem.setLeftPrec(tangent);
+          }
+        }
+        else if( !dampedNewton || (solverIteration-numPureNewtonSteps-1)%dampedNewtonNumStepsBetweenTangentUpdates==0 ){
           tangent->PutScalar(0.0);
           PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
           modelEvaluator->evalJacobian(workset);
-          int err = tangent->GlobalAssemble();
+          int err = overlapJacobian->globalAssemble();
 
           TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::executeQuasiStatic(), GlobalAssemble() returned nonzero error code.\n");
           PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
@@ -2956,9 +3244,17 @@ void PeridigmNS::Peridigm::executeQuasiStatic(Teuchos::RCP<Teuchos::ParameterLis
         }
 
         // Solve linear system
-        isConverged = quasiStaticsSolveSystem(residual, lhs, linearProblem, belosSolver);
+        isConverged = quasiStaticsSolveSystem(residual, lhs, linearProblem, belosSolver, matrixFreeOperator);
 
-        if(isConverged == Belos::Unconverged && !disableHeuristics){
+        if(isConverged == Belos::Unconverged && !disableHeuristics && matrixFree && matrixFreePreconditioner != "None"){
+          // The matrix-free tangent cannot be damped, so only the preconditioner is dropped
+          if(peridigmComm->MyPID() == 0)
+            cout << "  --deactivating preconditioner--" << endl;
+          linearProblem.setLeftPrec( Teuchos::RCP<const Epetra_Operator>() );
+          matrixFreePreconditioner = "None";
+          isConverged = quasiStaticsSolveSystem(residual, lhs, linearProblem, belosSolver, matrixFreeOperator);
+        }
+        else if(isConverged == Belos::Unconverged && !disableHeuristics && !matrixFree){
           // Adjust the tangent and try again
           if(peridigmComm->MyPID() == 0)
             cout << "  --switching nonlinear solver to damped Newton and deactivating preconditioner--" << endl;
@@ -3343,7 +3639,7 @@ void PeridigmNS::Peridigm::executeImplicitDiffusion(Teuchos::RCP<Teuchos::Parame
       tangent->PutScalar(0.0);
       PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
       modelEvaluator->evalJacobian(workset);
-      int err = tangent->GlobalAssemble();
+      int err = overlapJacobian->globalAssemble();
       TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::executeImplicitDiffusion(), GlobalAssemble() returned nonzero error code.\n");
       PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
       boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(residual);
@@ -3471,14 +3767,18 @@ void PeridigmNS::Peridigm::quasiStaticsDampTangent(double dampedNewtonDiagonalSc
 Belos::ReturnType PeridigmNS::Peridigm::quasiStaticsSolveSystem(Teuchos::RCP<Epetra_Vector> residual,
 								Teuchos::RCP<Epetra_Vector> lhs,
 								Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem,
-								Teuchos::RCP< Belos::SolverManager<double,Epetra_MultiVector,Epetra_Operator> >& belosSolver)
+								Teuchos::RCP< Belos::SolverManager<double,Epetra_MultiVector,Epetra_Operator> >& belosSolver,
+								Teuchos::RCP<const Epetra_Operator> linearOperator)
 {
   PeridigmNS::Timer::self().startTimer("Solve Linear System");
 
   Belos::ReturnType isConverged(Belos::Unconverged);
 
   lhs->PutScalar(0.0);
-  linearProblem.setOperator(tangent);
+  if(linearOperator.is_null())
+    linearProblem.setOperator(tangent);
+  else
+    linearProblem.setOperator(linearOperator);
   bool isSet = linearProblem.setProblem(lhs, residual);
   TEUCHOS_TEST_FOR_EXCEPT_MSG(!isSet, "**** Belos::LinearProblem::setProblem() returned nonzero error code.\n");
   try{
@@ -3511,6 +3811,79 @@ Belos::ReturnType PeridigmNS::Peridigm::quasiStaticsSolveSystem(Teuchos::RCP<Epe
   return isConverged;
 }
 
+void PeridigmNS::Peridigm::quasiStaticsApplyMatrixFreeTangent(const Epetra_Vector& direction,
+                                                              const Epetra_Vector& baseResidual,
+                                                              double lambda,
+                                                              Epetra_Vector& result)
+{
+  if(matrixFreeDirection.is_null() || !matrixFreeDirection->Map().SameAs(direction.Map())){
+    matrixFreeDirection = Teuchos::rcp(new Epetra_Vector(direction.Map()));
+    matrixFreeResidual = Teuchos::rcp(new Epetra_Vector(direction.Map()));
+  }
+  if(matrixFreeDeltaU.is_null())
+    matrixFreeDeltaU = Teuchos::rcp(new Epetra_Vector(deltaU->Map()));
+
+  // The increment is fixed at the kinematic B.C., so the perturbation is zero there;
+  // the corresponding rows of the operator are the negated identity, as in the assembled tangent
+  *matrixFreeDirection = direction;
+  boundaryAndInitialConditionManager->applyKinematicBC_InsertZeros(matrixFreeDirection);
+  double directionNorm;
+  matrixFreeDirection->Norm2(&directionNorm);
+  if(directionNorm == 0.0){
+    result.Scale(-1.0, direction);
+    return;
+  }
+
+  PeridigmNS::Timer::self().startTimer("Matrix-Free Tangent");
+
+  double deltaUNorm;
+  deltaU->Norm2(&deltaUNorm);
+  double epsilon = lambda*(lambda + deltaUNorm/directionNorm);
+
+  double *xPtr, *uPtr, *yPtr, *vPtr, *deltaUPtr, *directionPtr;
+  x->ExtractView( &xPtr );
+  u->ExtractView( &uPtr );
+  y->ExtractView( &yPtr );
+  v->ExtractView( &vPtr );
+  deltaU->ExtractView( &deltaUPtr );
+  matrixFreeDirection->ExtractView( &directionPtr );
+  double dt = workset->timeStep;
+
+  // Perturb the configuration, evaluate the residual, and restore the configuration
+  *matrixFreeDeltaU = *deltaU;
+  for(int i=0 ; i<y->MyLength() ; ++i){
+    deltaUPtr[i] += epsilon*directionPtr[i];
+    yPtr[i] = xPtr[i] + uPtr[i] + deltaUPtr[i];
+    vPtr[i] = deltaUPtr[i]/dt;
+  }
+  computeQuasiStaticResidual(matrixFreeResidual);
+  *deltaU = *matrixFreeDeltaU;
+  for(int i=0 ; i<y->MyLength() ; ++i){
+    yPtr[i] = xPtr[i] + uPtr[i] + deltaUPtr[i];
+    vPtr[i] = deltaUPtr[i]/dt;
+  }
+
+  // result = -(R(deltaU + epsilon*w) - R(deltaU))/epsilon, plus -w in the kinematic B.C. rows
+  // (the residual is zero in those rows, and direction - matrixFreeDirection is nonzero only there)
+  result.Update(-1.0/epsilon, *matrixFreeResidual, 1.0/epsilon, baseResidual, 0.0);
+  result.Update(-1.0, direction, 1.0, *matrixFreeDirection, 1.0);
+
+  PeridigmNS::Timer::self().stopTimer("Matrix-Free Tangent");
+}
+
+void PeridigmNS::Peridigm::quasiStaticsComputeBlockDiagonalPreconditioner(bool diagonalOnly)
+{
+  tangent->PutScalar(0.0);
+  PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
+  modelEvaluator->evalJacobian(workset);
+  int err = overlapJacobian->globalAssemble();
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::quasiStaticsComputeBlockDiagonalPreconditioner(), GlobalAssemble() returned nonzero error code.\n");
+  PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
+  boundaryAndInitialConditionManager->applyKinematicBC_InsertZerosAndSetDiagonal(tangent);
+  tangent->Scale(-1.0);
+  invertBlockDiagonalTangent(diagonalOnly);
+}
+
 double PeridigmNS::Peridigm::quasiStaticsLineSearch(Teuchos::RCP<Epetra_Vector> residual,
                                                     Teuchos::RCP<Epetra_Vector> lhs,
                                                     double dt)
@@ -4473,7 +4846,7 @@ void PeridigmNS::Peridigm::computeImplicitJacobian(double beta, double dt) {
   tangent->PutScalar(0.0);
   PeridigmNS::Timer::self().startTimer("Evaluate Jacobian");
   modelEvaluator->evalJacobian(workset);
-  int err = tangent->GlobalAssemble();
+  int err = overlapJacobian->globalAssemble();
   TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::computeImplicitJacobian(), GlobalAssemble() returned nonzero error code.\n");
   PeridigmNS::Timer::self().stopTimer("Evaluate Jacobian");
 
@@ -4598,18 +4971,21 @@ void PeridigmNS::Peridigm::displayProgress(string title, double percentComplete)
 }
 
 void PeridigmNS::Peridigm::writeRestart(Teuchos::RCP<Teuchos::ParameterList> solverParams){
-//  system("date +"%m-%d-%Y-%H-%M-%S"");
-  char createDirectory[100];
+  // A previous restart that is still being written in the background must be complete first
+  completeRestart();
+
   char  path[100];
-  int IterationNumber;
+  int IterationNumber = atoi(firstNumbersSring( restartFiles["path"]  ).c_str())+1;
+  sprintf(path,"restart-%06d",IterationNumber);
+  setRestartNames(path);
 
   if(peridigmComm->MyPID() == 0){
-  IterationNumber = atoi(firstNumbersSring( restartFiles["path"]  ).c_str())+1;
-  sprintf(path,"restart-%06d",IterationNumber);
   cout << "The restart folder is " << path  <<"." << endl;
-  setRestartNames(path);
-  sprintf(createDirectory,"mkdir %s",path);
-  system(createDirectory);
+  if(mkdir(path, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH) != 0 && errno != EEXIST){
+    char directoryError[251];
+    sprintf(directoryError, "Error, unable to create restart folder %s.\n", path);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(true,directoryError);
+  }
   cout << "Writing restart files. \n" << endl;
 
   double timeInitial = solverParams->get("Initial Time", 0.0);
@@ -4627,69 +5003,60 @@ void PeridigmNS::Peridigm::writeRestart(Teuchos::RCP<Teuchos::ParameterList> sol
   outputFile << "Current time is " << "\n" << currentTime  << "\n";
   outputFile.close();
   }
+  // All ranks write into the folder created by rank 0
+  peridigmComm->Barrier();
+
   if(analysisHasMultiphysics){
 	 cout << "Restart for Multiphysics is not implemented yet." << endl;
 	 exit (0);
     }
-  else {
-	  //write block ID
-	  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["blockIDs"].c_str(),
-	  		*blockIDs,"blockIDs","",true);
-      //write horizon for each point
-	  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["horizon"].c_str(),
-	  		*horizon,"horizon","",true);
-	  //write cell volume
-	  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["volume"].c_str(),
-	  		*volume,"volume","",true);
-	  //write density
-	  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["density"].c_str(),
-	  		*density,"density","",true);
-	  //write change in temperature
-	  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["deltaTemperature"].c_str(),
-	  		*deltaTemperature,"deltaTemperature","",true);
-  }
-  //write initial positions
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["x"].c_str(),
-  		*x,"x","",true);
-  //write displacement
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["u"].c_str(),
-  		*u,"u","",true);
-  //write current positions
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["y"].c_str(),
-  		*y,"y","",true);
-  //write velocities
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["v"].c_str(),
-  		*v,"v","",true);
-  //write accelerations
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["a"].c_str(),
-  		*a,"a","",true);
-  //write force
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["force"].c_str(),
-  		*force,"force","",true);
-  //write contact force
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["contactForce"].c_str(),
-  		*contactForce,"contactForce","",true);
-  //write external force
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["externalForce"].c_str(),
-  		*externalForce,"externalForce","",true);
-  //write deltaU (increment in displacement)
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["deltaU"].c_str(),
-  		*deltaU,"deltaU","",true);
-  //write scratch
-  EpetraExt::VectorToMatrixMarketFile 	(restartFiles["scratch"].c_str(),
-  		*scratch,"scratch","",true);
-  //write block data
-	  std::vector<PeridigmNS::Block>::iterator blockIt;
-	  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-     	  std::string blockName = blockIt->getName();
-		  blockIt->writeBlocktoDisk(blockName,restartFiles["path"].c_str());
-	  }
+
+  bool compress = peridigmParams->get("Restart Compression", false);
+  bool asynchronous = peridigmParams->get("Asynchronous Restart", true);
+  restartWriter = Teuchos::rcp(new RestartWriter(*peridigmComm, restartFiles["path"], compress));
+
+  restartWriter->add("blockIDs", *blockIDs);
+  restartWriter->add("horizon", *horizon);
+  restartWriter->add("volume", *volume);
+  restartWriter->add("density", *density);
+  restartWriter->add("deltaTemperature", *deltaTemperature);
+  restartWriter->add("x", *x);
+  restartWriter->add("u", *u);
+  restartWriter->add("y", *y);
+  restartWriter->add("v", *v);
+  restartWriter->add("a", *a);
+  restartWriter->add("force", *force);
+  restartWriter->add("contactForce", *contactForce);
+  restartWriter->add("externalForce", *externalForce);
+  restartWriter->add("deltaU", *deltaU);
+  restartWriter->add("scratch", *scratch);
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    std::string blockName = blockIt->getName();
+    blockIt->writeBlocktoDisk(blockName, *restartWriter);
+  }
+
+  // The data has been copied into the writer, so the solver can continue while the files are written
+  restartWriter->write(asynchronous);
+}
+
+void PeridigmNS::Peridigm::completeRestart(){
+  if(restartWriter.is_null())
+    return;
+
+  // A failed write is reported on every rank, so that no rank goes on alone
+  string errorMessage;
+  try{
+    restartWriter->wait();
+  }
+  catch(const std::exception& e){
+    errorMessage = e.what();
+  }
+  restartWriter = Teuchos::null;
+  throwOnAnyRank(*peridigmComm, errorMessage, "**** Error:  Writing the restart failed on another rank.\n");
 }
 
 void PeridigmNS::Peridigm::readRestart(){
-	  double* UpdatePtr;
-	  double* oldPtr;
-	  Epetra_Vector * vectorUpdate;
 	  std::string trash, data;
 	  if(peridigmComm->MyPID() == 0){
 		  //read global current time
@@ -4713,90 +5080,29 @@ void PeridigmNS::Peridigm::readRestart(){
 		  MPI_Finalize();
 		  exit(0);
 	  }
-  }else{
-	  //read block ID
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["blockIDs"].c_str(), *oneDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  blockIDs->ExtractView(&oldPtr);
-	  blas.COPY(blockIDs->MyLength(), UpdatePtr, oldPtr);
-      //read horizon for each point
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["horizon"].c_str(), *oneDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  horizon->ExtractView(&oldPtr);
-	  blas.COPY(horizon->MyLength(), UpdatePtr, oldPtr);
-	  //read cell volume
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["volume"].c_str(), *oneDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  volume->ExtractView(&oldPtr);
-	  blas.COPY(volume->MyLength(), UpdatePtr, oldPtr);
-	  //read density
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["density"].c_str(), *oneDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  density->ExtractView(&oldPtr);
-	  blas.COPY(density->MyLength(), UpdatePtr, oldPtr);
-	  //read change in temperature
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["deltaTemperature"].c_str(), *oneDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  deltaTemperature->ExtractView(&oldPtr);
-	  blas.COPY(deltaTemperature->MyLength(), UpdatePtr, oldPtr);
-  }
-	  //read initial positions
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["x"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  x->ExtractView(&oldPtr);
-	  blas.COPY(x->MyLength(), UpdatePtr, oldPtr);
-	  //read displacement
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["u"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  u->ExtractView(&oldPtr);
-	  blas.COPY(u->MyLength(), UpdatePtr, oldPtr);
-	  //read current positions
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["y"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  y->ExtractView(&oldPtr);
-	  blas.COPY(y->MyLength(), UpdatePtr, oldPtr);
-	  //read velocities
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["v"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  v->ExtractView(&oldPtr);
-	  blas.COPY(v->MyLength(), UpdatePtr, oldPtr);
-	  //read accelerations
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["a"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  a->ExtractView(&oldPtr);
-	  blas.COPY(a->MyLength(), UpdatePtr, oldPtr);
-	  //read force
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["force"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  force->ExtractView(&oldPtr);
-	  blas.COPY(force->MyLength(), UpdatePtr, oldPtr);
-	  //read contact force
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["contactForce"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  contactForce->ExtractView(&oldPtr);
-	  blas.COPY(contactForce->MyLength(), UpdatePtr, oldPtr);
-	  vectorUpdate = 0;
-	  UpdatePtr = 0;
-	  oldPtr = 0;
-	  //read external force
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["externalForce"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  externalForce->ExtractView(&oldPtr);
-	  blas.COPY(externalForce->MyLength(), UpdatePtr, oldPtr);
-	  //read deltaU (increment in displacement)
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["deltaU"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  deltaU->ExtractView(&oldPtr);
-	  blas.COPY(deltaU->MyLength(), UpdatePtr, oldPtr);
-	  //read scratch
-	  EpetraExt::MatrixMarketFileToVector(restartFiles["scratch"].c_str(), *threeDimensionalMap, vectorUpdate);
-	  vectorUpdate->ExtractView(&UpdatePtr);
-	  scratch->ExtractView(&oldPtr);
-	  blas.COPY(scratch->MyLength(), UpdatePtr, oldPtr);
-	  //read block data
-	  	  std::vector<PeridigmNS::Block>::iterator blockIt;
-	  	  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-	     	  std::string blockName = blockIt->getName();
-			  blockIt->readBlockfromDisk(blockName,restartFiles["path"].c_str());
-	  	  }
+  }
+
+  // The restart may have been written on a different number of ranks; the reader
+  // redistributes the stored data onto the current maps
+  RestartReader reader(*peridigmComm, restartFiles["path"]);
+  reader.read("blockIDs", *blockIDs);
+  reader.read("horizon", *horizon);
+  reader.read("volume", *volume);
+  reader.read("density", *density);
+  reader.read("deltaTemperature", *deltaTemperature);
+  reader.read("x", *x);
+  reader.read("u", *u);
+  reader.read("y", *y);
+  reader.read("v", *v);
+  reader.read("a", *a);
+  reader.read("force", *force);
+  reader.read("contactForce", *contactForce);
+  reader.read("externalForce", *externalForce);
+  reader.read("deltaU", *deltaU);
+  reader.read("scratch", *scratch);
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    std::string blockName = blockIt->getName();
+    blockIt->readBlockfromDisk(blockName, reader);
+  }
 }
@@ -79,6 +79,7 @@
 #include "Peridigm_ContactManager.hpp"
 #include "Peridigm_ServiceManager.hpp"
 #include "Peridigm_DataLoader.hpp"
+#include "Peridigm_RestartFile.hpp"
 #include "Peridigm_Memstat.hpp"
 #include "Peridigm_Material.hpp"
 #include "Peridigm_DamageModel.hpp"
@@ -86,7 +87,6 @@
 
 namespace PeridigmNS {
 
-  class UserDefinedTimeDependentCriticalStretchDamageModel;
 
   class ShortRangeForceContactModel;
 
@@ -134,6 +134,9 @@ namespace PeridigmNS {
     //! Called from Main to drive multiple time integration solvers in sequence
     void executeSolvers();
 
+    //! Prints the measured cost of a point and its bonds in each block, relative to the cheapest block, for use as "Block Cost Factors"
+    void printBlockCostFactors();
+
     //! Compute the residual vector (pure virtual method in NOX::Epetra::Interface::Required)
     bool computeF(const Epetra_Vector& x, Epetra_Vector& FVec, FillType fillType = Residual);
 
@@ -178,7 +181,7 @@ namespace PeridigmNS {
       TEUCHOS_TEST_FOR_EXCEPT_MSG(tangent.is_null(), "**** PeridigmNS::Peridigm::evaluateTangentStiffnessMatrix(), tangent has not been allocated!\n");
       tangent->PutScalar(0.0);
       modelEvaluator->evalJacobian(workset);
-      int err = tangent->GlobalAssemble();
+      int err = overlapJacobian->globalAssemble();
       TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::Peridigm::evaluateTangentStiffnessMatrix(), GlobalAssemble() returned nonzero error code.\n");
       // Note:  Peridigm expects the tangent to be scaled using tangent->Scale(-1.0);
       //        but Albany does not.
@@ -286,11 +289,24 @@ namespace PeridigmNS {
     void quasiStaticsDampTangent(double dampedNewtonDiagonalScaleFactor,
                                  double dampedNewtonDiagonalShiftFactor);
 
-    //! Solve the global linear system
+    //! Solve the global linear system; the tangent is used as the operator unless linearOperator is given
     Belos::ReturnType quasiStaticsSolveSystem(Teuchos::RCP<Epetra_Vector> residual,
                                               Teuchos::RCP<Epetra_Vector> lhs,
                                               Belos::LinearProblem<double,Epetra_MultiVector,Epetra_Operator>& linearProblem,
-                                              Teuchos::RCP< Belos::SolverManager<double,Epetra_MultiVector,Epetra_Operator> >& belosSolver);
+                                              Teuchos::RCP< Belos::SolverManager<double,Epetra_MultiVector,Epetra_Operator> >& belosSolver,
+                                              Teuchos::RCP<const Epetra_Operator> linearOperator = Teuchos::null);
+
+    //! Apply the negated quasi-static tangent to direction by finite differencing the residual about the current deltaU
+    void quasiStaticsApplyMatrixFreeTangent(const Epetra_Vector& direction,
+                                            const Epetra_Vector& baseResidual,
+                                            double lambda,
+                                            Epetra_Vector& result);
+
+    //! Evaluate the block 3x3 tangent and replace it with the inverse of each block (or of its diagonal), for use as a preconditioner
+    void quasiStaticsComputeBlockDiagonalPreconditioner(bool diagonalOnly);
+
+    //! Replace each 3x3 block of the block diagonal tangent with its inverse; if diagonalOnly, only the diagonal is kept and inverted
+    void invertBlockDiagonalTangent(bool diagonalOnly = false);
 
     //! Perform line search
     double quasiStaticsLineSearch(Teuchos::RCP<Epetra_Vector> residual,
@@ -350,10 +366,6 @@ namespace PeridigmNS {
     Teuchos::RCP<Epetra_Vector> getConcentration() { return concentration; }
     Teuchos::RCP<Epetra_Vector> getDamage() { return damage; }
     Teuchos::RCP<Epetra_Vector> getJacobianDeterminant() { return jacobianDeterminant; }
-    Teuchos::RCP<Epetra_Vector> getWeightedVolume() { return weightedVolume; }
-    Teuchos::RCP<Epetra_Vector> getVelocityGradientX() { return velocityGradientX; }
-    Teuchos::RCP<Epetra_Vector> getVelocityGradientY() { return velocityGradientY; }
-    Teuchos::RCP<Epetra_Vector> getVelocityGradientZ() { return velocityGradientZ; }
     //@}
 
     //! Accessor for global neighborhood data
@@ -385,8 +397,11 @@ namespace PeridigmNS {
     //! Display a progress bar
     void displayProgress(std::string title, double percentComplete);
 
+    //! Record the memory used on this processor by the point data, bond data, neighbor lists, Jacobian, contact, and output staging
+    void updateMemoryStats();
+
     //! Display information about memory usage
-    void printMemoryStats(){Memstat * memstat = Memstat::Instance(); memstat->printStats();};
+    void printMemoryStats(){updateMemoryStats(); Memstat * memstat = Memstat::Instance(); memstat->printStats();};
 
   private:
 
@@ -432,8 +447,6 @@ namespace PeridigmNS {
     //! Damage models
     std::map< std::string, Teuchos::RCP<const PeridigmNS::DamageModel> > damageModels;
 
-    Teuchos::RCP< PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel > CSDamageModel;
-
     Teuchos::RCP<const PeridigmNS::ContactModel> contactModel;
     Teuchos::RCP<PeridigmNS::ContactModel> New_contactModel;
 
@@ -543,6 +556,11 @@ namespace PeridigmNS {
     //! Global scratch space vector
     Teuchos::RCP<Epetra_Vector> scratch;
 
+    //! Scratch vectors for matrix-free quasi-statics (perturbation direction, perturbed residual, saved deltaU)
+    Teuchos::RCP<Epetra_Vector> matrixFreeDirection;
+    Teuchos::RCP<Epetra_Vector> matrixFreeResidual;
+    Teuchos::RCP<Epetra_Vector> matrixFreeDeltaU;
+
     //! Vector containing velocities at dof with kinematic bc; used only by NOX solver.
     Teuchos::RCP<Epetra_Vector> noxVelocityAtDOFWithKinematicBC;
 
@@ -587,14 +605,6 @@ namespace PeridigmNS {
     //! Global vector for jacobian determinant
     Teuchos::RCP<Epetra_Vector> jacobianDeterminant;
 
-    //! Global vector for weighted volume
-    Teuchos::RCP<Epetra_Vector> weightedVolume;
-
-    //! Global vector for velocity gradient
-    Teuchos::RCP<Epetra_Vector> velocityGradientX;
-    Teuchos::RCP<Epetra_Vector> velocityGradientY;
-    Teuchos::RCP<Epetra_Vector> velocityGradientZ;
-
     bool analysisHasBondAssociatedHypoelasticModel;
 
     //! Type of tangent to evaluate
@@ -679,6 +689,12 @@ namespace PeridigmNS {
     // Write the restart files
     void writeRestart(Teuchos::RCP<Teuchos::ParameterList> solverParams);
 
+    // Writer of the most recent restart, kept alive until its asynchronous write completes
+    Teuchos::RCP<RestartWriter> restartWriter;
+
+    // Wait for the most recent restart to be written; throws on every rank if the write failed on any rank
+    void completeRestart();
+
     // Read the restart files
     void readRestart();
   };
@@ -86,7 +86,7 @@ void PeridigmNS::Block::initialize(Teuchos::RCP<const Epetra_BlockMap> globalOwn
     fieldIds.insert(fieldIds.end(), damageModelFieldIds.begin(), damageModelFieldIds.end());
   }
 
-  BlockBase::initializeDataManager(fieldIds);
+  BlockBase::initializeDataManager(fieldIds, materialModel->SinglePrecisionFieldIds());
 }
 
 void PeridigmNS::Block::initializeMaterialModel(double timeStep)
@@ -122,17 +122,42 @@ void PeridigmNS::Block::initializeDamageModel(double timeStep)
                           *dataManager);
 }
 
+void PeridigmNS::Block::damageModelPreStep(double timeCurrent, double timePrevious)
+{
+  if(damageModel.is_null())
+    return;
+
+  damageModel->updateTime(timeCurrent, timePrevious);
+  damageModel->preStep(timeCurrent - timePrevious,
+                       neighborhoodData->NumOwnedPoints(),
+                       neighborhoodData->OwnedIDs(),
+                       neighborhoodData->NeighborhoodList(),
+                       *dataManager);
+}
+
+void PeridigmNS::Block::damageModelPostStep(double timeStep)
+{
+  if(damageModel.is_null())
+    return;
+
+  damageModel->postStep(timeStep,
+                        neighborhoodData->NumOwnedPoints(),
+                        neighborhoodData->OwnedIDs(),
+                        neighborhoodData->NeighborhoodList(),
+                        *dataManager);
+}
+
 PeridigmNS::DataManagerSynchronizer& PeridigmNS::DataManagerSynchronizer::self() {
   static DataManagerSynchronizer dataManagerSynchronizer;
   return dataManagerSynchronizer;
 }
 
-void PeridigmNS::DataManagerSynchronizer::initialize(Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap,
+void PeridigmNS::DataManagerSynchronizer::initialize(Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap_,
                                                      Teuchos::RCP<const Epetra_BlockMap> threeDimensionalMap) {
-  scalarScratch = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
-  scalarSum = Teuchos::rcp(new Epetra_Vector(*oneDimensionalMap));
-  vectorScratch = Teuchos::rcp(new Epetra_Vector(*threeDimensionalMap));
-  vectorSum = Teuchos::rcp(new Epetra_Vector(*threeDimensionalMap));
+  // Vector fields are packed as three scalar columns, so only the one-dimensional map is needed
+  oneDimensionalMap = oneDimensionalMap_;
+  multiFieldScratch.clear();
+  multiFieldSum.clear();
 }
 
 void PeridigmNS::DataManagerSynchronizer::setFieldIdsToSynchronizeAfterInitialize(std::vector<int>& fieldIds)
@@ -201,49 +226,46 @@ void PeridigmNS::DataManagerSynchronizer::synchronizeDataAfterPrecompute(Teuchos
 }
 
 void PeridigmNS::DataManagerSynchronizer::synchronize(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks,
-                                                      std::vector<int> fieldIds)
+                                                      const std::vector<int>& fieldIds)
 {
   if (fieldIds.size() == 0)
     return;
 
-  std::vector<PeridigmNS::Block>::iterator blockIt;
-
-  for (auto fieldId : fieldIds) {
+  // Column layout of the packed fields:  one column per scalar field, three per vector field
+  std::vector<PeridigmField::Step> steps(fieldIds.size());
+  int numColumns = 0;
+  for (unsigned int i=0 ; i<fieldIds.size() ; ++i) {
 
-    FieldSpec fieldSpec = PeridigmNS::FieldManager::self().getFieldSpec(fieldId);
+    FieldSpec fieldSpec = PeridigmNS::FieldManager::self().getFieldSpec(fieldIds[i]);
 
     PeridigmField::Temporal temporal = fieldSpec.getTemporal();
-    PeridigmField::Step step = PeridigmField::STEP_NONE;
+    steps[i] = PeridigmField::STEP_NONE;
     if (temporal == PeridigmField::TWO_STEP) {
-      step = PeridigmField::STEP_NP1;
+      steps[i] = PeridigmField::STEP_NP1;
     }
 
     PeridigmField::Length length = fieldSpec.getLength();
-    if (length == PeridigmField::SCALAR) {
-      scalarSum->PutScalar(0.0);
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        scalarScratch->PutScalar(0.0);
-        blockIt->exportData(scalarScratch, fieldId, step, Add);
-        scalarSum->Update(1.0, *(scalarScratch), 1.0);
-      }
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        blockIt->importData(scalarSum, fieldId, step, Insert);
-      }
-    }
-    else if(length == PeridigmField::VECTOR) {
-      vectorSum->PutScalar(0.0);
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        vectorScratch->PutScalar(0.0);
-        blockIt->exportData(vectorScratch, fieldId, step, Add);
-        vectorSum->Update(1.0, *(vectorScratch), 1.0);
-      }
-      for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
-        blockIt->importData(vectorSum, fieldId, step, Insert);
-      }
-    }
-    else {
-      TEUCHOS_TEST_FOR_EXCEPT_MSG((length != PeridigmField::SCALAR && length != PeridigmField::VECTOR),
-                                  "**** Error in DataManagerSynchronizer::synchronize():  Parallel synchronization available only for scalar and vector variables.\n");
-    }
+    TEUCHOS_TEST_FOR_EXCEPT_MSG((length != PeridigmField::SCALAR && length != PeridigmField::VECTOR),
+                                "**** Error in DataManagerSynchronizer::synchronize():  Parallel synchronization available only for scalar and vector variables.\n");
+    numColumns += PeridigmField::variableDimension(length);
+  }
+
+  // The phases synchronize different sets of fields, so one pair of multivectors is kept per column count
+  Teuchos::RCP<Epetra_MultiVector>& scratch = multiFieldScratch[numColumns];
+  Teuchos::RCP<Epetra_MultiVector>& sum = multiFieldSum[numColumns];
+  if (sum.is_null()) {
+    scratch = Teuchos::rcp(new Epetra_MultiVector(*oneDimensionalMap, numColumns));
+    sum = Teuchos::rcp(new Epetra_MultiVector(*oneDimensionalMap, numColumns));
+  }
+
+  std::vector<PeridigmNS::Block>::iterator blockIt;
+  sum->PutScalar(0.0);
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    scratch->PutScalar(0.0);
+    blockIt->exportFields(scratch, fieldIds, steps, Add);
+    sum->Update(1.0, *scratch, 1.0);
+  }
+  for(blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    blockIt->importFields(sum, fieldIds, steps, Insert);
   }
 }
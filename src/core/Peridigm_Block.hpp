@@ -115,6 +115,12 @@ namespace PeridigmNS {
     //! Initialize the damage model
     void initializeDamageModel(double timeStep = 1.0);
 
+    //! Advance the damage model to a new time step; calls DamageModel::updateTime() and DamageModel::preStep()
+    void damageModelPreStep(double timeCurrent, double timePrevious);
+
+    //! Complete the time step in the damage model; calls DamageModel::postStep()
+    void damageModelPostStep(double timeStep);
+
   protected:
 
     //! The material model
@@ -145,18 +151,25 @@ namespace PeridigmNS {
     //! Synchronize data across block boundaries and MPI partitions after material models have called precompute.
     void synchronizeDataAfterPrecompute(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks);
 
-  protected:
-
+    /*! \brief Synchronize the given scalar and vector fields across block boundaries and MPI partitions.
+     *
+     *  The contributions of all blocks are summed and the sum is copied back to every block.  The fields are packed
+     *  together, so each block takes part in one Export and one Import regardless of the number of fields.
+     */
     void synchronize(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks,
-                     std::vector<int> fieldIds);
+                     const std::vector<int>& fieldIds);
+
+  protected:
 
     std::vector<int> fieldIdsToSychAfterInitialize;
     std::vector<int> fieldIdsToSychAfterPrecompute;
 
-    Teuchos::RCP<Epetra_Vector> scalarScratch;
-    Teuchos::RCP<Epetra_Vector> scalarSum;
-    Teuchos::RCP<Epetra_Vector> vectorScratch;
-    Teuchos::RCP<Epetra_Vector> vectorSum;
+    //! One-dimensional owned map on which the packed fields are summed.
+    Teuchos::RCP<const Epetra_BlockMap> oneDimensionalMap;
+
+    //! Scratch and sum multivectors for the packed fields, keyed by the number of columns.
+    std::map< int, Teuchos::RCP<Epetra_MultiVector> > multiFieldScratch;
+    std::map< int, Teuchos::RCP<Epetra_MultiVector> > multiFieldSum;
 
   private:
 
@@ -47,6 +47,7 @@
 
 #include "Peridigm_BlockBase.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_Timer.hpp"
 #include <vector>
 #include <set>
 
@@ -92,6 +93,7 @@ void PeridigmNS::BlockBase::importData(Teuchos::RCP<const Epetra_Vector> source,
       if(threeDimensionalImporter.is_null())
         threeDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapVectorPointMap(), source->Map()));
       dataManager->getData(fieldId, step)->Import(*source, *threeDimensionalImporter, combineMode);
+      dataManager->synchronizeStructureOfArraysData(fieldId, step);
     }
   }
 }
@@ -116,6 +118,90 @@ void PeridigmNS::BlockBase::exportData(Teuchos::RCP<Epetra_Vector> target, int f
   }
 }
 
+Epetra_MultiVector& PeridigmNS::BlockBase::getOverlapFieldBuffer(int numColumns)
+{
+  Teuchos::RCP<Epetra_MultiVector>& buffer = overlapFieldBuffers[numColumns];
+  if(buffer.is_null())
+    buffer = Teuchos::rcp(new Epetra_MultiVector(*dataManager->getOverlapScalarPointMap(), numColumns));
+  return *buffer;
+}
+
+void PeridigmNS::BlockBase::importFields(Teuchos::RCP<const Epetra_MultiVector> source,
+                                         const std::vector<int>& fieldIds,
+                                         const std::vector<PeridigmField::Step>& steps,
+                                         Epetra_CombineMode combineMode)
+{
+  if(source.is_null() || fieldIds.size() == 0)
+    return;
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(source->Map().ElementSize() != 1,
+                              "**** Error in BlockBase::importFields():  The source must be defined on a one-dimensional map.\n");
+
+  if(oneDimensionalImporter.is_null())
+    oneDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapScalarPointMap(), source->Map()));
+  Epetra_MultiVector& buffer = getOverlapFieldBuffer(source->NumVectors());
+  buffer.Import(*source, *oneDimensionalImporter, combineMode);
+
+  // Unpack the columns into the DataManager, interleaving the components of vector fields
+  const int numPoints = buffer.MyLength();
+  int column = 0;
+  for(unsigned int i=0 ; i<fieldIds.size() ; ++i){
+    const int fieldId = fieldIds[i];
+    const int length = PeridigmField::variableDimension(PeridigmNS::FieldManager::self().getFieldSpec(fieldId).getLength());
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(column + length > buffer.NumVectors(),
+                                "**** Error in BlockBase::importFields():  The source has too few columns for the requested fields.\n");
+    if(dataManager->hasData(fieldId, steps[i])){
+      double* data;
+      dataManager->getData(fieldId, steps[i])->ExtractView(&data);
+      for(int dof=0 ; dof<length ; ++dof){
+        const double* packed = buffer[column + dof];
+        for(int iPoint=0 ; iPoint<numPoints ; ++iPoint)
+          data[length*iPoint + dof] = packed[iPoint];
+      }
+      if(length == 3)
+        dataManager->synchronizeStructureOfArraysData(fieldId, steps[i]);
+    }
+    column += length;
+  }
+}
+
+void PeridigmNS::BlockBase::exportFields(Teuchos::RCP<Epetra_MultiVector> target,
+                                         const std::vector<int>& fieldIds,
+                                         const std::vector<PeridigmField::Step>& steps,
+                                         Epetra_CombineMode combineMode)
+{
+  if(target.is_null() || fieldIds.size() == 0)
+    return;
+
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(target->Map().ElementSize() != 1,
+                              "**** Error in BlockBase::exportFields():  The target must be defined on a one-dimensional map.\n");
+
+  // Pack the fields into the columns of the buffer, one column per component
+  Epetra_MultiVector& buffer = getOverlapFieldBuffer(target->NumVectors());
+  const int numPoints = buffer.MyLength();
+  int column = 0;
+  for(unsigned int i=0 ; i<fieldIds.size() ; ++i){
+    const int fieldId = fieldIds[i];
+    const int length = PeridigmField::variableDimension(PeridigmNS::FieldManager::self().getFieldSpec(fieldId).getLength());
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(column + length > buffer.NumVectors(),
+                                "**** Error in BlockBase::exportFields():  The target has too few columns for the requested fields.\n");
+    const bool hasField = dataManager->hasData(fieldId, steps[i]);
+    double* data = 0;
+    if(hasField)
+      dataManager->getData(fieldId, steps[i])->ExtractView(&data);
+    for(int dof=0 ; dof<length ; ++dof){
+      double* packed = buffer[column + dof];
+      for(int iPoint=0 ; iPoint<numPoints ; ++iPoint)
+        packed[iPoint] = hasField ? data[length*iPoint + dof] : 0.0;
+    }
+    column += length;
+  }
+
+  if(oneDimensionalImporter.is_null())
+    oneDimensionalImporter = Teuchos::rcp(new Epetra_Import(*dataManager->getOverlapScalarPointMap(), target->Map()));
+  target->Export(buffer, *oneDimensionalImporter, combineMode);
+}
+
 void PeridigmNS::BlockBase::createMapsFromGlobalMaps(Teuchos::RCP<const Epetra_BlockMap> globalOwnedScalarPointMap,
                                                      Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap,
                                                      Teuchos::RCP<const Epetra_BlockMap> globalOwnedVectorPointMap,
@@ -228,6 +314,7 @@ void PeridigmNS::BlockBase::createMapsFromGlobalMaps(Teuchos::RCP<const Epetra_B
   // Invalidate the importers
   oneDimensionalImporter = Teuchos::RCP<Epetra_Import>();
   threeDimensionalImporter = Teuchos::RCP<Epetra_Import>();
+  overlapFieldBuffers.clear();
 }
 
 Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::BlockBase::createNeighborhoodDataFromGlobalNeighborhoodData(Teuchos::RCP<const Epetra_BlockMap> globalOverlapScalarPointMap,
@@ -280,11 +367,26 @@ Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::BlockBase::createNeighbor
            &neighborhoodList.at(0),
            neighborhoodList.size()*sizeof(int));
   }
+  blockNeighborhoodData->BuildCSR();
 
   return blockNeighborhoodData;
 }
 
-void PeridigmNS::BlockBase::initializeDataManager(vector<int> fieldIds)
+int PeridigmNS::BlockBase::getTimerId(TimedPhase phase)
+{
+  if(phaseTimerIds.empty()){
+    // The internal force timer keeps the name used for calibrating load-balance cost factors
+    PeridigmNS::Timer& timer = PeridigmNS::Timer::self();
+    phaseTimerIds.resize(NUM_TIMED_PHASES);
+    phaseTimerIds[DAMAGE_TIMER] = timer.timerId("Damage: " + blockName);
+    phaseTimerIds[PRECOMPUTE_TIMER] = timer.timerId("Precompute: " + blockName);
+    phaseTimerIds[INTERNAL_FORCE_TIMER] = timer.timerId("Internal Force: " + blockName);
+    phaseTimerIds[CONTACT_TIMER] = timer.timerId("Contact: " + blockName);
+  }
+  return phaseTimerIds[phase];
+}
+
+void PeridigmNS::BlockBase::initializeDataManager(vector<int> fieldIds, vector<int> singlePrecisionFieldIds)
 {
   // The material model must be set prior to initializing the data manager.
   // Note that not all the maps are strictly required, so these conditions could be relaxed somewhat.
@@ -309,6 +411,17 @@ void PeridigmNS::BlockBase::initializeDataManager(vector<int> fieldIds)
   fieldIds.erase(newEnd, fieldIds.end());
 
   // Allocate data in the data manager
+  dataManager->setSinglePrecisionFieldIds(singlePrecisionFieldIds);
   dataManager->allocateData(fieldIds);
+
+  // Optionally keep structure-of-arrays copies of the coordinates and forces for the vectorized kernels
+  if(blockParams.isParameter("Structure Of Arrays Layout") && blockParams.get<bool>("Structure Of Arrays Layout")){
+    PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+    vector<int> structureOfArraysFieldIds;
+    structureOfArraysFieldIds.push_back(fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::CONSTANT, "Model_Coordinates"));
+    structureOfArraysFieldIds.push_back(fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Coordinates"));
+    structureOfArraysFieldIds.push_back(fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Force_Density"));
+    dataManager->setStructureOfArraysFieldIds(structureOfArraysFieldIds);
+  }
 }
 
@@ -52,6 +52,7 @@
 #include <Teuchos_ParameterList.hpp>
 #include <Epetra_Map.h>
 #include <Epetra_Vector.h>
+#include <Epetra_MultiVector.h>
 #include <Epetra_Import.h>
 
 #include <vector>
@@ -126,6 +127,12 @@ namespace PeridigmNS {
       return blockName;
     }
 
+    //! Phases of the evaluation of a block that have a timer of their own.
+    enum TimedPhase { DAMAGE_TIMER=0, PRECOMPUTE_TIMER=1, INTERNAL_FORCE_TIMER=2, CONTACT_TIMER=3, NUM_TIMED_PHASES=4 };
+
+    //! Get the id of the timer for a phase of this block, named "<phase>: <block name>"; the timers are created on first use.
+    int getTimerId(TimedPhase phase);
+
     //! Get the number of points in the block (does not include ghosts)
     int numPoints() {
       TEUCHOS_TEST_FOR_EXCEPT_MSG(
@@ -166,14 +173,35 @@ namespace PeridigmNS {
      */
     void exportData(Teuchos::RCP<Epetra_Vector> target, int fieldId, PeridigmField::Step step, Epetra_CombineMode combineMode);
 
+    /*! \brief Import several fields at once from the columns of the given source multivector.
+     *
+     *  The source is a non-overlapped multivector on the one-dimensional map.  A scalar field occupies one column and a
+     *  vector field occupies three consecutive columns (x, y, z), in the order of fieldIds.  All the fields are communicated
+     *  in a single Import.  Fields that are not allocated in the BlockBase's DataManager are skipped.
+     */
+    void importFields(Teuchos::RCP<const Epetra_MultiVector> source,
+                      const std::vector<int>& fieldIds,
+                      const std::vector<PeridigmField::Step>& steps,
+                      Epetra_CombineMode combineMode);
+
+    /*! \brief Export several fields at once to the columns of the given target multivector.
+     *
+     *  The column layout is the same as for importFields().  All the fields are communicated in a single Export; fields that
+     *  are not allocated in the BlockBase's DataManager contribute zeros.
+     */
+    void exportFields(Teuchos::RCP<Epetra_MultiVector> target,
+                      const std::vector<int>& fieldIds,
+                      const std::vector<PeridigmField::Step>& steps,
+                      Epetra_CombineMode combineMode);
+
     //! Swaps STATE_N and STATE_NP1.
     void updateState(){ dataManager->updateState(); };
 
     //! Write block data
-    void writeBlocktoDisk(std::string blockName, char const * path){ dataManager->writeBlocktoDisk(blockName, path); }
+    void writeBlocktoDisk(std::string blockName, RestartWriter& writer){ dataManager->writeBlocktoDisk(blockName, writer); }
 
     //! Read block data
-    void readBlockfromDisk(std::string blockName, char const * path){ dataManager->readBlockfromDisk(blockName, path); }
+    void readBlockfromDisk(std::string blockName, RestartReader& reader){ dataManager->readBlockfromDisk(blockName, reader); }
 
   protected:
 
@@ -198,13 +226,18 @@ namespace PeridigmNS {
     /*! \brief Initialize the data manager.
      *
      *  The DataManager will include all the field specs requested by the material model and
-     *  the contact model, as well as those provided by setAuxiliaryFieldIds().
+     *  the contact model, as well as those provided by setAuxiliaryFieldIds().  The step N values
+     *  of the two-step bond fields in singlePrecisionFieldIds are stored in single precision, see
+     *  DataManager::setSinglePrecisionFieldIds().
      */
-    void initializeDataManager(std::vector<int> fieldIds);
+    void initializeDataManager(std::vector<int> fieldIds, std::vector<int> singlePrecisionFieldIds = std::vector<int>());
 
     std::string blockName;
     int blockID;
 
+    //! Timer ids for the timed phases, see getTimerId().
+    std::vector<int> phaseTimerIds;
+
     //! @name Maps
     //@{
     //! One-dimensional map for owned points.
@@ -225,6 +258,12 @@ namespace PeridigmNS {
     //! One-dimensional Importer from global to overlapped vectors
     Teuchos::RCP<const Epetra_Import> threeDimensionalImporter;
 
+    //! Overlap multivectors into which importFields() and exportFields() pack the fields, keyed by the number of columns.
+    std::map< int, Teuchos::RCP<Epetra_MultiVector> > overlapFieldBuffers;
+
+    //! Returns the overlap packing buffer with the given number of columns, allocating it on first use.
+    Epetra_MultiVector& getOverlapFieldBuffer(int numColumns);
+
     //! The neighborhood data
     Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData;
 
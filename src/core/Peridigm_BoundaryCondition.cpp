@@ -84,6 +84,20 @@ PeridigmNS::BoundaryCondition::BoundaryCondition(const string & name_,
   rtcFunction->addVar("double", "t");
   rtcFunction->addVar("double", "value");
 
+  // Compile the function once; functions outside the supported syntax are left to the run-time compiler
+  std::vector<std::string> variableNames;
+  variableNames.push_back("x");
+  variableNames.push_back("y");
+  variableNames.push_back("z");
+  variableNames.push_back("t");
+  variableNames.push_back("value");
+  expression = Teuchos::rcp(new Expression(variableNames));
+  string expressionString = function;
+  if(expressionString.find("value") == string::npos)
+    expressionString = "value = " + expressionString;
+  if(!expression->compile(expressionString))
+    expression = Teuchos::null;
+
   if(toVector->Map().ElementSize()==1)
   {
     tensorOrder = SCALAR;
@@ -100,6 +114,16 @@ void PeridigmNS::BoundaryCondition::evaluateParser(const int & localNodeID, doub
   const Epetra_BlockMap& threeDimensionalMap = x->Map();
   TEUCHOS_TEST_FOR_EXCEPT_MSG(threeDimensionalMap.ElementSize() != 3, "**** setVectorValues() must be called with map having element size = 3.\n");
 
+  if(!expression.is_null()){
+    double values[5] = {(*x)[localNodeID*3], (*x)[localNodeID*3 + 1], (*x)[localNodeID*3 + 2], timePrevious, 0.0};
+    previousValue = expression->evaluate(values);
+    values[3] = timeCurrent;
+    currentValue = expression->evaluate(values);
+    if(bcType==PRESCRIBED_DISPLACEMENT && currentValue - previousValue == 0.0)
+      previousValue = (*peridigm->getU())[localNodeID*3 + coord];
+    return;
+  }
+
   bool success(true);
   // set the coordinates and set the return value to 0.0
   if(success)
@@ -147,6 +171,61 @@ void PeridigmNS::BoundaryCondition::evaluateParser(const int & localNodeID, doub
   // who wins?
 }
 
+void PeridigmNS::BoundaryCondition::evaluateParser(const std::vector<int> & localNodeIDs,
+                                                   std::vector<double> & currentValues,
+                                                   std::vector<double> & previousValues,
+                                                   const double & timeCurrent,
+                                                   const double & timePrevious){
+  const int numNodes = static_cast<int>(localNodeIDs.size());
+  currentValues.resize(numNodes);
+  previousValues.resize(numNodes);
+
+  if(expression.is_null()){
+    for(int i=0 ; i<numNodes ; ++i)
+      evaluateParser(localNodeIDs[i], currentValues[i], previousValues[i], timeCurrent, timePrevious);
+    return;
+  }
+
+  // Gather the coordinates only if the function depends on space; otherwise the
+  // expression is evaluated once and broadcast to all the nodes
+  if(expression->dependsOn(0) || expression->dependsOn(1) || expression->dependsOn(2)){
+    Teuchos::RCP<Epetra_Vector> x = peridigm->getX();
+    nodeCoordinates.resize(3*numNodes);
+    for(int i=0 ; i<numNodes ; ++i){
+      for(int dof=0 ; dof<3 ; ++dof)
+        nodeCoordinates[3*i + dof] = (*x)[localNodeIDs[i]*3 + dof];
+    }
+    for(int dof=0 ; dof<3 ; ++dof)
+      expression->setVariable(dof, numNodes > 0 ? &nodeCoordinates[dof] : NULL, 3);
+  }
+  else{
+    for(int dof=0 ; dof<3 ; ++dof)
+      expression->setVariable(dof, 0.0);
+  }
+  expression->setVariable(4, 0.0);
+
+  if(numNodes > 0){
+    expression->setVariable(3, timePrevious);
+    expression->evaluate(numNodes, &previousValues[0]);
+    if(expression->dependsOn(3)){
+      expression->setVariable(3, timeCurrent);
+      expression->evaluate(numNodes, &currentValues[0]);
+    }
+    else{
+      currentValues = previousValues;
+    }
+  }
+
+  // A prescribed displacement with a zero increment is measured from the current displacement, see above
+  if(bcType==PRESCRIBED_DISPLACEMENT){
+    Teuchos::RCP<Epetra_Vector> previousDisplacement = peridigm->getU();
+    for(int i=0 ; i<numNodes ; ++i){
+      if(currentValues[i] - previousValues[i] == 0.0)
+        previousValues[i] = (*previousDisplacement)[localNodeIDs[i]*3 + coord];
+    }
+  }
+}
+
 PeridigmNS::DirichletBC::DirichletBC(const string & name_,
                                      const Teuchos::ParameterList& bcParams_,
                                      Teuchos::RCP<Epetra_Vector> toVector_,
@@ -161,28 +240,33 @@ void PeridigmNS::DirichletBC::apply(Teuchos::RCP< std::map< std::string, std::ve
   // get the tensor order of the bc field:
   const int fieldDimension = to_dimension_size(tensorOrder);
 
-  string rtcFunctionString = function;
-  if(rtcFunctionString.find("value") == string::npos)
-    rtcFunctionString = "value = " + rtcFunctionString;
-  bool success = rtcFunction->addBody(rtcFunctionString);
-  if(!success){
-    string msg = "\n**** Error:  rtcFunction->addBody(function) returned error code in PeridigmNS::DirichletBC::apply().\n";
-    msg += "**** " + rtcFunction->getErrors() + "\n";
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+  if(expression.is_null()){
+    string rtcFunctionString = function;
+    if(rtcFunctionString.find("value") == string::npos)
+      rtcFunctionString = "value = " + rtcFunctionString;
+    bool success = rtcFunction->addBody(rtcFunctionString);
+    if(!success){
+      string msg = "\n**** Error:  rtcFunction->addBody(function) returned error code in PeridigmNS::DirichletBC::apply().\n";
+      msg += "**** " + rtcFunction->getErrors() + "\n";
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+    }
   }
 
   TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(nodeSetName) == nodeSets->end(),
                               "**** Error in DirichletBC::apply(), node set not found: " + nodeSetName + "\n");
   vector<int> & nodeList = nodeSets->find(nodeSetName)->second;
+  vector<int> localNodeIDs;
+  localNodeIDs.reserve(nodeList.size());
   for(unsigned int i=0 ; i<nodeList.size() ; i++){
     int localNodeID = toVector->Map().LID(nodeList[i]);
-    if(localNodeID != -1) {
-      double currentValue = 0.0;
-      double previousValue = 0.0;
-      evaluateParser(localNodeID,currentValue,previousValue,timeCurrent);
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(currentValue), "**** NaN returned by dirichlet BC evaluation.\n");
-      (*toVector)[localNodeID*fieldDimension + coord] = currentValue;
-    }
+    if(localNodeID != -1)
+      localNodeIDs.push_back(localNodeID);
+  }
+  vector<double> currentValues, previousValues;
+  evaluateParser(localNodeIDs,currentValues,previousValues,timeCurrent);
+  for(unsigned int i=0 ; i<localNodeIDs.size() ; i++){
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(currentValues[i]), "**** NaN returned by dirichlet BC evaluation.\n");
+    (*toVector)[localNodeIDs[i]*fieldDimension + coord] = currentValues[i];
   }
 }
 
@@ -213,30 +297,35 @@ void PeridigmNS::DirichletIncrementBC::apply(Teuchos::RCP< std::map< std::string
   // get the tensor order of the bc field:
   const int fieldDimension = to_dimension_size(tensorOrder);
 
-  string rtcFunctionString = function;
-  if(rtcFunctionString.find("value") == string::npos)
-    rtcFunctionString = "value = " + rtcFunctionString;
-  bool success = rtcFunction->addBody(rtcFunctionString);
-  if(!success){
-    string msg = "\n**** Error:  rtcFunction->addBody(function) returned nonzero error code in PeridigmNS::DirichletBC::apply().\n";
-    msg += "**** " + rtcFunction->getErrors() + "\n";
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+  if(expression.is_null()){
+    string rtcFunctionString = function;
+    if(rtcFunctionString.find("value") == string::npos)
+      rtcFunctionString = "value = " + rtcFunctionString;
+    bool success = rtcFunction->addBody(rtcFunctionString);
+    if(!success){
+      string msg = "\n**** Error:  rtcFunction->addBody(function) returned nonzero error code in PeridigmNS::DirichletBC::apply().\n";
+      msg += "**** " + rtcFunction->getErrors() + "\n";
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+    }
   }
 
   TEUCHOS_TEST_FOR_EXCEPT_MSG(nodeSets->find(nodeSetName) == nodeSets->end(),
                               "**** Error in DirichletBC::apply(), node set not found: " + nodeSetName + "\n");
   vector<int> & nodeList = nodeSets->find(nodeSetName)->second;
+  vector<int> localNodeIDs;
+  localNodeIDs.reserve(nodeList.size());
   for(unsigned int i=0 ; i<nodeList.size() ; i++){
     int localNodeID = toVector->Map().LID(nodeList[i]);
-    if(localNodeID != -1) {
-      double currentValue = 0.0;
-      double previousValue = 0.0;
-      evaluateParser(localNodeID,currentValue,previousValue,timeCurrent,timePrevious_);
-      const double value = coeff * (currentValue - previousValue)
-        + deltaTCoeff * (currentValue - previousValue) * (1.0 / (timeCurrent - timePrevious_));
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(value), "**** NaN returned by dirichlet increment BC evaluation.\n");
-      (*toVector)[localNodeID*fieldDimension + coord] = value;
-    }
+    if(localNodeID != -1)
+      localNodeIDs.push_back(localNodeID);
+  }
+  vector<double> currentValues, previousValues;
+  evaluateParser(localNodeIDs,currentValues,previousValues,timeCurrent,timePrevious_);
+  for(unsigned int i=0 ; i<localNodeIDs.size() ; i++){
+    const double value = coeff * (currentValues[i] - previousValues[i])
+      + deltaTCoeff * (currentValues[i] - previousValues[i]) * (1.0 / (timeCurrent - timePrevious_));
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(value), "**** NaN returned by dirichlet increment BC evaluation.\n");
+    (*toVector)[localNodeIDs[i]*fieldDimension + coord] = value;
   }
 }
 
@@ -49,6 +49,7 @@
 #define PERIDIGM_BOUNARYCONDITION_HPP
 
 #include "Peridigm_Enums.hpp"
+#include "Peridigm_Expression.hpp"
 #include <Epetra_Vector.h>
 
 #include <Trilinos_version.h>
@@ -106,6 +107,13 @@ public:
                       const double & timeCurrent = 0.0,
                       const double & timePrevious = 0.0);
 
+  //! evaluate function parser for a list of nodes
+  void evaluateParser(const std::vector<int> & localNodeIDs,
+                      std::vector<double> & currentValues,
+                      std::vector<double> & previousValues,
+                      const double & timeCurrent = 0.0,
+                      const double & timePrevious = 0.0);
+
 protected:
 
   //! Ref your parent instantiator
@@ -129,9 +137,15 @@ protected:
   //! string defined funciton
   string function;
 
-  //! Run-time compiler, used as function parser
+  //! Run-time compiler, used as function parser for functions the compiled expression does not support
   Teuchos::RCP<PG_RuntimeCompiler::Function> rtcFunction;
 
+  //! Compiled function, evaluated over all the nodes of the node set at once
+  Teuchos::RCP<Expression> expression;
+
+  //! Scratch space for the coordinates of the nodes passed to the compiled function
+  std::vector<double> nodeCoordinates;
+
   Tensor_Order tensorOrder;
 
 private:
@@ -54,6 +54,8 @@
 #include "NeighborhoodList.h"
 #include <sstream>
 #include <iterator>
+#include <cmath>
+#include <algorithm>
 
 using namespace std;
 
@@ -62,7 +64,7 @@ using namespace std;
 PeridigmNS::ContactManager::ContactManager(const Teuchos::ParameterList& contactParams,
                                            Teuchos::RCP<Discretization> disc,
                                            Teuchos::RCP<Teuchos::ParameterList> peridigmParams)
-  : verbose(false), myPID(-1), params(contactParams), contactRebalanceFrequency(0), contactSearchRadius(0.0),
+  : verbose(false), myPID(-1), params(contactParams), contactRebalanceFrequency(0), contactSearchRadius(0.0), cellListSearch(false), candidateSearch(false), surfaceVolumeFraction(0.9), candidatesChanged(false), verletSkin(0.0), numContactSearches(0), weightedLoadBalance(false),
     blockIdFieldId(-1), volumeFieldId(-1), coordinatesFieldId(-1), velocityFieldId(-1), contactForceDensityFieldId(-1)
 {
   if(contactParams.isParameter("Verbose"))
@@ -79,9 +81,37 @@ PeridigmNS::ContactManager::ContactManager(const Teuchos::ParameterList& contact
   if(!contactParams.isParameter("Search Radius"))
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Search Radius\" not specified.");
   contactSearchRadius = contactParams.get<double>("Search Radius");
-  if(!contactParams.isParameter("Search Frequency"))
+  if(contactParams.isParameter("Search Method")){
+    string searchMethod = contactParams.get<string>("Search Method");
+    TEUCHOS_TEST_FOR_EXCEPTION(searchMethod != "Tree" && searchMethod != "Cell List", Teuchos::Exceptions::InvalidParameter,
+                               "Contact parameter \"Search Method\" must be \"Tree\" or \"Cell List\".");
+    cellListSearch = (searchMethod == "Cell List");
+  }
+  // Contact can only occur between points on the free surface and points that have lost bonds
+  if(contactParams.isParameter("Search Surface And Damaged Points Only"))
+    candidateSearch = contactParams.get<bool>("Search Surface And Damaged Points Only");
+  if(contactParams.isParameter("Surface Neighborhood Volume Fraction"))
+    surfaceVolumeFraction = contactParams.get<double>("Surface Neighborhood Volume Fraction");
+  // With a Verlet skin, the neighbor lists are built with the inflated radius (search radius plus skin) and the
+  // search frequency is the interval at which the displacements are checked, which defaults to every step
+  if(contactParams.isParameter("Verlet Skin")){
+    verletSkin = contactParams.get<double>("Verlet Skin");
+    TEUCHOS_TEST_FOR_EXCEPTION(verletSkin <= 0.0, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Verlet Skin\" must be positive.");
+  }
+  if(!contactParams.isParameter("Search Frequency") && verletSkin == 0.0)
     TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter, "Contact parameter \"Search Frequency\" not specified.");
-  contactRebalanceFrequency = contactParams.get<int>("Search Frequency");
+  contactRebalanceFrequency = 1;
+  if(contactParams.isParameter("Search Frequency"))
+    contactRebalanceFrequency = contactParams.get<int>("Search Frequency");
+
+  // Weighted load balancing uses the same cost factors as the initial decomposition
+  const Teuchos::ParameterList& discParams = peridigmParams->sublist("Discretization");
+  weightedLoadBalance = Discretization::hasWeightedLoadBalance(discParams);
+  if(weightedLoadBalance){
+    vector<string> discretizationBlockNames = disc->getBlockNames();
+    for(unsigned int i=0 ; i<discretizationBlockNames.size() ; ++i)
+      blockCostFactors[disc->blockNameToBlockId(discretizationBlockNames[i])] = Discretization::getBlockCostFactor(discParams, discretizationBlockNames[i]);
+  }
 
   createContactInteractionsList(contactParams, disc);
 
@@ -347,9 +377,10 @@ void PeridigmNS::ContactManager::initialize(Teuchos::RCP<const Epetra_BlockMap>
   threeDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*threeDimensionalContactMap, *threeDimensionalMap));
 
   // Create the contact mothership multivectors
-  oneDimensionalContactMothership = Teuchos::rcp(new Epetra_MultiVector(*oneDimensionalContactMap, 2));
+  oneDimensionalContactMothership = Teuchos::rcp(new Epetra_MultiVector(*oneDimensionalContactMap, 3));
   contactBlockIDs = Teuchos::rcp((*oneDimensionalContactMothership)(0), false);         // block ID
   contactVolume = Teuchos::rcp((*oneDimensionalContactMothership)(1), false);           // cell volume
+  contactCandidates = Teuchos::rcp((*oneDimensionalContactMothership)(2), false);       // contact candidate flag
 
   threeDimensionalContactMothership = Teuchos::rcp(new Epetra_MultiVector(*threeDimensionalContactMap, 4));
   contactY = Teuchos::rcp((*threeDimensionalContactMothership)(0), false);             // current positions
@@ -365,6 +396,7 @@ void PeridigmNS::ContactManager::loadAllMothershipData(Teuchos::RCP<Epetra_Vecto
 {
   contactBlockIDs->Import(*blockIds, *oneDimensionalMothershipToContactMothershipImporter, Insert);
   contactVolume->Import(*volume, *oneDimensionalMothershipToContactMothershipImporter, Insert);
+  contactCandidates->PutScalar(1.0);
   contactY->Import(*y, *threeDimensionalMothershipToContactMothershipImporter, Insert);
   contactV->Import(*v, *threeDimensionalMothershipToContactMothershipImporter, Insert);
   contactContactForce->PutScalar(0.0);
@@ -433,6 +465,26 @@ void PeridigmNS::ContactManager::loadNeighborhoodData(Teuchos::RCP<PeridigmNS::N
   neighborhoodData = Teuchos::rcp(new PeridigmNS::NeighborhoodData(*globalNeighborhoodData));
 #endif
   contactNeighborhoodData = Teuchos::rcp(new PeridigmNS::NeighborhoodData(*neighborhoodData));
+
+  // Sort the bonded neighbors of each point by global ID, once; createRebalancedNeighborGlobalIDList() and
+  // createRebalancedNeighborhoodData() preserve the order of each point's neighbors, so the global ID
+  // lists handed to contactSearch() stay sorted through every rebalance
+  int* neighborhoodList = neighborhoodData->NeighborhoodList();
+  int neighborhoodListIndex = 0;
+  vector< pair<int, int> > neighbors;
+  for(int i=0 ; i<neighborhoodData->NumOwnedPoints() ; ++i){
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    neighbors.resize(numNeighbors);
+    for(int j=0 ; j<numNeighbors ; ++j){
+      int neighborLocalID = neighborhoodList[neighborhoodListIndex + j];
+      neighbors[j] = pair<int, int>(oneDimensionalOverlapContactMap->GID(neighborLocalID), neighborLocalID);
+    }
+    sort(neighbors.begin(), neighbors.end());
+    for(int j=0 ; j<numNeighbors ; ++j)
+      neighborhoodList[neighborhoodListIndex++] = neighbors[j].second;
+  }
+  if(neighborhoodData->HasCSR())
+    neighborhoodData->BuildCSR();
 }
 
 void PeridigmNS::ContactManager::initializeContactBlocks()
@@ -483,13 +535,98 @@ void PeridigmNS::ContactManager::exportData(Teuchos::RCP<Epetra_Vector> contactF
   contactForce->Export(*contactContactForce, *threeDimensionalMothershipToContactMothershipImporter, Insert);
 }
 
+void PeridigmNS::ContactManager::detectSurfacePoints()
+{
+  // the neighborhood volume of each point is the sum of the volumes of its bonded neighbors,
+  // as in Compute_Neighborhood_Volume, which requires the volumes of the ghosted points
+  Epetra_Vector overlapVolume(*oneDimensionalOverlapContactMap);
+  Epetra_Import overlapImporter(*oneDimensionalOverlapContactMap, *oneDimensionalContactMap);
+  overlapVolume.Import(*contactVolume, overlapImporter, Insert);
+
+  vector<double> neighborhoodVolume(oneDimensionalContactMap->NumMyElements(), 0.0);
+  const int* ownedIDs = neighborhoodData->OwnedIDs();
+  const int* neighborhoodList = neighborhoodData->NeighborhoodList();
+  int neighborhoodListIndex = 0;
+  for(int i=0 ; i<neighborhoodData->NumOwnedPoints() ; ++i){
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    double sum(0.0);
+    for(int j=0 ; j<numNeighbors ; ++j)
+      sum += overlapVolume[neighborhoodList[neighborhoodListIndex++]];
+    neighborhoodVolume[ownedIDs[i]] = sum;
+  }
+
+  // a point whose neighborhood is noticeably emptier than the fullest one in its block is truncated by the free surface
+  vector<int> blockIDs;
+  for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++)
+    blockIDs.push_back(contactBlockIt->getID());
+  vector<double> localMaxNeighborhoodVolume(blockIDs.size(), 0.0), maxNeighborhoodVolume(blockIDs.size(), 0.0);
+  vector<int> pointBlockIndex(neighborhoodVolume.size(), -1);
+  for(unsigned int i=0 ; i<neighborhoodVolume.size() ; ++i){
+    vector<int>::const_iterator it = find(blockIDs.begin(), blockIDs.end(), static_cast<int>((*contactBlockIDs)[i]));
+    if(it == blockIDs.end())
+      continue;
+    pointBlockIndex[i] = it - blockIDs.begin();
+    if(neighborhoodVolume[i] > localMaxNeighborhoodVolume[pointBlockIndex[i]])
+      localMaxNeighborhoodVolume[pointBlockIndex[i]] = neighborhoodVolume[i];
+  }
+  if(!blockIDs.empty())
+    oneDimensionalContactMap->Comm().MaxAll(&localMaxNeighborhoodVolume[0], &maxNeighborhoodVolume[0], blockIDs.size());
+
+  int localNumCandidates(0), numCandidates(0);
+  for(unsigned int i=0 ; i<neighborhoodVolume.size() ; ++i){
+    if(pointBlockIndex[i] == -1)
+      (*contactCandidates)[i] = 1.0;
+    else
+      (*contactCandidates)[i] = (neighborhoodVolume[i] < surfaceVolumeFraction*maxNeighborhoodVolume[pointBlockIndex[i]]) ? 1.0 : 0.0;
+    localNumCandidates += static_cast<int>((*contactCandidates)[i]);
+  }
+  oneDimensionalContactMap->Comm().SumAll(&localNumCandidates, &numCandidates, 1);
+  if(verbose && myPID == 0)
+    cout << "Contact search restricted to " << numCandidates << " surface points out of " << oneDimensionalContactMap->NumGlobalElements() << endl;
+}
+
+void PeridigmNS::ContactManager::updateContactCandidates(Teuchos::RCP<const Epetra_Vector> damage)
+{
+  if(!candidateSearch)
+    return;
+
+  Epetra_Vector contactDamage(*oneDimensionalContactMap);
+  contactDamage.Import(*damage, *oneDimensionalMothershipToContactMothershipImporter, Insert);
+  int localChanged(0), changed(0);
+  for(int i=0 ; i<contactDamage.MyLength() ; ++i){
+    if(contactDamage[i] > 0.0 && (*contactCandidates)[i] == 0.0){
+      (*contactCandidates)[i] = 1.0;
+      localChanged = 1;
+    }
+  }
+  oneDimensionalContactMap->Comm().MaxAll(&localChanged, &changed, 1);
+  if(changed)
+    candidatesChanged = true;
+}
+
 void PeridigmNS::ContactManager::rebalance(int step)
 {
   if( step%contactRebalanceFrequency != 0)
     return;
 
+  // the lists built with the inflated radius remain valid until some point has moved more than half the skin,
+  // at which point two approaching points may have closed the gap between the skin and the search radius;
+  // newly damaged points have to be added to the lists right away
+  if(verletSkin > 0.0 && !contactYAtLastSearch.is_null() && !candidatesChanged){
+    double maxDisplacement = maxDisplacementSinceLastSearch();
+    if(maxDisplacement <= 0.5*verletSkin)
+      return;
+    if(verbose && myPID == 0)
+      cout << "Contact search at step " << step << ", maximum displacement since the last search " << maxDisplacement
+           << " exceeds half the Verlet skin (" << numContactSearches << " searches so far)" << endl;
+  }
+
   const Epetra_Comm& comm = oneDimensionalMap->Comm();
 
+  // the surface is detected once, in the reference configuration
+  if(candidateSearch && numContactSearches == 0)
+    detectSurfacePoints();
+
   // \todo Handle serial case.  We don't need to rebalance, but we still want to update the contact search.
   QUICKGRID::Data rebalancedDecomp = currentConfigurationDecomp();
 
@@ -520,7 +657,12 @@ void PeridigmNS::ContactManager::rebalance(int step)
   // 3) keeps track of the additional off-processor IDs that need to be ghosted as a result of the contact search (offProcessorContactIDs)
   Teuchos::RCP< map<int, vector<int> > > contactNeighborGlobalIDs = Teuchos::rcp(new map<int, vector<int> >());
   Teuchos::RCP< set<int> > offProcessorContactIDs = Teuchos::rcp(new set<int>());
-  contactSearch(rebalancedOneDimensionalMap, rebalancedBondMap, rebalancedNeighborGlobalIDs, rebalancedDecomp, contactNeighborGlobalIDs, offProcessorContactIDs);
+  Teuchos::RCP<Epetra_Vector> rebalancedContactCandidates;
+  if(candidateSearch){
+    rebalancedContactCandidates = Teuchos::rcp(new Epetra_Vector(*rebalancedOneDimensionalMap));
+    rebalancedContactCandidates->Import(*contactCandidates, *oneDimensionalMapImporter, Insert);
+  }
+  contactSearch(rebalancedOneDimensionalMap, rebalancedBondMap, rebalancedNeighborGlobalIDs, rebalancedDecomp, rebalancedContactCandidates, contactNeighborGlobalIDs, offProcessorContactIDs);
 
   // add the off-processor IDs required for contact to the list of points that will be ghosted
   for(set<int>::const_iterator it=offProcessorContactIDs->begin() ; it!=offProcessorContactIDs->end() ; it++){
@@ -562,6 +704,7 @@ void PeridigmNS::ContactManager::rebalance(int step)
   oneDimensionalContactMothership = rebalancedOneDimensionalMothership;
   contactBlockIDs = Teuchos::rcp((*oneDimensionalContactMothership)(0), false);         // block ID
   contactVolume = Teuchos::rcp((*oneDimensionalContactMothership)(1), false);           // cell volume
+  contactCandidates = Teuchos::rcp((*oneDimensionalContactMothership)(2), false);       // contact candidate flag
 
   Teuchos::RCP<Epetra_MultiVector> rebalancedThreeDimensionalMothership = Teuchos::rcp(new Epetra_MultiVector(*rebalancedThreeDimensionalMap, threeDimensionalContactMothership->NumVectors()));
   rebalancedThreeDimensionalMothership->Import(*threeDimensionalContactMothership, *threeDimensionalMapImporter, Insert);
@@ -600,6 +743,32 @@ void PeridigmNS::ContactManager::rebalance(int step)
   // Reset the importers for passing data between the mothership and contact mothership vectors
   oneDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*oneDimensionalContactMap, *oneDimensionalMap));
   threeDimensionalMothershipToContactMothershipImporter = Teuchos::rcp(new Epetra_Import(*threeDimensionalContactMap, *threeDimensionalMap));
+
+  numContactSearches += 1;
+  candidatesChanged = false;
+  if(verletSkin > 0.0)
+    contactYAtLastSearch = Teuchos::rcp(new Epetra_Vector(*contactY));
+}
+
+double PeridigmNS::ContactManager::maxDisplacementSinceLastSearch() const
+{
+  // contactYAtLastSearch is defined on the contact map of the last search, which is still current
+  double* y;
+  double* yAtLastSearch;
+  contactY->ExtractView(&y);
+  contactYAtLastSearch->ExtractView(&yAtLastSearch);
+  double localMaxSquared(0.0);
+  for(int i=0 ; i<contactY->MyLength() ; i+=3){
+    double dx = y[i] - yAtLastSearch[i];
+    double dy = y[i+1] - yAtLastSearch[i+1];
+    double dz = y[i+2] - yAtLastSearch[i+2];
+    double distanceSquared = dx*dx + dy*dy + dz*dz;
+    if(distanceSquared > localMaxSquared)
+      localMaxSquared = distanceSquared;
+  }
+  double globalMaxSquared(0.0);
+  oneDimensionalMap->Comm().MaxAll(&localMaxSquared, &globalMaxSquared, 1);
+  return sqrt(globalMaxSquared);
 }
 
 QUICKGRID::Data PeridigmNS::ContactManager::currentConfigurationDecomp() {
@@ -635,6 +804,35 @@ QUICKGRID::Data PeridigmNS::ContactManager::currentConfigurationDecomp() {
   memcpy(cellVolumePtr, volumePtr, myNumElements*sizeof(double));
   decomp.cellVolume = cellVolume.get_shared_ptr();
 
+  // weight each point by its block cost factor times one plus its number of bonds and contact neighbors
+  if(weightedLoadBalance){
+    UTILITIES::Array<float> weights(myNumElements);
+    float* weightsPtr = weights.get();
+    for(int i=0 ; i<myNumElements ; ++i)
+      weightsPtr[i] = 1.0;
+    Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoods[2] = {neighborhoodData, contactNeighborhoodData};
+    for(int n=0 ; n<2 ; ++n){
+      const int* ownedIDs = neighborhoods[n]->OwnedIDs();
+      const int* neighborhoodList = neighborhoods[n]->NeighborhoodList();
+      int neighborhoodListIndex = 0;
+      for(int i=0 ; i<neighborhoods[n]->NumOwnedPoints() ; ++i){
+        int numNeighbors = neighborhoodList[neighborhoodListIndex];
+        weightsPtr[ownedIDs[i]] += numNeighbors;
+        neighborhoodListIndex += 1 + numNeighbors;
+      }
+    }
+    double myLoad(0.0);
+    for(int i=0 ; i<myNumElements ; ++i){
+      std::map<int, double>::const_iterator costFactor = blockCostFactors.find(static_cast<int>((*contactBlockIDs)[i]));
+      if(costFactor != blockCostFactors.end())
+        weightsPtr[i] *= costFactor->second;
+      myLoad += weightsPtr[i];
+    }
+    decomp.weights = weights.get_shared_ptr();
+    if(verbose)
+      PDNEIGH::printLoadImbalance("Contact rebalance (before)", myLoad, oneDimensionalContactMap->Comm());
+  }
+
   // call the rebalance function on the current-configuration decomp
   decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
 
@@ -697,6 +895,7 @@ void PeridigmNS::ContactManager::contactSearch(Teuchos::RCP<const Epetra_BlockMa
                                                Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
                                                Teuchos::RCP<const Epetra_Vector> rebalancedNeighborGlobalIDs,
                                                QUICKGRID::Data& rebalancedDecomp,
+                                               Teuchos::RCP<const Epetra_Vector> rebalancedContactCandidates,
                                                Teuchos::RCP< map<int, vector<int> > > contactNeighborGlobalIDs,
                                                Teuchos::RCP< set<int> > offProcessorContactIDs)
 {
@@ -705,32 +904,62 @@ void PeridigmNS::ContactManager::contactSearch(Teuchos::RCP<const Epetra_BlockMa
   std::shared_ptr<const Epetra_Comm> comm_shared_ptr(&comm,NonDeleter<const Epetra_Comm>());
   QUICKGRID::Data d = rebalancedDecomp;
 
+  // restrict the search to the contact candidates; every owned point still gets an (empty) contact neighbor list
+  size_t numSearchPoints = d.numPoints;
+  std::shared_ptr<int> searchPointGlobalIDs = d.myGlobalIDs;
+  std::shared_ptr<double> searchPointX = d.myX;
+  if(!rebalancedContactCandidates.is_null()){
+    for(int i=0 ; i<rebalancedOneDimensionalMap->NumMyElements() ; ++i)
+      (*contactNeighborGlobalIDs)[rebalancedOneDimensionalMap->GID(i)];
+    numSearchPoints = 0;
+    for(size_t iPt=0 ; iPt<d.numPoints ; ++iPt)
+      if((*rebalancedContactCandidates)[rebalancedOneDimensionalMap->LID(d.myGlobalIDs.get()[iPt])] != 0.0)
+        numSearchPoints += 1;
+    UTILITIES::Array<int> candidateGlobalIDs(numSearchPoints);
+    UTILITIES::Array<double> candidateX(3*numSearchPoints);
+    size_t index = 0;
+    for(size_t iPt=0 ; iPt<d.numPoints ; ++iPt){
+      int globalID = d.myGlobalIDs.get()[iPt];
+      if((*rebalancedContactCandidates)[rebalancedOneDimensionalMap->LID(globalID)] != 0.0){
+        candidateGlobalIDs[index] = globalID;
+        for(int dof=0 ; dof<3 ; ++dof)
+          candidateX[3*index+dof] = d.myX.get()[3*iPt+dof];
+        index += 1;
+      }
+    }
+    searchPointGlobalIDs = candidateGlobalIDs.get_shared_ptr();
+    searchPointX = candidateX.get_shared_ptr();
+  }
+
   // TEMPORARY PLACEHOLDER FOR PER-NODE SEARCH RADII
-  Teuchos::RCP<Epetra_Vector> contactSearchRadii = Teuchos::rcp(new Epetra_Vector(*rebalancedOneDimensionalMap));
-  contactSearchRadii->PutScalar(contactSearchRadius);
+  Epetra_BlockMap searchPointMap(-1, static_cast<int>(numSearchPoints), searchPointGlobalIDs.get(), 1, 0, comm);
+  Teuchos::RCP<Epetra_Vector> contactSearchRadii = Teuchos::rcp(new Epetra_Vector(searchPointMap));
+  contactSearchRadii->PutScalar(contactSearchRadius + verletSkin);
 
-  PDNEIGH::NeighborhoodList neighList(comm_shared_ptr,d.zoltanPtr.get(),d.numPoints,d.myGlobalIDs,d.myX,contactSearchRadii);
+  PDNEIGH::NeighborhoodList::SearchType searchType = cellListSearch ? PDNEIGH::NeighborhoodList::CELL_LIST : PDNEIGH::NeighborhoodList::ZOLTAN_TREE;
+  PDNEIGH::NeighborhoodList neighList(comm_shared_ptr,d.zoltanPtr.get(),numSearchPoints,searchPointGlobalIDs,searchPointX,contactSearchRadii,
+                                      std::vector< std::shared_ptr<PdBondFilter::BondFilter> >(),searchType);
 
   int* searchNeighborhood = neighList.get_neighborhood().get();
 
   int* searchGlobalIDs = neighList.get_owned_gids().get();
   int searchListIndex = 0;
-  for(size_t iPt=0 ; iPt<rebalancedDecomp.numPoints ; ++iPt){
+  double* neighborGlobalIDs;
+  rebalancedNeighborGlobalIDs->ExtractView(&neighborGlobalIDs);
+  const int* firstPointInElementList = rebalancedBondMap->FirstPointInElementList();
+  for(size_t iPt=0 ; iPt<numSearchPoints ; ++iPt){
 
     int globalID = searchGlobalIDs[iPt];
     vector<int>& contactNeighborGlobalIDList = (*contactNeighborGlobalIDs)[globalID];
 
-    // create a list of global IDs that this point is bonded to
-    set<int> bondedNeighbors;
+    // the global IDs that this point is bonded to, sorted in loadNeighborhoodData()
+    const double* bondedNeighbors = neighborGlobalIDs;
+    const double* bondedNeighborsEnd = neighborGlobalIDs;
     int tempLocalID = rebalancedBondMap->LID(globalID);
     // if there is no entry in rebalancedBondMap, then there are no bonded neighbors for this point
     if(tempLocalID != -1){
-      int firstNeighbor = rebalancedBondMap->FirstPointInElementList()[tempLocalID];
-      int numNeighbors = rebalancedBondMap->ElementSize(tempLocalID);
-      for(int i=0 ; i<numNeighbors ; ++i){
-        int neighborGlobalID = (int)( (*rebalancedNeighborGlobalIDs)[firstNeighbor + i] );
-        bondedNeighbors.insert(neighborGlobalID);
-      }
+      bondedNeighbors = neighborGlobalIDs + firstPointInElementList[tempLocalID];
+      bondedNeighborsEnd = bondedNeighbors + rebalancedBondMap->ElementSize(tempLocalID);
     }
 
     // loop over the neighbors found by the contact search
@@ -738,8 +967,8 @@ void PeridigmNS::ContactManager::contactSearch(Teuchos::RCP<const Epetra_BlockMa
     int searchNumNeighbors = searchNeighborhood[searchListIndex++];
     for(int iNeighbor=0 ; iNeighbor<searchNumNeighbors ; ++iNeighbor){
       int globalNeighborID = searchNeighborhood[searchListIndex++];
-      set<int>::iterator it = bondedNeighbors.find(globalNeighborID);  // \todo Don't consider broken bonds here
-      if(it == bondedNeighbors.end()){
+      // \todo Don't consider broken bonds here
+      if(!binary_search(bondedNeighbors, bondedNeighborsEnd, static_cast<double>(globalNeighborID))){
         contactNeighborGlobalIDList.push_back(globalNeighborID);
         if(rebalancedOneDimensionalMap->LID(globalNeighborID) == -1)
           offProcessorContactIDs->insert(globalNeighborID);
@@ -867,6 +1096,9 @@ Teuchos::RCP<PeridigmNS::NeighborhoodData> PeridigmNS::ContactManager::createReb
 
 void PeridigmNS::ContactManager::evaluateContactForce(double dt)
 {
+  PeridigmNS::Timer& timer = PeridigmNS::Timer::self();
+  const bool timeBlocks = timer.detailedTiming();
+
   for(contactBlockIt = contactBlocks->begin() ; contactBlockIt != contactBlocks->end() ; contactBlockIt++){
 
     Teuchos::RCP<PeridigmNS::NeighborhoodData> nData = contactBlockIt->getNeighborhoodData();
@@ -876,11 +1108,44 @@ void PeridigmNS::ContactManager::evaluateContactForce(double dt)
     Teuchos::RCP<PeridigmNS::DataManager> dataManager = contactBlockIt->getDataManager();
     Teuchos::RCP<const PeridigmNS::ContactModel> contactModel = contactBlockIt->getContactModel();
 
-    if(!contactModel.is_null())
+    if(!contactModel.is_null()){
+      if(timeBlocks)
+        timer.startTimer(contactBlockIt->getTimerId(PeridigmNS::BlockBase::CONTACT_TIMER));
       contactModel->computeForce(dt, 
                                  numOwnedPoints,
                                  ownedIDs,
                                  neighborhoodList,
                                  *dataManager);
+      if(timeBlocks)
+        timer.stopTimer(contactBlockIt->getTimerId(PeridigmNS::BlockBase::CONTACT_TIMER));
+    }
+  }
+}
+
+double PeridigmNS::ContactManager::memorySize()
+{
+  double sizeInBytes = 0.0;
+  if(!threeDimensionalContactMothership.is_null())
+    sizeInBytes += static_cast<double>(threeDimensionalContactMothership->MyLength())*threeDimensionalContactMothership->NumVectors()*sizeof(double);
+  if(!oneDimensionalContactMothership.is_null())
+    sizeInBytes += static_cast<double>(oneDimensionalContactMothership->MyLength())*oneDimensionalContactMothership->NumVectors()*sizeof(double);
+  if(!contactYAtLastSearch.is_null())
+    sizeInBytes += static_cast<double>(contactYAtLastSearch->MyLength())*sizeof(double);
+
+  double sizeInMegabytes = sizeInBytes/1048576.0;
+  if(!neighborhoodData.is_null())
+    sizeInMegabytes += neighborhoodData->memorySize();
+  if(!contactNeighborhoodData.is_null())
+    sizeInMegabytes += contactNeighborhoodData->memorySize();
+  if(!contactBlocks.is_null()){
+    for(std::vector<PeridigmNS::ContactBlock>::iterator it = contactBlocks->begin() ; it != contactBlocks->end() ; it++){
+      Teuchos::RCP<PeridigmNS::NeighborhoodData> nData = it->getNeighborhoodData();
+      if(!nData.is_null())
+        sizeInMegabytes += nData->memorySize();
+      Teuchos::RCP<PeridigmNS::DataManager> dataManager = it->getDataManager();
+      if(!dataManager.is_null())
+        sizeInMegabytes += dataManager->pointDataMemorySize() + dataManager->bondDataMemorySize();
+    }
   }
+  return sizeInMegabytes;
 }
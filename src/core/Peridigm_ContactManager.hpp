@@ -124,10 +124,23 @@ class ContactManager {
         return contactBlocks;
     };
 
+    //! Returns true if the contact search is restricted to surface and damaged points
+    bool restrictsSearchToCandidates() const { return candidateSearch; }
+
+    //! Interval, in steps, at which the need for a new contact search is checked
+    int getSearchFrequency() const { return contactRebalanceFrequency; }
+
+    //! Add points with nonzero damage (a vector on the global one-dimensional map) to the contact candidates (collective)
+    void updateContactCandidates(Teuchos::RCP<const Epetra_Vector> damage);
+
+    //! Repartition and rebuild the contact neighbor lists; with a Verlet skin, this is skipped until a point has moved more than half the skin.
     void rebalance(int step);
 
     void evaluateContactForce(double dt);
 
+    //! Returns the memory used by the contact vectors, neighbor lists, and contact blocks on this processor, in megabytes
+    double memorySize();
+
     //! Destructor.
     ~ContactManager() {}
 
@@ -145,6 +158,12 @@ class ContactManager {
     //! Compute a parallel decomposion based on the current configuration
     QUICKGRID::Data currentConfigurationDecomp();
 
+    //! Flag the points on the free surface, based on the volume of their neighborhood relative to the fullest neighborhood in their block
+    void detectSurfacePoints();
+
+    //! Largest displacement of any point since the last contact search (collective)
+    double maxDisplacementSinceLastSearch() const;
+
     //! Create a rebalanced bond map
     Teuchos::RCP<Epetra_BlockMap> createRebalancedBondMap(
         Teuchos::RCP<Epetra_BlockMap> rebalancedOneDimensionalMap,
@@ -170,6 +189,7 @@ class ContactManager {
         Teuchos::RCP<const Epetra_BlockMap> rebalancedBondMap,
         Teuchos::RCP<const Epetra_Vector> rebalancedNeighborGlobalIDs,
         QUICKGRID::Data& rebalancedDecomp,
+        Teuchos::RCP<const Epetra_Vector> rebalancedContactCandidates,
         Teuchos::RCP<std::map<int, std::vector<int> > >
             contactNeighborGlobalIDs,
         Teuchos::RCP<std::set<int> > offProcessorContactIDs);
@@ -216,6 +236,33 @@ class ContactManager {
     //! Contact search radius
     double contactSearchRadius;
 
+    //! Flag for searching with a uniform-grid cell list rather than a tree
+    bool cellListSearch;
+
+    //! Flag for restricting the contact search to surface and damaged points
+    bool candidateSearch;
+
+    //! Neighborhood volume, relative to the fullest neighborhood in the block, below which a point is on the surface
+    double surfaceVolumeFraction;
+
+    //! Flag indicating that points were added to the contact candidates since the last contact search
+    bool candidatesChanged;
+
+    //! Verlet skin added to the contact search radius; zero disables displacement-triggered searches
+    double verletSkin;
+
+    //! Number of contact searches performed
+    int numContactSearches;
+
+    //! Current positions at the last contact search, used to measure the displacement against the Verlet skin
+    Teuchos::RCP<Epetra_Vector> contactYAtLastSearch;
+
+    //! Flag for weighting each point by its bonds, contact neighbors, and block cost factor when rebalancing
+    bool weightedLoadBalance;
+
+    //! Relative cost of a point in each block for weighted load balancing, keyed by block ID
+    std::map<int, double> blockCostFactors;
+
     //! Contact models
     std::map<std::string, Teuchos::RCP<const PeridigmNS::ContactModel> >
         contactModels;
@@ -236,6 +283,9 @@ class ContactManager {
     //! Global contact vector for volume
     Teuchos::RCP<Epetra_Vector> contactVolume;
 
+    //! Global contact vector flagging the points that take part in the contact search (one) or not (zero)
+    Teuchos::RCP<Epetra_Vector> contactCandidates;
+
     //! Global contact vector for current position
     Teuchos::RCP<Epetra_Vector> contactY;
 
@@ -50,13 +50,13 @@
 #include "Peridigm_Field.hpp"
 #include "Peridigm_Constants.hpp"
 #include <cmath>
+#include <algorithm>
 
-double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block){
+double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block, bool useCurrentConfiguration){
 
   Teuchos::RCP<PeridigmNS::NeighborhoodData> neighborhoodData = block.getNeighborhoodData();
   const int numOwnedPoints = neighborhoodData->NumOwnedPoints();
   const int* ownedIDs = neighborhoodData->OwnedIDs();
-  const int* neighborhoodList = neighborhoodData->NeighborhoodList();
   Teuchos::RCP<const PeridigmNS::Material> materialModel = block.getMaterialModel();
 
   double density = materialModel()->Density();
@@ -74,6 +74,20 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
   block.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
   block.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE)->ExtractView(&x);
 
+  // Current coordinates and bond damage, if requested and available
+  double *y(0), *bondDamage(0);
+  if(useCurrentConfiguration){
+    int coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+    if(block.hasData(coordinatesFieldId, PeridigmField::STEP_N))
+      block.getData(coordinatesFieldId, PeridigmField::STEP_N)->ExtractView(&y);
+    if(fieldManager.hasField("Bond_Damage")){
+      int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+      if(block.hasData(bondDamageFieldId, PeridigmField::STEP_N))
+        block.getData(bondDamageFieldId, PeridigmField::STEP_N)->ExtractView(&bondDamage);
+    }
+  }
+  int bondIndex = 0;
+
   const double pi = value_of_pi();
   double springConstant(0.0);
   if(blockHasConstantHorizon)
@@ -81,21 +95,20 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
 
   double minCriticalTimeStep = 1.0e50;
 
-  int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
 
     double timestepDenominator = 0.0;
     int nodeID = ownedIDs[iID];
     double X[3] = { x[nodeID*3], x[nodeID*3+1], x[nodeID*3+2] };
-    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    PeridigmNS::NeighborRange neighbors = neighborhoodData->Neighbors(iID);
+    int numNeighbors = neighbors.size();
 
     if(!blockHasConstantHorizon){
       double delta = horizonManager.evaluateHorizon(blockName, X[0], X[1], X[2]);
       springConstant = 18.0*bulkModulus/(pi*delta*delta*delta*delta);
     }
 
-    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
-      int neighborID = neighborhoodList[neighborhoodListIndex++];
+    for(int neighborID : neighbors){
       double neighborVolume = cellVolume[neighborID];
       double initialDistance = std::sqrt( (X[0] - x[neighborID*3  ])*(X[0] - x[neighborID*3  ]) +
                                           (X[1] - x[neighborID*3+1])*(X[1] - x[neighborID*3+1]) +
@@ -109,11 +122,24 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
         warningGiven = true;
       }
 
-      timestepDenominator += neighborVolume*springConstant/initialDistance;
+      double bondLength = initialDistance;
+      if(y != 0){
+        double currentDistance = std::sqrt( (y[nodeID*3  ] - y[neighborID*3  ])*(y[nodeID*3  ] - y[neighborID*3  ]) +
+                                            (y[nodeID*3+1] - y[neighborID*3+1])*(y[nodeID*3+1] - y[neighborID*3+1]) +
+                                            (y[nodeID*3+2] - y[neighborID*3+2])*(y[nodeID*3+2] - y[neighborID*3+2]) );
+        if(currentDistance > 0.0 && currentDistance < bondLength)
+          bondLength = currentDistance;
+      }
+      double bondStiffness = springConstant/bondLength;
+      if(bondDamage != 0)
+        bondStiffness *= (1.0 - bondDamage[bondIndex]);
+      bondIndex += 1;
+
+      timestepDenominator += neighborVolume*bondStiffness;
     }
 
     double criticalTimeStep = 1.0e50;
-    if(numNeighbors > 0)
+    if(numNeighbors > 0 && timestepDenominator > 0.0)
       criticalTimeStep = sqrt(2.0*density/timestepDenominator);
     if(criticalTimeStep < minCriticalTimeStep)
       minCriticalTimeStep = criticalTimeStep;
@@ -125,3 +151,13 @@ double PeridigmNS::ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::
 
   return globalMinCriticalTimeStep;
 }
+
+double PeridigmNS::AdaptiveTimeStep(double criticalTimeStep,
+                                    double safetyFactor,
+                                    double previousTimeStep,
+                                    double maximumGrowthFactor,
+                                    double minimumTimeStep,
+                                    double maximumTimeStep){
+  double timeStep = std::min(safetyFactor*criticalTimeStep, maximumGrowthFactor*previousTimeStep);
+  return std::min(std::max(timeStep, minimumTimeStep), maximumTimeStep);
+}
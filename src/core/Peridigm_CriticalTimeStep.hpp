@@ -53,7 +53,25 @@
 
 namespace PeridigmNS {
 
-double ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block);
+/*! \brief Estimates the stable time step for explicit time integration of the given block.
+ *
+ *  By default the estimate is based on the reference configuration.  If useCurrentConfiguration is true,
+ *  the stiffness of each bond is scaled by (1 - bond damage), and is based on the shorter of its reference
+ *  and current (STEP_N) lengths, so that broken bonds relax the estimate and compressed bonds tighten it.
+ */
+double ComputeCriticalTimeStep(const Epetra_Comm& comm, PeridigmNS::Block& block, bool useCurrentConfiguration = false);
+
+/*! \brief Returns the next time step for adaptive time stepping.
+ *
+ *  The time step is safetyFactor times the critical time step, limited to maximumGrowthFactor times the
+ *  previous time step and then clamped to [minimumTimeStep, maximumTimeStep].
+ */
+double AdaptiveTimeStep(double criticalTimeStep,
+                        double safetyFactor,
+                        double previousTimeStep,
+                        double maximumGrowthFactor,
+                        double minimumTimeStep,
+                        double maximumTimeStep);
 
 }
 
@@ -117,7 +117,8 @@ void PeridigmNS::DataManager::allocateData(vector<int> fieldIds)
       TEUCHOS_TEST_FOR_EXCEPTION(length != PeridigmField::SCALAR, Teuchos::RangeError, 
                                  "PeridigmNS::DataManager::allocateData, invalid FieldSpec, BOND data must be SCALAR!");
 
-      if(temporal == PeridigmField::CONSTANT)
+      // Fields with single-precision step N values keep their double-precision (step NP1) values in stateNONE
+      if(temporal == PeridigmField::CONSTANT || hasSinglePrecisionData(fieldId))
         statelessBondFieldIds.push_back(fieldId);
 
       else if(temporal == PeridigmField::TWO_STEP)
@@ -271,6 +272,8 @@ void PeridigmNS::DataManager::allocateData(vector<int> fieldIds)
       stateNP1->allocateBondData(statefulBondFieldIds, ownedBondMap);
     }
   }
+  for(std::map< pair<int, PeridigmField::Step>, vector<float> >::iterator it = singlePrecisionData.begin() ; it != singlePrecisionData.end() ; ++it)
+    it->second.assign(ownedBondMap->NumMyPoints(), 0.0f);
 }
 
 void PeridigmNS::DataManager::scatterToGhosts()
@@ -461,7 +464,20 @@ void PeridigmNS::DataManager::rebalance(Teuchos::RCP<const Epetra_BlockMap> reba
   overlapScalarPointMap = rebalancedOverlapScalarPointMap;
   ownedVectorPointMap = rebalancedOwnedVectorPointMap;
   overlapVectorPointMap = rebalancedOverlapVectorPointMap;
+
+  // Import the single-precision step N values through a temporary double-precision multivector
+  if(hasSinglePrecisionData()){
+    Teuchos::RCP<Epetra_MultiVector> singlePrecisionMultiVector = getSinglePrecisionMultiVector();
+    Epetra_MultiVector rebalancedSinglePrecisionMultiVector(*rebalancedOwnedBondMap, singlePrecisionMultiVector->NumVectors());
+    Epetra_Import importer(*rebalancedOwnedBondMap, *ownedBondMap);
+    rebalancedSinglePrecisionMultiVector.Import(*singlePrecisionMultiVector, importer, Insert);
+    setSinglePrecisionMultiVector(rebalancedSinglePrecisionMultiVector);
+  }
+
   ownedBondMap = rebalancedOwnedBondMap;
+
+  // The overlap points have changed, so the structure-of-arrays copies are rebuilt
+  synchronizeStructureOfArraysData();
 }
 
 Teuchos::RCP<const Epetra_Comm> PeridigmNS::DataManager::getEpetraComm()
@@ -508,6 +524,23 @@ void PeridigmNS::DataManager::copyLocallyOwnedDataFromDataManager(PeridigmNS::Da
   else{
     TEUCHOS_TEST_FOR_EXCEPTION(!source.getStateNP1().is_null(), Teuchos::NullReferenceError, "PeridigmNS::State::copyLocallyOwnedDataFromDataManager() called with incompatible source and target.\n");
   }
+
+  // The single-precision step N values are copied based on global IDs, as in State::copyLocallyOwnedDataFromState()
+  for(std::map< pair<int, PeridigmField::Step>, vector<float> >::iterator it = singlePrecisionData.begin() ; it != singlePrecisionData.end() ; ++it){
+    TEUCHOS_TEST_FOR_EXCEPTION(!source.hasSinglePrecisionData(it->first.first), Teuchos::NullReferenceError, "PeridigmNS::State::copyLocallyOwnedDataFromDataManager() called with incompatible source and target.\n");
+    const vector<float>& sourceData = source.singlePrecisionData[it->first];
+    for(int targetLID=0 ; targetLID<ownedBondMap->NumMyElements() ; ++targetLID){
+      int sourceLID = source.ownedBondMap->LID(ownedBondMap->GID(targetLID));
+      TEUCHOS_TEST_FOR_EXCEPTION(sourceLID == -1 || source.ownedBondMap->ElementSize(sourceLID) != ownedBondMap->ElementSize(targetLID), Teuchos::RangeError,
+                                 "PeridigmNS::State::copyLocallyOwnedDataFromDataManager() called with incompatible source and target.\n");
+      int sourceFirstPointInElement = source.ownedBondMap->FirstPointInElement(sourceLID);
+      int targetFirstPointInElement = ownedBondMap->FirstPointInElement(targetLID);
+      for(int i=0 ; i<ownedBondMap->ElementSize(targetLID) ; ++i)
+        it->second[targetFirstPointInElement+i] = sourceData[sourceFirstPointInElement+i];
+    }
+  }
+
+  synchronizeStructureOfArraysData();
 }
 
 bool PeridigmNS::DataManager::hasData(int fieldId, PeridigmField::Step step)
@@ -519,10 +552,13 @@ bool PeridigmNS::DataManager::hasData(int fieldId, PeridigmField::Step step)
     hasData = stateNONE->hasData(fieldId);
   }
   else if(step == PeridigmField::STEP_N){
-    hasData = stateN->hasData(fieldId);
+    hasData = !stateN.is_null() && stateN->hasData(fieldId);
   }
   else if(step == PeridigmField::STEP_NP1){
-    hasData = stateNP1->hasData(fieldId);
+    if(hasSinglePrecisionData(fieldId))
+      hasData = true;
+    else
+      hasData = !stateNP1.is_null() && stateNP1->hasData(fieldId);
   }
   else{
     TEUCHOS_TEST_FOR_EXCEPTION(false, Teuchos::RangeError,
@@ -550,10 +586,19 @@ Teuchos::RCP<Epetra_Vector> PeridigmNS::DataManager::getData(int fieldId, Peridi
       data = stateNONE->getData(fieldId);
     }
     else if(step == PeridigmField::STEP_N){
+      if(hasSinglePrecisionData(fieldId)){
+        stringstream ss;
+        ss << "**** Error, PeridigmNS::DataManager::getData(), step N values are stored in single precision, use copySinglePrecisionDataToField()!\n";
+        ss << "**** Spec: " << fieldManager.getFieldSpec(fieldId) << "\n";
+        TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::RangeError, ss.str());
+      }
       data = stateN->getData(fieldId);
     }
     else if(step == PeridigmField::STEP_NP1){
-      data = stateNP1->getData(fieldId);
+      if(hasSinglePrecisionData(fieldId))
+        data = stateNONE->getData(fieldId);
+      else
+        data = stateNP1->getData(fieldId);
     }
     else{
       TEUCHOS_TEST_FOR_EXCEPTION(false, Teuchos::RangeError, 
@@ -571,3 +616,193 @@ Teuchos::RCP<Epetra_Vector> PeridigmNS::DataManager::getData(int fieldId, Peridi
 
   return data;
 }
+
+void PeridigmNS::DataManager::setStructureOfArraysFieldIds(vector<int> fieldIds)
+{
+  structureOfArraysData.clear();
+  for(unsigned int i=0 ; i<fieldIds.size() ; ++i){
+    int fieldId = fieldIds[i];
+    if(find(allFieldIds.begin(), allFieldIds.end(), fieldId) == allFieldIds.end() || fieldManager.isGlobalSpec(fieldId))
+      continue;
+    PeridigmNS::FieldSpec spec = fieldManager.getFieldSpec(fieldId);
+    if(spec.getLength() != PeridigmField::VECTOR || spec.getRelation() == PeridigmField::BOND)
+      continue;
+    vector<PeridigmField::Step> steps;
+    if(spec.getTemporal() == PeridigmField::CONSTANT){
+      steps.push_back(PeridigmField::STEP_NONE);
+    }
+    else{
+      steps.push_back(PeridigmField::STEP_N);
+      steps.push_back(PeridigmField::STEP_NP1);
+    }
+    for(unsigned int iStep=0 ; iStep<steps.size() ; ++iStep){
+      structureOfArraysData[pair<int, PeridigmField::Step>(fieldId, steps[iStep])];
+      synchronizeStructureOfArraysData(fieldId, steps[iStep]);
+    }
+  }
+}
+
+bool PeridigmNS::DataManager::hasStructureOfArraysData(int fieldId, PeridigmField::Step step) const
+{
+  return structureOfArraysData.find( pair<int, PeridigmField::Step>(fieldId, step) ) != structureOfArraysData.end();
+}
+
+double* PeridigmNS::DataManager::getStructureOfArraysData(int fieldId, PeridigmField::Step step)
+{
+  std::map< pair<int, PeridigmField::Step>, vector<double> >::iterator it = structureOfArraysData.find( pair<int, PeridigmField::Step>(fieldId, step) );
+  TEUCHOS_TEST_FOR_EXCEPTION(it == structureOfArraysData.end(), Teuchos::RangeError,
+                             "**** Error, PeridigmNS::DataManager::getStructureOfArraysData(), no structure-of-arrays copy for fieldId and Step!\n");
+  return it->second.empty() ? 0 : &it->second[0];
+}
+
+void PeridigmNS::DataManager::synchronizeStructureOfArraysData(int fieldId, PeridigmField::Step step)
+{
+  std::map< pair<int, PeridigmField::Step>, vector<double> >::iterator it = structureOfArraysData.find( pair<int, PeridigmField::Step>(fieldId, step) );
+  if(it == structureOfArraysData.end())
+    return;
+
+  const Epetra_Vector& field = *getData(fieldId, step);
+  int numPoints = field.MyLength()/3;
+  vector<double>& soa = it->second;
+  soa.resize(3*numPoints);
+  for(int i=0 ; i<numPoints ; ++i){
+    soa[i]               = field[3*i];
+    soa[numPoints + i]   = field[3*i+1];
+    soa[2*numPoints + i] = field[3*i+2];
+  }
+}
+
+void PeridigmNS::DataManager::synchronizeStructureOfArraysData()
+{
+  std::map< pair<int, PeridigmField::Step>, vector<double> >::iterator it;
+  for(it = structureOfArraysData.begin() ; it != structureOfArraysData.end() ; ++it)
+    synchronizeStructureOfArraysData(it->first.first, it->first.second);
+}
+
+void PeridigmNS::DataManager::copyStructureOfArraysDataToField(int fieldId, PeridigmField::Step step)
+{
+  std::map< pair<int, PeridigmField::Step>, vector<double> >::iterator it = structureOfArraysData.find( pair<int, PeridigmField::Step>(fieldId, step) );
+  TEUCHOS_TEST_FOR_EXCEPTION(it == structureOfArraysData.end(), Teuchos::RangeError,
+                             "**** Error, PeridigmNS::DataManager::copyStructureOfArraysDataToField(), no structure-of-arrays copy for fieldId and Step!\n");
+
+  Epetra_Vector& field = *getData(fieldId, step);
+  int numPoints = field.MyLength()/3;
+  const vector<double>& soa = it->second;
+  TEUCHOS_TEST_FOR_EXCEPTION(static_cast<int>(soa.size()) != 3*numPoints, Teuchos::RangeError,
+                             "**** Error, PeridigmNS::DataManager::copyStructureOfArraysDataToField(), structure-of-arrays copy is out of date!\n");
+  for(int i=0 ; i<numPoints ; ++i){
+    field[3*i]   = soa[i];
+    field[3*i+1] = soa[numPoints + i];
+    field[3*i+2] = soa[2*numPoints + i];
+  }
+}
+
+void PeridigmNS::DataManager::setSinglePrecisionFieldIds(vector<int> fieldIds)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(!allFieldIds.empty(), Teuchos::RangeError,
+                             "**** Error, PeridigmNS::DataManager::setSinglePrecisionFieldIds() must be called prior to allocateData()!\n");
+  singlePrecisionData.clear();
+  for(unsigned int i=0 ; i<fieldIds.size() ; ++i){
+    PeridigmNS::FieldSpec spec = fieldManager.getFieldSpec(fieldIds[i]);
+    if(spec.getRelation() == PeridigmField::BOND && spec.getTemporal() == PeridigmField::TWO_STEP)
+      singlePrecisionData[pair<int, PeridigmField::Step>(fieldIds[i], PeridigmField::STEP_N)];
+  }
+}
+
+bool PeridigmNS::DataManager::hasSinglePrecisionData(int fieldId) const
+{
+  return singlePrecisionData.find( pair<int, PeridigmField::Step>(fieldId, PeridigmField::STEP_N) ) != singlePrecisionData.end();
+}
+
+const float* PeridigmNS::DataManager::getSinglePrecisionData(int fieldId) const
+{
+  std::map< pair<int, PeridigmField::Step>, vector<float> >::const_iterator it = singlePrecisionData.find( pair<int, PeridigmField::Step>(fieldId, PeridigmField::STEP_N) );
+  TEUCHOS_TEST_FOR_EXCEPTION(it == singlePrecisionData.end(), Teuchos::RangeError,
+                             "**** Error, PeridigmNS::DataManager::getSinglePrecisionData(), no single-precision data for fieldId!\n");
+  return it->second.empty() ? 0 : &it->second[0];
+}
+
+void PeridigmNS::DataManager::copySinglePrecisionDataToField(int fieldId)
+{
+  std::map< pair<int, PeridigmField::Step>, vector<float> >::const_iterator it = singlePrecisionData.find( pair<int, PeridigmField::Step>(fieldId, PeridigmField::STEP_N) );
+  TEUCHOS_TEST_FOR_EXCEPTION(it == singlePrecisionData.end(), Teuchos::RangeError,
+                             "**** Error, PeridigmNS::DataManager::copySinglePrecisionDataToField(), no single-precision data for fieldId!\n");
+
+  double* field;
+  stateNONE->getData(fieldId)->ExtractView(&field);
+  const vector<float>& singlePrecision = it->second;
+  for(unsigned int i=0 ; i<singlePrecision.size() ; ++i)
+    field[i] = singlePrecision[i];
+}
+
+void PeridigmNS::DataManager::copyFieldToSinglePrecisionData(int fieldId)
+{
+  std::map< pair<int, PeridigmField::Step>, vector<float> >::iterator it = singlePrecisionData.find( pair<int, PeridigmField::Step>(fieldId, PeridigmField::STEP_N) );
+  TEUCHOS_TEST_FOR_EXCEPTION(it == singlePrecisionData.end(), Teuchos::RangeError,
+                             "**** Error, PeridigmNS::DataManager::copyFieldToSinglePrecisionData(), no single-precision data for fieldId!\n");
+
+  double* field;
+  stateNONE->getData(fieldId)->ExtractView(&field);
+  vector<float>& singlePrecision = it->second;
+  for(unsigned int i=0 ; i<singlePrecision.size() ; ++i)
+    singlePrecision[i] = static_cast<float>(field[i]);
+}
+
+Teuchos::RCP<Epetra_MultiVector> PeridigmNS::DataManager::getSinglePrecisionMultiVector() const
+{
+  Teuchos::RCP<Epetra_MultiVector> multiVector = Teuchos::rcp(new Epetra_MultiVector(*ownedBondMap, static_cast<int>(singlePrecisionData.size())));
+  int iVec = 0;
+  for(std::map< pair<int, PeridigmField::Step>, vector<float> >::const_iterator it = singlePrecisionData.begin() ; it != singlePrecisionData.end() ; ++it, ++iVec){
+    double* column = (*multiVector)[iVec];
+    for(unsigned int i=0 ; i<it->second.size() ; ++i)
+      column[i] = it->second[i];
+  }
+  return multiVector;
+}
+
+void PeridigmNS::DataManager::setSinglePrecisionMultiVector(const Epetra_MultiVector& multiVector)
+{
+  int iVec = 0;
+  for(std::map< pair<int, PeridigmField::Step>, vector<float> >::iterator it = singlePrecisionData.begin() ; it != singlePrecisionData.end() ; ++it, ++iVec){
+    const double* column = multiVector[iVec];
+    it->second.resize(multiVector.MyLength());
+    for(int i=0 ; i<multiVector.MyLength() ; ++i)
+      it->second[i] = static_cast<float>(column[i]);
+  }
+}
+
+double PeridigmNS::DataManager::pointDataMemorySize() const
+{
+  double sizeInMegabytes = 0.0;
+  if(!stateN.is_null())
+    sizeInMegabytes += stateN->pointDataMemorySize();
+  if(!stateNP1.is_null())
+    sizeInMegabytes += stateNP1->pointDataMemorySize();
+  if(!stateNONE.is_null())
+    sizeInMegabytes += stateNONE->pointDataMemorySize();
+  for(std::map< std::pair<int, PeridigmField::Step>, std::vector<double> >::const_iterator it = structureOfArraysData.begin() ; it != structureOfArraysData.end() ; ++it)
+    sizeInMegabytes += it->second.capacity()*sizeof(double)/1048576.0;
+  return sizeInMegabytes;
+}
+
+double PeridigmNS::DataManager::bondDataMemorySize() const
+{
+  double sizeInMegabytes = 0.0;
+  if(!stateN.is_null())
+    sizeInMegabytes += stateN->bondDataMemorySize();
+  if(!stateNP1.is_null())
+    sizeInMegabytes += stateNP1->bondDataMemorySize();
+  if(!stateNONE.is_null())
+    sizeInMegabytes += stateNONE->bondDataMemorySize();
+  for(std::map< std::pair<int, PeridigmField::Step>, std::vector<float> >::const_iterator it = singlePrecisionData.begin() ; it != singlePrecisionData.end() ; ++it)
+    sizeInMegabytes += it->second.capacity()*sizeof(float)/1048576.0;
+  return sizeInMegabytes;
+}
+
+double PeridigmNS::DataManager::singlePrecisionMemorySaving() const
+{
+  double sizeInMegabytes = 0.0;
+  for(std::map< std::pair<int, PeridigmField::Step>, std::vector<float> >::const_iterator it = singlePrecisionData.begin() ; it != singlePrecisionData.end() ; ++it)
+    sizeInMegabytes += it->second.size()*(sizeof(double) - sizeof(float))/1048576.0;
+  return sizeInMegabytes;
+}
@@ -155,6 +155,66 @@ public:
   //! Returns the complete list of field ids.
   std::vector<int> getFieldIds() { return allFieldIds; }
 
+  /*! \brief Keeps structure-of-arrays copies of the given vector point fields, must be called after allocateData().
+   *
+   *  Field ids that are not allocated as vector point data are ignored.
+   */
+  void setStructureOfArraysFieldIds(std::vector<int> fieldIds);
+
+  //! Query the existence of a structure-of-arrays copy of a particular field Id at a particular step.
+  bool hasStructureOfArraysData(int fieldId, PeridigmField::Step step) const;
+
+  /*! \brief Provides access to the structure-of-arrays copy of a vector point field.
+   *
+   *  The x, y, and z components of overlap point i are stored at [i], [n+i], and [2n+i], where n is the number of
+   *  overlap points.  The copy is refreshed by BlockBase::importData(), by rebalance(), and by
+   *  synchronizeStructureOfArraysData(); code that writes the Epetra_Vector directly must call
+   *  synchronizeStructureOfArraysData() before the copy is read.
+   */
+  double* getStructureOfArraysData(int fieldId, PeridigmField::Step step);
+
+  //! Copies a vector point field into its structure-of-arrays copy; a no-op if the field has no such copy.
+  void synchronizeStructureOfArraysData(int fieldId, PeridigmField::Step step);
+
+  //! Copies all vector point fields that have structure-of-arrays copies into those copies.
+  void synchronizeStructureOfArraysData();
+
+  //! Copies the structure-of-arrays copy back into the vector point field, for kernels that write results in that layout.
+  void copyStructureOfArraysDataToField(int fieldId, PeridigmField::Step step);
+
+  /*! \brief Stores the step N values of the given two-step bond fields in single precision, must be called prior to allocateData().
+   *
+   *  Only the step NP1 values of these fields are kept in double precision, so each field takes 12 rather than 16
+   *  bytes per bond.  The step N values are not available through getData(); a kernel that advances such a field
+   *  calls copySinglePrecisionDataToField() and then updates the step NP1 values in place.  updateState() rounds the
+   *  step NP1 values into the single-precision store.  Field ids that are not two-step bond fields are ignored.
+   */
+  void setSinglePrecisionFieldIds(std::vector<int> fieldIds);
+
+  //! Query whether the step N values of a particular field Id are stored in single precision.
+  bool hasSinglePrecisionData(int fieldId) const;
+
+  //! Returns true if the step N values of any field are stored in single precision.
+  bool hasSinglePrecisionData() const { return !singlePrecisionData.empty(); }
+
+  //! Returns the single-precision step N values of a field, laid out as the bond vectors.
+  const float* getSinglePrecisionData(int fieldId) const;
+
+  //! Copies the single-precision step N values of a field into its step NP1 vector.
+  void copySinglePrecisionDataToField(int fieldId);
+
+  //! Rounds the step NP1 values of a field into its single-precision step N store.
+  void copyFieldToSinglePrecisionData(int fieldId);
+
+  //! Returns the memory used by the point data of all states, including structure-of-arrays copies, in megabytes.
+  double pointDataMemorySize() const;
+
+  //! Returns the memory used by the bond data of all states, including single-precision step N values, in megabytes.
+  double bondDataMemorySize() const;
+
+  //! Returns the memory saved by storing step N values in single precision rather than double precision, in megabytes.
+  double singlePrecisionMemorySaving() const;
+
   //! Swaps StateN and StateNP1; stateNONE is unaffected.
   void updateState(){
 
@@ -172,20 +232,43 @@ public:
 
     // Swap pointers for all other state data
     stateN.swap(stateNP1);
+
+    // The structure-of-arrays copies follow the states they mirror
+    for(std::map< std::pair<int, PeridigmField::Step>, std::vector<double> >::iterator it = structureOfArraysData.begin() ; it != structureOfArraysData.end() ; ++it){
+      if(it->first.second == PeridigmField::STEP_N)
+        it->second.swap(structureOfArraysData[std::make_pair(it->first.first, PeridigmField::STEP_NP1)]);
+    }
+
+    // Fields with single-precision step N values have a single double-precision vector, which holds step NP1
+    for(std::map< std::pair<int, PeridigmField::Step>, std::vector<float> >::iterator it = singlePrecisionData.begin() ; it != singlePrecisionData.end() ; ++it)
+      copyFieldToSinglePrecisionData(it->first.first);
   }
-  void writeBlocktoDisk(std::string blockName,char const * path){
+  void writeBlocktoDisk(std::string blockName, RestartWriter& writer){
       // StateNone is unaffected by restart so only StateN and StateNP1 are written
-	  getStateN()->writeStateData(getStateN(),"StateN",blockName,path);
-	  getStateNP1()->writeStateData(getStateNP1(),"StateNP1",blockName,path);
+	  getStateN()->writeStateData(writer,"StateN",blockName,*ownedScalarPointMap);
+	  getStateNP1()->writeStateData(writer,"StateNP1",blockName,*ownedScalarPointMap);
+	  if(hasSinglePrecisionData())
+	    writer.add(blockName + "SinglePrecisionStateN", *getSinglePrecisionMultiVector());
   }
-  void readBlockfromDisk(std::string blockName,char const * path){
-      // StateNone is unaffected by restart so only StateN and StateNP1 are red
-	  getStateN()->readStateData(getStateN(),"StateN",blockName,path);
-	  getStateNP1()->readStateData(getStateNP1(),"StateNP1",blockName,path);
+  void readBlockfromDisk(std::string blockName, RestartReader& reader){
+      // StateNone is unaffected by restart so only StateN and StateNP1 are read
+	  getStateN()->readStateData(reader,"StateN",blockName);
+	  getStateNP1()->readStateData(reader,"StateNP1",blockName);
+	  if(hasSinglePrecisionData()){
+	    Teuchos::RCP<Epetra_MultiVector> singlePrecisionMultiVector = getSinglePrecisionMultiVector();
+	    reader.read(blockName + "SinglePrecisionStateN", *singlePrecisionMultiVector);
+	    setSinglePrecisionMultiVector(*singlePrecisionMultiVector);
+	  }
   }
 
 protected:
 
+  //! Returns a multivector on the owned bond map with one column for each field with single-precision step N values, in the order of singlePrecisionData.
+  Teuchos::RCP<Epetra_MultiVector> getSinglePrecisionMultiVector() const;
+
+  //! Copies the columns of a multivector created by getSinglePrecisionMultiVector() into the single-precision store.
+  void setSinglePrecisionMultiVector(const Epetra_MultiVector& multiVector);
+
   //! Field manager
   FieldManager& fieldManager;
 
@@ -253,6 +336,12 @@ protected:
   //! Data storage for state NONE (stateless data).
   Teuchos::RCP<State> stateNONE;
   //@}
+
+  //! Structure-of-arrays copies of selected vector point fields, see getStructureOfArraysData().
+  std::map< std::pair<int, PeridigmField::Step>, std::vector<double> > structureOfArraysData;
+
+  //! Single-precision step N values of selected two-step bond fields, see setSinglePrecisionFieldIds().
+  std::map< std::pair<int, PeridigmField::Step>, std::vector<float> > singlePrecisionData;
 };
 
 }
@@ -0,0 +1,699 @@
+/*! \file Peridigm_Expression.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_Expression.hpp"
+#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+typedef PeridigmNS::Expression::OpCode OpCode;
+typedef PeridigmNS::Expression::Instruction Instruction;
+
+//! Number of points evaluated together by the batch interpreter.
+const int chunkSize = 64;
+
+int numOperands(OpCode op){
+  switch(op){
+  case PeridigmNS::Expression::CONSTANT:
+  case PeridigmNS::Expression::VARIABLE:
+    return 0;
+  case PeridigmNS::Expression::ADD:
+  case PeridigmNS::Expression::SUBTRACT:
+  case PeridigmNS::Expression::MULTIPLY:
+  case PeridigmNS::Expression::DIVIDE:
+  case PeridigmNS::Expression::MODULO:
+  case PeridigmNS::Expression::POWER:
+  case PeridigmNS::Expression::LESS:
+  case PeridigmNS::Expression::LESS_EQUAL:
+  case PeridigmNS::Expression::GREATER:
+  case PeridigmNS::Expression::GREATER_EQUAL:
+  case PeridigmNS::Expression::EQUAL:
+  case PeridigmNS::Expression::NOT_EQUAL:
+  case PeridigmNS::Expression::AND:
+  case PeridigmNS::Expression::OR:
+  case PeridigmNS::Expression::ATAN2:
+  case PeridigmNS::Expression::MIN:
+  case PeridigmNS::Expression::MAX:
+    return 2;
+  case PeridigmNS::Expression::SELECT:
+    return 3;
+  default:
+    return 1;
+  }
+}
+
+//! Applies an operation to scalar operands; used for constant folding and single-point evaluation.
+inline double apply(OpCode op, double a, double b, double c){
+  switch(op){
+  case PeridigmNS::Expression::ADD:           return a + b;
+  case PeridigmNS::Expression::SUBTRACT:      return a - b;
+  case PeridigmNS::Expression::MULTIPLY:      return a * b;
+  case PeridigmNS::Expression::DIVIDE:        return a / b;
+  case PeridigmNS::Expression::MODULO:        return std::fmod(a, b);
+  case PeridigmNS::Expression::POWER:         return std::pow(a, b);
+  case PeridigmNS::Expression::NEGATE:        return -a;
+  case PeridigmNS::Expression::LESS:          return a < b ? 1.0 : 0.0;
+  case PeridigmNS::Expression::LESS_EQUAL:    return a <= b ? 1.0 : 0.0;
+  case PeridigmNS::Expression::GREATER:       return a > b ? 1.0 : 0.0;
+  case PeridigmNS::Expression::GREATER_EQUAL: return a >= b ? 1.0 : 0.0;
+  case PeridigmNS::Expression::EQUAL:         return a == b ? 1.0 : 0.0;
+  case PeridigmNS::Expression::NOT_EQUAL:     return a != b ? 1.0 : 0.0;
+  case PeridigmNS::Expression::AND:           return (a != 0.0 && b != 0.0) ? 1.0 : 0.0;
+  case PeridigmNS::Expression::OR:            return (a != 0.0 || b != 0.0) ? 1.0 : 0.0;
+  case PeridigmNS::Expression::NOT:           return a == 0.0 ? 1.0 : 0.0;
+  case PeridigmNS::Expression::SELECT:        return a != 0.0 ? b : c;
+  case PeridigmNS::Expression::SIN:           return std::sin(a);
+  case PeridigmNS::Expression::COS:           return std::cos(a);
+  case PeridigmNS::Expression::TAN:           return std::tan(a);
+  case PeridigmNS::Expression::ASIN:          return std::asin(a);
+  case PeridigmNS::Expression::ACOS:          return std::acos(a);
+  case PeridigmNS::Expression::ATAN:          return std::atan(a);
+  case PeridigmNS::Expression::ATAN2:         return std::atan2(a, b);
+  case PeridigmNS::Expression::SINH:          return std::sinh(a);
+  case PeridigmNS::Expression::COSH:          return std::cosh(a);
+  case PeridigmNS::Expression::TANH:          return std::tanh(a);
+  case PeridigmNS::Expression::EXP:           return std::exp(a);
+  case PeridigmNS::Expression::LOG:           return std::log(a);
+  case PeridigmNS::Expression::LOG10:         return std::log10(a);
+  case PeridigmNS::Expression::SQRT:          return std::sqrt(a);
+  case PeridigmNS::Expression::ABS:           return std::fabs(a);
+  case PeridigmNS::Expression::FLOOR:         return std::floor(a);
+  case PeridigmNS::Expression::CEIL:          return std::ceil(a);
+  case PeridigmNS::Expression::MIN:           return a < b ? a : b;
+  case PeridigmNS::Expression::MAX:           return a > b ? a : b;
+  default:                                    return 0.0;
+  }
+}
+
+struct Token {
+  enum Type { NUMBER, IDENTIFIER, SYMBOL, END } type;
+  string text;
+  double number;
+};
+
+//! Parses a function string into an expression graph; branches are merged into selects so the graph is side-effect free.
+class Compiler {
+
+public:
+
+  Compiler(const string& function, const vector<string>& variableNames)
+    : position(0), failed(false)
+  {
+    tokenize(function);
+    for(unsigned int i=0 ; i<variableNames.size() ; ++i){
+      Instruction node = {PeridigmNS::Expression::VARIABLE, static_cast<int>(i), -1, -1, 0.0};
+      symbols[variableNames[i]] = addNode(node);
+    }
+  }
+
+  //! Parses the statements; returns false on error.
+  bool parse(){
+    while(!failed && tokens[position].type != Token::END)
+      statement();
+    return !failed;
+  }
+
+  bool hasFailed() const { return failed; }
+  const string& getError() const { return error; }
+  const vector<Instruction>& getNodes() const { return nodes; }
+
+  //! Returns the node holding the current value of a variable, or -1.
+  int lookup(const string& name) const {
+    map<string, int>::const_iterator it = symbols.find(name);
+    return it == symbols.end() ? -1 : it->second;
+  }
+
+private:
+
+  void tokenize(const string& s){
+    unsigned int i = 0;
+    while(i < s.size()){
+      char ch = s[i];
+      // Backslashes are tolerated so that escaped braces in yaml decks are accepted
+      if(isspace(static_cast<unsigned char>(ch)) || ch == '\\'){
+        i++;
+      }
+      else if(isdigit(static_cast<unsigned char>(ch)) || (ch == '.' && i+1 < s.size() && isdigit(static_cast<unsigned char>(s[i+1])))){
+        const char* begin = s.c_str() + i;
+        char* end;
+        Token token = {Token::NUMBER, "", strtod(begin, &end)};
+        tokens.push_back(token);
+        i += static_cast<unsigned int>(end - begin);
+      }
+      else if(isalpha(static_cast<unsigned char>(ch)) || ch == '_'){
+        unsigned int start = i;
+        while(i < s.size() && (isalnum(static_cast<unsigned char>(s[i])) || s[i] == '_'))
+          i++;
+        Token token = {Token::IDENTIFIER, s.substr(start, i-start), 0.0};
+        tokens.push_back(token);
+      }
+      else{
+        string two = s.substr(i, 2);
+        Token token = {Token::SYMBOL, "", 0.0};
+        if(two == "<=" || two == ">=" || two == "==" || two == "!=" || two == "&&" || two == "||"){
+          token.text = two;
+          i += 2;
+        }
+        else if(strchr("+-*/%^()<>!=;{},", ch) != NULL){
+          token.text = string(1, ch);
+          i += 1;
+        }
+        else{
+          fail(string("unexpected character '") + ch + "'");
+          break;
+        }
+        tokens.push_back(token);
+      }
+    }
+    Token end = {Token::END, "", 0.0};
+    tokens.push_back(end);
+  }
+
+  void fail(const string& message){
+    if(!failed)
+      error = message;
+    failed = true;
+  }
+
+  bool isSymbol(const char* text) const {
+    return tokens[position].type == Token::SYMBOL && tokens[position].text == text;
+  }
+
+  bool isIdentifier(const char* text) const {
+    return tokens[position].type == Token::IDENTIFIER && tokens[position].text == text;
+  }
+
+  void expect(const char* text){
+    if(isSymbol(text))
+      position++;
+    else
+      fail(string("expected '") + text + "'");
+  }
+
+  //! Adds a node, folding constants and reusing identical nodes.
+  int addNode(const Instruction& node){
+    int n = numOperands(node.op);
+    bool allConstant = n > 0;
+    const int operands[3] = {node.a, node.b, node.c};
+    for(int i=0 ; i<n ; ++i)
+      if(nodes[operands[i]].op != PeridigmNS::Expression::CONSTANT)
+        allConstant = false;
+    if(allConstant){
+      double values[3] = {0.0, 0.0, 0.0};
+      for(int i=0 ; i<n ; ++i)
+        values[i] = nodes[operands[i]].constant;
+      return constant(apply(node.op, values[0], values[1], values[2]));
+    }
+    if(node.op == PeridigmNS::Expression::SELECT){
+      if(node.b == node.c)
+        return node.b;
+      if(nodes[node.a].op == PeridigmNS::Expression::CONSTANT)
+        return nodes[node.a].constant != 0.0 ? node.b : node.c;
+    }
+    string key(reinterpret_cast<const char*>(&node.op), sizeof(node.op));
+    key.append(reinterpret_cast<const char*>(operands), sizeof(operands));
+    key.append(reinterpret_cast<const char*>(&node.constant), sizeof(node.constant));
+    map<string, int>::iterator it = uniqueNodes.find(key);
+    if(it != uniqueNodes.end())
+      return it->second;
+    nodes.push_back(node);
+    uniqueNodes[key] = static_cast<int>(nodes.size()) - 1;
+    return static_cast<int>(nodes.size()) - 1;
+  }
+
+  int constant(double value){
+    Instruction node = {PeridigmNS::Expression::CONSTANT, -1, -1, -1, value};
+    return addNode(node);
+  }
+
+  int operation(OpCode op, int a, int b = -1, int c = -1){
+    Instruction node = {op, a, b, c, 0.0};
+    return addNode(node);
+  }
+
+  void statement(){
+    if(failed)
+      return;
+    if(isSymbol(";")){
+      position++;
+    }
+    else if(isSymbol("{")){
+      position++;
+      while(!failed && !isSymbol("}") && tokens[position].type != Token::END)
+        statement();
+      expect("}");
+    }
+    else if(isIdentifier("if")){
+      position++;
+      expect("(");
+      int condition = expression();
+      expect(")");
+      map<string, int> before = symbols;
+      statement();
+      map<string, int> thenSymbols = symbols;
+      symbols = before;
+      if(isIdentifier("else")){
+        position++;
+        statement();
+      }
+      // Variables assigned in either branch become selects; locals defined in only one branch go out of scope
+      map<string, int> merged;
+      for(map<string, int>::const_iterator it = thenSymbols.begin() ; it != thenSymbols.end() ; ++it){
+        map<string, int>::const_iterator elseIt = symbols.find(it->first);
+        if(elseIt != symbols.end())
+          merged[it->first] = operation(PeridigmNS::Expression::SELECT, condition, it->second, elseIt->second);
+      }
+      symbols = merged;
+    }
+    else if(tokens[position].type == Token::IDENTIFIER){
+      if(isIdentifier("double") || isIdentifier("float"))
+        position++;
+      if(tokens[position].type != Token::IDENTIFIER){
+        fail("expected a variable name");
+        return;
+      }
+      string name = tokens[position].text;
+      position++;
+      if(isSymbol("=")){
+        position++;
+        int value = expression();
+        symbols[name] = value;
+      }
+      else{
+        // Declaration without initialization
+        if(symbols.find(name) == symbols.end())
+          symbols[name] = constant(0.0);
+      }
+      // The closing semicolon may be omitted on the last statement of a block
+      if(isSymbol(";"))
+        position++;
+      else if(!isSymbol("}") && tokens[position].type != Token::END)
+        fail("expected ';'");
+    }
+    else{
+      fail("unexpected token '" + tokens[position].text + "'");
+    }
+  }
+
+  int expression(){
+    return logicalOr();
+  }
+
+  int logicalOr(){
+    int left = logicalAnd();
+    while(!failed && isSymbol("||")){
+      position++;
+      left = operation(PeridigmNS::Expression::OR, left, logicalAnd());
+    }
+    return left;
+  }
+
+  int logicalAnd(){
+    int left = equality();
+    while(!failed && isSymbol("&&")){
+      position++;
+      left = operation(PeridigmNS::Expression::AND, left, equality());
+    }
+    return left;
+  }
+
+  int equality(){
+    int left = relational();
+    while(!failed && (isSymbol("==") || isSymbol("!="))){
+      OpCode op = isSymbol("==") ? PeridigmNS::Expression::EQUAL : PeridigmNS::Expression::NOT_EQUAL;
+      position++;
+      left = operation(op, left, relational());
+    }
+    return left;
+  }
+
+  int relational(){
+    int left = additive();
+    while(!failed && (isSymbol("<") || isSymbol("<=") || isSymbol(">") || isSymbol(">="))){
+      OpCode op = PeridigmNS::Expression::LESS;
+      if(isSymbol("<="))
+        op = PeridigmNS::Expression::LESS_EQUAL;
+      else if(isSymbol(">"))
+        op = PeridigmNS::Expression::GREATER;
+      else if(isSymbol(">="))
+        op = PeridigmNS::Expression::GREATER_EQUAL;
+      position++;
+      left = operation(op, left, additive());
+    }
+    return left;
+  }
+
+  int additive(){
+    int left = multiplicative();
+    while(!failed && (isSymbol("+") || isSymbol("-"))){
+      OpCode op = isSymbol("+") ? PeridigmNS::Expression::ADD : PeridigmNS::Expression::SUBTRACT;
+      position++;
+      left = operation(op, left, multiplicative());
+    }
+    return left;
+  }
+
+  int multiplicative(){
+    int left = unary();
+    while(!failed && (isSymbol("*") || isSymbol("/") || isSymbol("%"))){
+      OpCode op = PeridigmNS::Expression::MULTIPLY;
+      if(isSymbol("/"))
+        op = PeridigmNS::Expression::DIVIDE;
+      else if(isSymbol("%"))
+        op = PeridigmNS::Expression::MODULO;
+      position++;
+      left = operation(op, left, unary());
+    }
+    return left;
+  }
+
+  int unary(){
+    if(failed)
+      return constant(0.0);
+    if(isSymbol("-")){
+      position++;
+      return operation(PeridigmNS::Expression::NEGATE, unary());
+    }
+    if(isSymbol("+")){
+      position++;
+      return unary();
+    }
+    if(isSymbol("!")){
+      position++;
+      return operation(PeridigmNS::Expression::NOT, unary());
+    }
+    return power();
+  }
+
+  //! The exponent binds tighter than the unary operators on its left:  -x^2 is -(x^2).
+  int power(){
+    int base = primary();
+    if(!failed && isSymbol("^")){
+      position++;
+      return operation(PeridigmNS::Expression::POWER, base, unary());
+    }
+    return base;
+  }
+
+  int primary(){
+    if(failed)
+      return constant(0.0);
+    const Token& token = tokens[position];
+    if(token.type == Token::NUMBER){
+      position++;
+      return constant(token.number);
+    }
+    if(isSymbol("(")){
+      position++;
+      int value = expression();
+      expect(")");
+      return value;
+    }
+    if(token.type == Token::IDENTIFIER){
+      string name = token.text;
+      position++;
+      if(isSymbol("("))
+        return function(name);
+      int node = lookup(name);
+      if(node == -1)
+        fail("undefined variable '" + name + "'");
+      return node == -1 ? constant(0.0) : node;
+    }
+    fail("unexpected token '" + token.text + "'");
+    return constant(0.0);
+  }
+
+  int function(const string& name){
+    static map<string, OpCode> functions;
+    if(functions.empty()){
+      functions["sin"] = PeridigmNS::Expression::SIN;     functions["cos"] = PeridigmNS::Expression::COS;
+      functions["tan"] = PeridigmNS::Expression::TAN;     functions["asin"] = PeridigmNS::Expression::ASIN;
+      functions["acos"] = PeridigmNS::Expression::ACOS;   functions["atan"] = PeridigmNS::Expression::ATAN;
+      functions["atan2"] = PeridigmNS::Expression::ATAN2; functions["sinh"] = PeridigmNS::Expression::SINH;
+      functions["cosh"] = PeridigmNS::Expression::COSH;   functions["tanh"] = PeridigmNS::Expression::TANH;
+      functions["exp"] = PeridigmNS::Expression::EXP;     functions["log"] = PeridigmNS::Expression::LOG;
+      functions["log10"] = PeridigmNS::Expression::LOG10; functions["sqrt"] = PeridigmNS::Expression::SQRT;
+      functions["abs"] = PeridigmNS::Expression::ABS;     functions["fabs"] = PeridigmNS::Expression::ABS;
+      functions["floor"] = PeridigmNS::Expression::FLOOR; functions["ceil"] = PeridigmNS::Expression::CEIL;
+      functions["pow"] = PeridigmNS::Expression::POWER;   functions["fmod"] = PeridigmNS::Expression::MODULO;
+      functions["min"] = PeridigmNS::Expression::MIN;     functions["fmin"] = PeridigmNS::Expression::MIN;
+      functions["max"] = PeridigmNS::Expression::MAX;     functions["fmax"] = PeridigmNS::Expression::MAX;
+    }
+    map<string, OpCode>::const_iterator it = functions.find(name);
+    if(it == functions.end()){
+      fail("unknown function '" + name + "'");
+      return constant(0.0);
+    }
+    expect("(");
+    int arguments[2] = {-1, -1};
+    int n = numOperands(it->second);
+    for(int i=0 ; i<n && !failed ; ++i){
+      if(i > 0)
+        expect(",");
+      arguments[i] = expression();
+    }
+    expect(")");
+    if(failed)
+      return constant(0.0);
+    return operation(it->second, arguments[0], arguments[1]);
+  }
+
+  vector<Token> tokens;
+  unsigned int position;
+  bool failed;
+  string error;
+  vector<Instruction> nodes;
+  map<string, int> uniqueNodes;
+  map<string, int> symbols;
+};
+
+//! Appends the nodes reachable from node to the program in evaluation order.
+void emit(int node, const vector<Instruction>& nodes, vector<int>& registerOfNode, vector<Instruction>& program){
+  if(registerOfNode[node] != -1)
+    return;
+  Instruction instruction = nodes[node];
+  int n = numOperands(instruction.op);
+  int* operands[3] = {&instruction.a, &instruction.b, &instruction.c};
+  for(int i=0 ; i<n ; ++i){
+    emit(*operands[i], nodes, registerOfNode, program);
+    *operands[i] = registerOfNode[*operands[i]];
+  }
+  registerOfNode[node] = static_cast<int>(program.size());
+  program.push_back(instruction);
+}
+
+}
+
+PeridigmNS::Expression::Expression(const std::vector<std::string>& variableNames_, const std::string& resultName)
+  : variableNames(variableNames_), resultVariable(-1), compiled(false)
+{
+  for(unsigned int i=0 ; i<variableNames.size() ; ++i)
+    if(variableNames[i] == resultName)
+      resultVariable = i;
+  if(resultVariable == -1){
+    resultVariable = static_cast<int>(variableNames.size());
+    variableNames.push_back(resultName);
+  }
+  Binding binding = {NULL, 1, 0.0};
+  bindings.resize(variableNames.size(), binding);
+}
+
+bool PeridigmNS::Expression::compile(const std::string& function)
+{
+  compiled = false;
+  errors.clear();
+  program.clear();
+  variableIsUsed.assign(variableNames.size(), false);
+
+  Compiler compiler(function, variableNames);
+  if(!compiler.parse()){
+    errors = compiler.getError();
+    return false;
+  }
+
+  const vector<Instruction>& nodes = compiler.getNodes();
+  vector<int> registerOfNode(nodes.size(), -1);
+  emit(compiler.lookup(variableNames[resultVariable]), nodes, registerOfNode, program);
+  for(unsigned int i=0 ; i<program.size() ; ++i)
+    if(program[i].op == VARIABLE)
+      variableIsUsed[program[i].a] = true;
+  registers.resize(program.size()*chunkSize);
+  compiled = true;
+  return true;
+}
+
+bool PeridigmNS::Expression::dependsOn(int variable) const
+{
+  if(variable < 0 || variable >= static_cast<int>(variableIsUsed.size()))
+    return false;
+  return variableIsUsed[variable];
+}
+
+double PeridigmNS::Expression::evaluate(const double* values) const
+{
+  const int numInstructions = static_cast<int>(program.size());
+  if(numInstructions == 0)
+    return 0.0;
+  double localRegisters[128] = {0.0};
+  vector<double> heapRegisters;
+  double* r = localRegisters;
+  if(numInstructions > 128){
+    heapRegisters.resize(numInstructions);
+    r = &heapRegisters[0];
+  }
+  for(int i=0 ; i<numInstructions ; ++i){
+    const Instruction& instruction = program[i];
+    if(instruction.op == CONSTANT)
+      r[i] = instruction.constant;
+    else if(instruction.op == VARIABLE)
+      r[i] = values[instruction.a];
+    else
+      r[i] = apply(instruction.op,
+                   r[instruction.a],
+                   instruction.b == -1 ? 0.0 : r[instruction.b],
+                   instruction.c == -1 ? 0.0 : r[instruction.c]);
+  }
+  return r[numInstructions-1];
+}
+
+void PeridigmNS::Expression::setVariable(int variable, double value)
+{
+  bindings[variable].values = NULL;
+  bindings[variable].stride = 1;
+  bindings[variable].value = value;
+}
+
+void PeridigmNS::Expression::setVariable(int variable, const double* values, int stride)
+{
+  bindings[variable].values = values;
+  bindings[variable].stride = stride;
+}
+
+void PeridigmNS::Expression::evaluate(int numPoints, double* result, int resultStride)
+{
+  const int numInstructions = static_cast<int>(program.size());
+
+  // An expression that does not read any per-point variable is evaluated once
+  bool isUniform = true;
+  for(unsigned int i=0 ; i<bindings.size() ; ++i)
+    if(variableIsUsed[i] && bindings[i].values != NULL)
+      isUniform = false;
+  if(isUniform){
+    vector<double> values(bindings.size());
+    for(unsigned int i=0 ; i<bindings.size() ; ++i)
+      values[i] = bindings[i].value;
+    double value = evaluate(&values[0]);
+    for(int iPoint=0 ; iPoint<numPoints ; ++iPoint)
+      result[iPoint*resultStride] = value;
+    return;
+  }
+
+  // Registers that are the same for every point are filled once
+  for(int i=0 ; i<numInstructions ; ++i){
+    const Instruction& instruction = program[i];
+    double* r = &registers[i*chunkSize];
+    if(instruction.op == CONSTANT)
+      std::fill(r, r+chunkSize, instruction.constant);
+    else if(instruction.op == VARIABLE && bindings[instruction.a].values == NULL)
+      std::fill(r, r+chunkSize, bindings[instruction.a].value);
+  }
+
+  for(int first=0 ; first<numPoints ; first+=chunkSize){
+    const int n = std::min(chunkSize, numPoints-first);
+    for(int i=0 ; i<numInstructions ; ++i){
+      const Instruction& instruction = program[i];
+      double* r = &registers[i*chunkSize];
+      const double* a = instruction.a == -1 ? NULL : &registers[instruction.a*chunkSize];
+      const double* b = instruction.b == -1 ? NULL : &registers[instruction.b*chunkSize];
+      const double* c = instruction.c == -1 ? NULL : &registers[instruction.c*chunkSize];
+      switch(instruction.op){
+      case CONSTANT:
+        break;
+      case VARIABLE:
+        {
+          const Binding& binding = bindings[instruction.a];
+          if(binding.values != NULL)
+            for(int j=0 ; j<n ; ++j)
+              r[j] = binding.values[(first+j)*binding.stride];
+        }
+        break;
+      case ADD:
+        for(int j=0 ; j<n ; ++j) r[j] = a[j] + b[j];
+        break;
+      case SUBTRACT:
+        for(int j=0 ; j<n ; ++j) r[j] = a[j] - b[j];
+        break;
+      case MULTIPLY:
+        for(int j=0 ; j<n ; ++j) r[j] = a[j] * b[j];
+        break;
+      case DIVIDE:
+        for(int j=0 ; j<n ; ++j) r[j] = a[j] / b[j];
+        break;
+      case NEGATE:
+        for(int j=0 ; j<n ; ++j) r[j] = -a[j];
+        break;
+      case SELECT:
+        for(int j=0 ; j<n ; ++j) r[j] = a[j] != 0.0 ? b[j] : c[j];
+        break;
+      default:
+        for(int j=0 ; j<n ; ++j)
+          r[j] = apply(instruction.op, a[j], b == NULL ? 0.0 : b[j], c == NULL ? 0.0 : c[j]);
+        break;
+      }
+    }
+    const double* value = &registers[(numInstructions-1)*chunkSize];
+    for(int j=0 ; j<n ; ++j)
+      result[(first+j)*resultStride] = value[j];
+  }
+}
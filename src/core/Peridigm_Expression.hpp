@@ -0,0 +1,135 @@
+/*! \file Peridigm_Expression.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_EXPRESSION_HPP
+#define PERIDIGM_EXPRESSION_HPP
+
+#include <string>
+#include <vector>
+
+namespace PeridigmNS {
+
+/*! \brief Compiled form of the user-defined functions in the input deck (boundary conditions, horizons, influence functions).
+
+  The function string is parsed once into an expression graph, simplified (constant folding, common
+  subexpressions, branches turned into selects) and lowered to a straight-line register bytecode that is
+  evaluated over batches of points.  The accepted language is the subset of the run-time compiler syntax
+  used for these functions:  assignments, if/else, arithmetic, comparison and logical operators, ^ for
+  powers, and the usual math functions.  compile() returns false for anything outside this subset so that
+  the caller can fall back to the run-time compiler.
+*/
+class Expression {
+
+public:
+
+  //! Constructor; variableNames are the inputs of the function, resultName is the variable holding the result.
+  Expression(const std::vector<std::string>& variableNames, const std::string& resultName = "value");
+
+  //! Compiles the function; returns false and records the reason if the function cannot be compiled.
+  bool compile(const std::string& function);
+
+  //! Returns true if compile() succeeded.
+  bool isCompiled() const { return compiled; }
+
+  //! Returns the reason the last call to compile() failed.
+  const std::string& getErrors() const { return errors; }
+
+  //! Returns true if the compiled function reads the given variable.
+  bool dependsOn(int variable) const;
+
+  //! Evaluates the function at a single point; values holds one entry per variable.  Thread safe.
+  double evaluate(const double* values) const;
+
+  //! Sets a variable to the same value for every point of the next batch evaluation.
+  void setVariable(int variable, double value);
+
+  //! Sets a variable to an array with one entry per point (separated by stride) for the next batch evaluation.
+  void setVariable(int variable, const double* values, int stride = 1);
+
+  //! Evaluates the function at numPoints points.
+  void evaluate(int numPoints, double* result, int resultStride = 1);
+
+  //! Returns the number of bytecode instructions.
+  int getNumInstructions() const { return static_cast<int>(program.size()); }
+
+  enum OpCode {
+    CONSTANT, VARIABLE,
+    ADD, SUBTRACT, MULTIPLY, DIVIDE, MODULO, POWER, NEGATE,
+    LESS, LESS_EQUAL, GREATER, GREATER_EQUAL, EQUAL, NOT_EQUAL, AND, OR, NOT, SELECT,
+    SIN, COS, TAN, ASIN, ACOS, ATAN, ATAN2, SINH, COSH, TANH,
+    EXP, LOG, LOG10, SQRT, ABS, FLOOR, CEIL, MIN, MAX
+  };
+
+  //! Bytecode instruction; a, b and c are the registers of the operands, the result goes to the register with the index of the instruction.
+  struct Instruction {
+    OpCode op;
+    int a, b, c;
+    double constant;
+  };
+
+  //! Binding of a variable for batch evaluation.
+  struct Binding {
+    const double* values;
+    int stride;
+    double value;
+  };
+
+private:
+
+  std::vector<std::string> variableNames;
+  int resultVariable;
+  bool compiled;
+  std::string errors;
+  std::vector<Instruction> program;
+  std::vector<bool> variableIsUsed;
+  std::vector<Binding> bindings;
+  std::vector<double> registers;
+};
+
+}
+
+#endif // PERIDIGM_EXPRESSION_HPP
@@ -154,6 +154,25 @@ double PeridigmNS::HorizonManager::evaluateHorizon(string blockName, double x, d
   string rtcFunctionString = horizonFunction;
   if(rtcFunctionString.find("value") == string::npos)
     rtcFunctionString = "value = " + rtcFunctionString;
+
+  // The horizon is evaluated for every element during discretization, so each function is compiled once
+  std::map<std::string, Teuchos::RCP<Expression> >::iterator expressionIt = horizonExpressions.find(horizonFunction);
+  if(expressionIt == horizonExpressions.end()){
+    std::vector<std::string> variableNames;
+    variableNames.push_back("x");
+    variableNames.push_back("y");
+    variableNames.push_back("z");
+    variableNames.push_back("value");
+    Teuchos::RCP<Expression> expression = Teuchos::rcp(new Expression(variableNames));
+    if(!expression->compile(rtcFunctionString))
+      expression = Teuchos::null;
+    expressionIt = horizonExpressions.insert(std::make_pair(horizonFunction, expression)).first;
+  }
+  if(!expressionIt->second.is_null()){
+    const double values[4] = {x, y, z, 0.0};
+    return expressionIt->second->evaluate(values);
+  }
+
   bool success = rtcFunction->addBody(rtcFunctionString);
   if(success)
     rtcFunction->varValueFill(0, x);
@@ -51,6 +51,7 @@
 #include <Teuchos_ParameterList.hpp>
 #include <string>
 #include <map>
+#include "Peridigm_Expression.hpp"
 
 #include <Trilinos_version.h>
 #if TRILINOS_MAJOR_MINOR_VERSION >= 111100
@@ -88,6 +89,9 @@ protected:
   //! Run-time compiler, used as function parser
   Teuchos::RCP<PG_RuntimeCompiler::Function> rtcFunction;
 
+  //! Compiled horizon functions, keyed by horizon string; null for functions left to the run-time compiler.
+  std::map<std::string, Teuchos::RCP<Expression> > horizonExpressions;
+
   //! Container for strings defining horizon for each block.
   std::map<std::string, std::string> horizonStrings;
 
@@ -51,12 +51,24 @@ using namespace std;
 
 PG_RuntimeCompiler::Function PeridigmNS::InfluenceFunction::rtcFunction(3, "rtcInfluenceFunctionUserDefinedFunction");
 
+namespace {
+std::vector<std::string> influenceFunctionVariableNames(){
+  std::vector<std::string> variableNames;
+  variableNames.push_back("zeta");
+  variableNames.push_back("horizon");
+  variableNames.push_back("value");
+  return variableNames;
+}
+}
+
+PeridigmNS::Expression PeridigmNS::InfluenceFunction::expression(influenceFunctionVariableNames());
+
 PeridigmNS::InfluenceFunction& PeridigmNS::InfluenceFunction::self() {
   static InfluenceFunction influenceFunction;
   return influenceFunction;
 }
 
-PeridigmNS::InfluenceFunction::InfluenceFunction() : m_influenceFunction(NULL) {
+PeridigmNS::InfluenceFunction::InfluenceFunction() : m_influenceFunction(NULL), m_influenceFunctionType(USER_DEFINED) {
 
   // Set the influence function to One by default
   setInfluenceFunction("One");
@@ -68,6 +80,10 @@ PeridigmNS::InfluenceFunction::InfluenceFunction() : m_influenceFunction(NULL) {
 }
 
 double PeridigmNS::InfluenceFunction::userDefinedInfluenceFunction(double zeta, double horizon){
+  if(expression.isCompiled()){
+    const double values[3] = {zeta, horizon, 0.0};
+    return expression.evaluate(values);
+  }
   double value(0.0);
   bool success = rtcFunction.varValueFill(0, zeta);
   if(success)
@@ -51,6 +51,7 @@
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_Assert.hpp>
 #include <string>
+#include "Peridigm_Expression.hpp"
 
 #include <Trilinos_version.h>
 #if TRILINOS_MAJOR_MINOR_VERSION >= 111100
@@ -86,6 +87,31 @@ static double gaussian(double zeta, double horizon)
   return exp(-xi2/h2);
 }
 
+// Policies wrapping the influence functions above, used to specialize bond loops at
+// compile time so that the influence function can be inlined into the loop body.
+
+//! Policy for the constant influence function "One".
+struct OnePolicy {
+  double operator()(double zeta, double horizon) const { return 1.0; }
+};
+
+//! Policy for the "Parabolic Decay" influence function.
+struct ParabolicDecayPolicy {
+  double operator()(double zeta, double horizon) const { return parabolicDecay(zeta, horizon); }
+};
+
+//! Policy for the "Gaussian" influence function.
+struct GaussianPolicy {
+  double operator()(double zeta, double horizon) const { return gaussian(zeta, horizon); }
+};
+
+//! Fallback policy calling through a function pointer, used for user-defined influence functions.
+struct FunctionPointerPolicy {
+  explicit FunctionPointerPolicy(double (*f)(double, double)) : function(f) {}
+  double operator()(double zeta, double horizon) const { return function(zeta, horizon); }
+  double (*function)(double, double);
+};
+
 }
 
 class InfluenceFunction {
@@ -95,6 +121,9 @@ public:
   //! Type definition for the function pointer to an influence function
   typedef double (*functionPointer)(double, double);
 
+  //! Influence functions that have a compile-time policy in PeridigmInfluenceFunction.
+  enum Type { ONE=0, PARABOLIC_DECAY=1, GAUSSIAN=2, USER_DEFINED=3 };
+
   //! Singleton.
   static InfluenceFunction & self();
 
@@ -122,18 +151,25 @@ public:
 
     if(influenceFunctionString == "One"){
       m_influenceFunction = &PeridigmInfluenceFunction::one;
+      m_influenceFunctionType = ONE;
     }
     else if(influenceFunctionString == "Parabolic Decay"){
       m_influenceFunction = &PeridigmInfluenceFunction::parabolicDecay;
+      m_influenceFunctionType = PARABOLIC_DECAY;
     }
     else if(influenceFunctionString == "Gaussian"){
       m_influenceFunction = &PeridigmInfluenceFunction::gaussian;
+      m_influenceFunctionType = GAUSSIAN;
     }
     else{
       // Assume that unrecognized strings are user-defined influence functions.
+      m_influenceFunctionType = USER_DEFINED;
       std::string rtcFunctionString = influenceFunctionString;
       if(rtcFunctionString.find("value") == std::string::npos)
         rtcFunctionString = "value = " + rtcFunctionString;
+      m_influenceFunction = &userDefinedInfluenceFunction;
+      if(expression.compile(rtcFunctionString))
+        return;
       bool success = rtcFunction.addBody(rtcFunctionString);
       if(success)
         success = rtcFunction.varValueFill(2, 0.0); // The variable that represents the return value must be set to something
@@ -142,7 +178,6 @@ public:
         msg += "**** " + rtcFunction.getErrors() + "\n";
         TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
       }    
-      m_influenceFunction = &userDefinedInfluenceFunction;
     }
   }
 
@@ -153,6 +188,49 @@ public:
     return m_influenceFunction;
   }
 
+  //! Returns the type of the given influence function, or USER_DEFINED if it is not the one set by setInfluenceFunction().
+  //! The built-in functions have internal linkage, so they are identified through the singleton rather than by address.
+  Type getInfluenceFunctionType(functionPointer influenceFunction) const {
+    if(influenceFunction != NULL && influenceFunction == m_influenceFunction)
+      return m_influenceFunctionType;
+    return USER_DEFINED;
+  }
+
+  //! An influence function together with its type.  Materials resolve the selection once, on
+  //! initialization, and pass it to the bond kernels, which call dispatch() to pick their loop.
+  struct Selection {
+    Selection() : function(NULL), type(USER_DEFINED) {}
+    Selection(functionPointer influenceFunction) : function(influenceFunction), type(self().getInfluenceFunctionType(influenceFunction)) {}
+    Selection(functionPointer influenceFunction, Type influenceFunctionType) : function(influenceFunction), type(influenceFunctionType) {}
+    functionPointer function;
+    Type type;
+  };
+
+  //! Calls kernel(policy) with the compile-time policy in PeridigmInfluenceFunction matching the selection;
+  //! user-defined influence functions are called through the function pointer.
+  template<class Kernel>
+  static void dispatch(const Selection& selection, Kernel& kernel) {
+    switch(selection.type){
+    case ONE:
+      kernel(PeridigmInfluenceFunction::OnePolicy());
+      break;
+    case PARABOLIC_DECAY:
+      kernel(PeridigmInfluenceFunction::ParabolicDecayPolicy());
+      break;
+    case GAUSSIAN:
+      kernel(PeridigmInfluenceFunction::GaussianPolicy());
+      break;
+    default:
+      kernel(PeridigmInfluenceFunction::FunctionPointerPolicy(selection.function));
+    }
+  }
+
+  //! Returns true if the given influence function may be evaluated concurrently by several threads.
+  //! User-defined functions that fall back to the run-time compiler share its variable storage and may not.
+  static bool isThreadSafe(functionPointer influenceFunction) {
+    return influenceFunction != &userDefinedInfluenceFunction || expression.isCompiled();
+  }
+
   //! Function for evaluating user-defined influence functions
   static double userDefinedInfluenceFunction(double zeta, double horizon);
 
@@ -167,11 +245,17 @@ private:
   //! Private and unimplemented to prevent use
   InfluenceFunction & operator= ( const InfluenceFunction & );
 
-  //! Run-time compiler, used as function parser
+  //! Run-time compiler, used as function parser for functions the compiled expression does not support
   static PG_RuntimeCompiler::Function rtcFunction;
 
+  //! Compiled user-defined influence function; unlike the run-time compiler it may be evaluated concurrently
+  static Expression expression;
+
   //! Function pointer to the influence function with the signature:  double function(double zeta, double horizon).
   functionPointer m_influenceFunction;
+
+  //! Type of m_influenceFunction, used to select a compile-time policy for the material kernels.
+  Type m_influenceFunctionType;
 };
 
 }
@@ -150,6 +150,7 @@ int main(int argc, char *argv[]) {
 
   PeridigmNS::Timer::self().stopTimer("Total");
   PeridigmNS::Timer::self().printTimingData(cout);
+  PeridigmNS::Timer::self().writeTrace();
 
 #ifdef HAVE_MPI
   MPI_Finalize() ;
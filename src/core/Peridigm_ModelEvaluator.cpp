@@ -46,6 +46,7 @@
 //@HEADER
 
 #include "Peridigm_ModelEvaluator.hpp"
+#include "Peridigm_Timer.hpp"
 
 PeridigmNS::ModelEvaluator::ModelEvaluator(){
 }
@@ -59,6 +60,11 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
   const double dt = workset->timeStep;
   std::vector<PeridigmNS::Block>::iterator blockIt;
 
+  // Per-block phase timers are only started when something will report them
+  PeridigmNS::Timer& timer = PeridigmNS::Timer::self();
+  const bool timePhases = timer.detailedTiming();
+  const bool timeForces = workset->timeBlockForces || timePhases;
+
   // ---- Evaluate Damage ---
 
   for(blockIt = workset->blocks->begin() ; blockIt != workset->blocks->end() ; blockIt++){
@@ -70,11 +76,15 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
       const int* ownedIDs = neighborhoodData->OwnedIDs();
       const int* neighborhoodList = neighborhoodData->NeighborhoodList();
       Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
+      if(timePhases)
+        timer.startTimer(blockIt->getTimerId(PeridigmNS::BlockBase::DAMAGE_TIMER));
       damageModel->computeDamage(dt,
                                  numOwnedPoints,
                                  ownedIDs,
                                  neighborhoodList,
                                  *dataManager);
+      if(timePhases)
+        timer.stopTimer(blockIt->getTimerId(PeridigmNS::BlockBase::DAMAGE_TIMER));
     }
   }
 
@@ -89,11 +99,17 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
     Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
     Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
 
+    if(timePhases)
+      timer.startTimer(blockIt->getTimerId(PeridigmNS::BlockBase::PRECOMPUTE_TIMER));
+
     materialModel->precompute(dt,
                               numOwnedPoints,
                               ownedIDs,
                               neighborhoodList,
                               *dataManager);
+
+    if(timePhases)
+      timer.stopTimer(blockIt->getTimerId(PeridigmNS::BlockBase::PRECOMPUTE_TIMER));
   }
 
   // ---- Synchronize data computed in precompute ----
@@ -111,11 +127,20 @@ PeridigmNS::ModelEvaluator::evalModel(Teuchos::RCP<Workset> workset) const
     Teuchos::RCP<PeridigmNS::DataManager> dataManager = blockIt->getDataManager();
     Teuchos::RCP<const PeridigmNS::Material> materialModel = blockIt->getMaterialModel();
 
+    if(timeForces)
+      timer.startTimer(blockIt->getTimerId(PeridigmNS::BlockBase::INTERNAL_FORCE_TIMER));
+
+    // The block's row offsets spare the thread-parallel kernels a pass over the neighbor list
+    materialModel->setNeighborhoodRowOffsets(neighborhoodList, neighborhoodData->RowOffsets());
     materialModel->computeForce(dt,
                                 numOwnedPoints,
                                 ownedIDs,
                                 neighborhoodList,
                                 *dataManager);
+    materialModel->setNeighborhoodRowOffsets(0, 0);
+
+    if(timeForces)
+      timer.stopTimer(blockIt->getTimerId(PeridigmNS::BlockBase::INTERNAL_FORCE_TIMER));
 
     materialModel->computeFluxDivergence(dt,
                                          numOwnedPoints,
@@ -157,6 +182,8 @@ PeridigmNS::ModelEvaluator::evalJacobian(Teuchos::RCP<Workset> workset) const
                                    jacobian,
                                    jacobianType);
   }
+
+  // Contributions to rows owned by other processors stay buffered in the SerialMatrix until SerialMatrix::globalAssemble()
 }
 
 void 
@@ -55,12 +55,14 @@ namespace PeridigmNS {
 
   //! Structure for passing data between Peridigm and the computational routines
   struct Workset {
-    Workset() {}
+    Workset() : timeBlockForces(false) {}
     double timeStep;
     Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks;
     Teuchos::RCP< PeridigmNS::ContactManager > contactManager;
     Teuchos::RCP<PeridigmNS::Material::JacobianType> jacobianType;
     Teuchos::RCP< PeridigmNS::SerialMatrix > jacobian;
+    //! Time the internal force evaluation of each block separately (load balance calibration)
+    bool timeBlockForces;
   };
 
   //! The main ModelEvaluator class; provides the interface between the driver code and the computational routines.
@@ -48,26 +48,65 @@
 #ifndef PERIDIGM_NEIGHBORHOODDATA_HPP
 #define PERIDIGM_NEIGHBORHOODDATA_HPP
 
+#include <Teuchos_Assert.hpp>
 #include <string>
 #include <fstream>
+#include <cstring>
 
 namespace PeridigmNS {
 
+//! Read-only view of the neighbors of a single owned point in the CSR bond topology.
+class NeighborRange {
+
+public:
+
+  NeighborRange(const int* begin, const int* end, int bondOffset)
+    : m_begin(begin), m_end(end), m_bondOffset(bondOffset) {}
+
+  const int* begin() const { return m_begin; }
+
+  const int* end() const { return m_end; }
+
+  int size() const { return static_cast<int>(m_end - m_begin); }
+
+  int operator[](int i) const { return m_begin[i]; }
+
+  //! Index of the first bond of this point in per-bond (bond map) data.
+  int bondOffset() const { return m_bondOffset; }
+
+private:
+  const int* m_begin;
+  const int* m_end;
+  int m_bondOffset;
+};
+
+//! Neighborhood storage.
+/*!
+ *  The neighbor list is stored in the count-prefixed format [numNeigh, id, id, ..., numNeigh, id, ...],
+ *  with NeighborhoodPtr() giving the index of each point's count.  Calling BuildCSR() after the list has
+ *  been filled creates a compressed-sparse-row copy (RowOffsets(), ColumnIds()) that allows random access
+ *  to the bonds of any point.  Per-bond data (Bond_Damage and other bond map vectors) is laid out in the
+ *  same order as the neighbor list, so RowOffsets()[i] is also the index of point i's first bond.
+ */
 class NeighborhoodData {
 
 public:
 
   NeighborhoodData()
-    : numOwnedPoints(0), ownedIDs(0), neighborhoodListSize(0), neighborhoodList(0), neighborhoodPtr(0) {}
+    : numOwnedPoints(0), ownedIDs(0), neighborhoodListSize(0), neighborhoodList(0), neighborhoodPtr(0),
+      rowOffsets(0), columnIds(0) {}
 
   NeighborhoodData(const NeighborhoodData& other)
-    : numOwnedPoints(0), ownedIDs(0), neighborhoodListSize(0), neighborhoodList(0), neighborhoodPtr(0)
+    : numOwnedPoints(0), ownedIDs(0), neighborhoodListSize(0), neighborhoodList(0), neighborhoodPtr(0),
+      rowOffsets(0), columnIds(0)
   {
     SetNumOwned(other.NumOwnedPoints());
     SetNeighborhoodListSize(other.NeighborhoodListSize());
     memcpy(ownedIDs, other.ownedIDs, numOwnedPoints*sizeof(int));
     memcpy(neighborhoodPtr, other.neighborhoodPtr, numOwnedPoints*sizeof(int));
     memcpy(neighborhoodList, other.neighborhoodList, neighborhoodListSize*sizeof(int));
+    if(other.HasCSR())
+      BuildCSR();
   }
 
   ~NeighborhoodData(){
@@ -77,6 +116,7 @@ public:
 	  delete[] neighborhoodList;
     if(neighborhoodPtr != 0)
       delete[] neighborhoodPtr;
+    ClearCSR();
   }
 
   void SetNumOwned(int numOwned){
@@ -87,6 +127,7 @@ public:
     if(neighborhoodPtr != 0)
       delete[] neighborhoodPtr;
     neighborhoodPtr = new int[numOwned];
+    ClearCSR();
   }
 
   void SetNeighborhoodListSize(int neighborhoodSize){
@@ -94,6 +135,7 @@ public:
 	if(neighborhoodList != 0)
 	  delete[] neighborhoodList;
 	neighborhoodList = new int[neighborhoodListSize];
+    ClearCSR();
   }
 
   int NumOwnedPoints() const{
@@ -116,9 +158,62 @@ public:
 	return neighborhoodList;
   }
 
+  //! Builds the CSR bond topology from the neighbor list; must be called again if the list is modified.
+  void BuildCSR(){
+    ClearCSR();
+    rowOffsets = new int[numOwnedPoints + 1];
+    columnIds = new int[neighborhoodListSize - numOwnedPoints > 0 ? neighborhoodListSize - numOwnedPoints : 1];
+    int neighborhoodListIndex = 0;
+    rowOffsets[0] = 0;
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      memcpy(columnIds + rowOffsets[i], neighborhoodList + neighborhoodListIndex, numNeighbors*sizeof(int));
+      neighborhoodListIndex += numNeighbors;
+      rowOffsets[i+1] = rowOffsets[i] + numNeighbors;
+    }
+  }
+
+  bool HasCSR() const{
+    return rowOffsets != 0;
+  }
+
+  //! CSR row offsets (length NumOwnedPoints()+1), also the offsets into per-bond data.
+  const int* RowOffsets() const{
+    return rowOffsets;
+  }
+
+  //! CSR column ids, the neighbor local ids of all owned points concatenated.
+  const int* ColumnIds() const{
+    return columnIds;
+  }
+
+  int NumBonds() const{
+    return rowOffsets == 0 ? neighborhoodListSize - numOwnedPoints : rowOffsets[numOwnedPoints];
+  }
+
+  //! Number of neighbors of owned point i, requires BuildCSR().
+  int NumNeighbors(int i) const{
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(rowOffsets == 0, "**** Error:  NeighborhoodData::NumNeighbors(), BuildCSR() has not been called.\n");
+    return rowOffsets[i+1] - rowOffsets[i];
+  }
+
+  //! Index of the first bond of owned point i in per-bond data, requires BuildCSR().
+  int BondOffset(int i) const{
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(rowOffsets == 0, "**** Error:  NeighborhoodData::BondOffset(), BuildCSR() has not been called.\n");
+    return rowOffsets[i];
+  }
+
+  //! Neighbors of owned point i, requires BuildCSR().
+  NeighborRange Neighbors(int i) const{
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(rowOffsets == 0, "**** Error:  NeighborhoodData::Neighbors(), BuildCSR() has not been called.\n");
+    return NeighborRange(columnIds + rowOffsets[i], columnIds + rowOffsets[i+1], rowOffsets[i]);
+  }
+
   double memorySize() const{
     int sizeInBytes =
-      (2*numOwnedPoints + neighborhoodListSize + 2)*sizeof(int) + 3*sizeof(int*);
+      (2*numOwnedPoints + neighborhoodListSize + 2)*sizeof(int) + 5*sizeof(int*);
+    if(rowOffsets != 0)
+      sizeInBytes += (numOwnedPoints + 1 + NumBonds())*sizeof(int);
     double sizeInMegabytes = sizeInBytes/1048576.0;
     return sizeInMegabytes;
   }
@@ -140,11 +235,23 @@ public:
   }
 
 protected:
+
+  void ClearCSR(){
+    if(rowOffsets != 0)
+      delete[] rowOffsets;
+    rowOffsets = 0;
+    if(columnIds != 0)
+      delete[] columnIds;
+    columnIds = 0;
+  }
+
   int numOwnedPoints;
   int* ownedIDs;
   int neighborhoodListSize;
   int* neighborhoodList;
   int* neighborhoodPtr;
+  int* rowOffsets;
+  int* columnIds;
 };
 
 }
@@ -0,0 +1,189 @@
+/*! \file Peridigm_NeighborhoodWorkspace.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_Assert.hpp>
+#include <algorithm>
+#include "Peridigm_NeighborhoodWorkspace.hpp"
+#include "Peridigm_Field.hpp"
+
+using namespace std;
+
+void PeridigmNS::NeighborhoodWorkspace::allocate(int numOwnedPoints, const int* neighborhoodList_, vector<int> fieldIds_)
+{
+  int maxNeighbors = 0;
+  int neighborhoodListIndex = 0;
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+    int numNeighbors = neighborhoodList_[neighborhoodListIndex];
+    maxNeighbors = max(maxNeighbors, numNeighbors);
+    neighborhoodListIndex += numNeighbors + 1;
+  }
+  allocate(maxNeighbors, fieldIds_);
+}
+
+void PeridigmNS::NeighborhoodWorkspace::allocate(int maxNumNeighbors_, vector<int> fieldIds_)
+{
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+
+  // Global data is shared by all DataManagers, so only point and bond data are held by the workspace
+  vector<int> localFieldIds;
+  for(unsigned int i=0 ; i<fieldIds_.size() ; ++i){
+    if(!fieldManager.isGlobalSpec(fieldIds_[i]))
+      localFieldIds.push_back(fieldIds_[i]);
+  }
+  sort(localFieldIds.begin(), localFieldIds.end());
+  localFieldIds.erase(unique(localFieldIds.begin(), localFieldIds.end()), localFieldIds.end());
+
+  if(!dataManager.is_null() && maxNumNeighbors_ <= maxNumNeighbors && localFieldIds == fieldIds)
+    return;
+
+  maxNumNeighbors = max(maxNumNeighbors_, maxNumNeighbors);
+  fieldIds = localFieldIds;
+  numPoints = 0;
+
+  int capacity = maxNumNeighbors + 1;
+  globalIDs.resize(capacity);
+  for(int i=0 ; i<capacity ; ++i)
+    globalIDs[i] = i;
+  oneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(capacity, capacity, &globalIDs[0], 1, 0, serialComm));
+  threeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(capacity, capacity, &globalIDs[0], 3, 0, serialComm));
+  bondMap = Teuchos::rcp(new Epetra_BlockMap(1, 1, &globalIDs[0], max(maxNumNeighbors, 1), 0, serialComm));
+
+  dataManager = Teuchos::rcp(new PeridigmNS::DataManager);
+  dataManager->setMaps(Teuchos::RCP<const Epetra_BlockMap>(),
+                       oneDimensionalMap,
+                       Teuchos::RCP<const Epetra_BlockMap>(),
+                       threeDimensionalMap,
+                       bondMap);
+  dataManager->allocateData(fieldIds);
+
+  pointFields.clear();
+  bondFields.clear();
+  for(unsigned int i=0 ; i<fieldIds.size() ; ++i){
+    PeridigmNS::FieldSpec spec = fieldManager.getFieldSpec(fieldIds[i]);
+    vector< pair<int, PeridigmField::Step> >& fields = (spec.getRelation() == PeridigmField::BOND) ? bondFields : pointFields;
+    if(spec.getTemporal() == PeridigmField::CONSTANT){
+      fields.push_back(make_pair(fieldIds[i], PeridigmField::STEP_NONE));
+    }
+    else{
+      fields.push_back(make_pair(fieldIds[i], PeridigmField::STEP_N));
+      fields.push_back(make_pair(fieldIds[i], PeridigmField::STEP_NP1));
+    }
+  }
+
+  // The neighborhood list and owned IDs do not change from point to point, other than the number of neighbors
+  neighborhoodList.resize(capacity);
+  neighborhoodList[0] = 0;
+  for(int i=1 ; i<capacity ; ++i)
+    neighborhoodList[i] = i;
+  ownedIDs.assign(1, 0);
+  sourceLIDs.reserve(capacity);
+}
+
+void PeridigmNS::NeighborhoodWorkspace::fill(PeridigmNS::DataManager& source, int ownedID, int numNeighbors, const int* neighbors)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(dataManager.is_null(), "**** NeighborhoodWorkspace::fill() called prior to allocate().\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(numNeighbors > maxNumNeighbors, "**** NeighborhoodWorkspace::fill() called with a neighborhood larger than the allocated workspace.\n");
+
+  int numPreviousPoints = numPoints;
+  numPoints = numNeighbors + 1;
+  neighborhoodList[0] = numNeighbors;
+
+  const Epetra_BlockMap& ownedMap = *source.getOwnedScalarPointMap();
+  const Epetra_BlockMap& overlapMap = *source.getOverlapScalarPointMap();
+  int globalID = ownedMap.GID(ownedID);
+  globalIDs[0] = globalID;
+  sourceLIDs.resize(numPoints);
+  sourceLIDs[0] = overlapMap.LID(globalID);
+  for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
+    globalIDs[iNID+1] = overlapMap.GID(neighbors[iNID]);
+    sourceLIDs[iNID+1] = neighbors[iNID];
+  }
+
+  for(unsigned int i=0 ; i<pointFields.size() ; ++i){
+    const Epetra_Vector& sourceVector = *source.getData(pointFields[i].first, pointFields[i].second);
+    Epetra_Vector& targetVector = *dataManager->getData(pointFields[i].first, pointFields[i].second);
+    copyElements(sourceVector, targetVector, sourceLIDs, numPreviousPoints);
+  }
+
+  // The bonds of the point are stored contiguously in the source's single bond element for that point;
+  // step N values the source stores in single precision are copied into the double-precision workspace
+  for(unsigned int i=0 ; i<bondFields.size() ; ++i){
+    bool singlePrecision = bondFields[i].second == PeridigmField::STEP_N && source.hasSinglePrecisionData(bondFields[i].first);
+    const Epetra_Vector& sourceVector = *source.getData(bondFields[i].first, singlePrecision ? PeridigmField::STEP_NP1 : bondFields[i].second);
+    Epetra_Vector& targetVector = *dataManager->getData(bondFields[i].first, bondFields[i].second);
+    const Epetra_BlockMap& sourceBondMap = sourceVector.Map();
+    int sourceLID = sourceBondMap.LID(globalID);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(sourceLID == -1 || sourceBondMap.ElementSize(sourceLID) != numNeighbors,
+                                "**** NeighborhoodWorkspace::fill() called with incompatible bond data.\n");
+    if(singlePrecision){
+      const float* sourceValues = source.getSinglePrecisionData(bondFields[i].first) + sourceBondMap.FirstPointInElement(sourceLID);
+      for(int iBond=0 ; iBond<numNeighbors ; ++iBond)
+        targetVector[iBond] = sourceValues[iBond];
+    }
+    else{
+      const double* sourceValues = &sourceVector[sourceBondMap.FirstPointInElement(sourceLID)];
+      for(int iBond=0 ; iBond<numNeighbors ; ++iBond)
+        targetVector[iBond] = sourceValues[iBond];
+    }
+    for(int iBond=numNeighbors ; iBond<numPreviousPoints-1 ; ++iBond)
+      targetVector[iBond] = 0.0;
+  }
+}
+
+void PeridigmNS::NeighborhoodWorkspace::copyElements(const Epetra_Vector& source, Epetra_Vector& target, const vector<int>& sourceLIDs_, int numPreviousPoints)
+{
+  int elementSize = target.Map().ElementSize();
+  int numElements = (int)sourceLIDs_.size();
+  for(int i=0 ; i<numElements ; ++i){
+    const double* sourceValues = &source[elementSize*sourceLIDs_[i]];
+    double* targetValues = &target[elementSize*i];
+    for(int j=0 ; j<elementSize ; ++j)
+      targetValues[j] = sourceValues[j];
+  }
+  for(int i=elementSize*numElements ; i<elementSize*numPreviousPoints ; ++i)
+    target[i] = 0.0;
+}
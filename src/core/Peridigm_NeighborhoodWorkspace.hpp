@@ -0,0 +1,153 @@
+/*! \file Peridigm_NeighborhoodWorkspace.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_NEIGHBORHOODWORKSPACE_HPP
+#define PERIDIGM_NEIGHBORHOODWORKSPACE_HPP
+
+#include <Teuchos_RCP.hpp>
+#include <Epetra_BlockMap.h>
+#include <Epetra_SerialComm.h>
+#include <vector>
+#include "Peridigm_DataManager.hpp"
+
+namespace PeridigmNS {
+
+/*! \brief Reusable DataManager holding a single point and its neighbors.
+ *
+ * Jacobian evaluation works on one neighborhood at a time:  the point is copied into a small DataManager
+ * as its only owned point, followed by its neighbors, and the material model is evaluated on that copy.
+ * The NeighborhoodWorkspace allocates this DataManager once, sized to the largest neighborhood in the block
+ * and restricted to a given list of fields, and refills it for each point.  Local ID zero is the point itself
+ * and local IDs 1 through numNeighbors are its neighbors; slots beyond the current neighborhood are zero.
+ */
+class NeighborhoodWorkspace {
+
+public:
+
+  //! Constructor.
+  NeighborhoodWorkspace() : maxNumNeighbors(-1), numPoints(0) {}
+
+  //! Destructor.
+  ~NeighborhoodWorkspace(){}
+
+  //! Allocates storage for neighborhoods of up to maxNumNeighbors neighbors; a no-op if the workspace is already large enough for the same fields.
+  void allocate(int maxNumNeighbors_, std::vector<int> fieldIds_);
+
+  //! Allocates storage for the largest neighborhood in the given neighborhood list.
+  void allocate(int numOwnedPoints, const int* neighborhoodList, std::vector<int> fieldIds_);
+
+  /** \brief Copies the data for an owned point and its neighbors from the source DataManager.
+   *
+   *  The ownedID is a local ID in the source's owned point map; the neighbors are local IDs in its overlap map.
+   *  Only the fields given to allocate() are copied.
+   **/
+  void fill(PeridigmNS::DataManager& source, int ownedID, int numNeighbors, const int* neighbors);
+
+  //! Returns the DataManager holding the current neighborhood.
+  PeridigmNS::DataManager& getDataManager() { return *dataManager; }
+
+  //! Returns the neighborhood list for the current neighborhood, in the format expected by the material models.
+  const int* getNeighborhoodList() const { return &neighborhoodList[0]; }
+
+  //! Returns the owned IDs for the current neighborhood, which is always the single local ID zero.
+  const int* getOwnedIDs() const { return &ownedIDs[0]; }
+
+  //! Returns the global IDs of the point and its neighbors, the point first.
+  const int* getGlobalIDs() const { return &globalIDs[0]; }
+
+  //! Returns the number of points in the current neighborhood, including the point itself.
+  int getNumPoints() const { return numPoints; }
+
+private:
+
+  //! Copies the elements listed in sourceLIDs into the first elements of target; entries past them up to the previous fill are zeroed.
+  void copyElements(const Epetra_Vector& source, Epetra_Vector& target, const std::vector<int>& sourceLIDs, int numPreviousPoints);
+
+  //! Largest neighborhood the workspace can hold.
+  int maxNumNeighbors;
+
+  //! Number of points in the current neighborhood, including the point itself.
+  int numPoints;
+
+  //! Field ids held by the workspace.
+  std::vector<int> fieldIds;
+
+  //! Field id and step pairs for point data.
+  std::vector< std::pair<int, PeridigmField::Step> > pointFields;
+
+  //! Field id and step pairs for bond data.
+  std::vector< std::pair<int, PeridigmField::Step> > bondFields;
+
+  //! Comm used for the workspace maps.
+  Epetra_SerialComm serialComm;
+
+  //! @name Maps
+  //@{
+  Teuchos::RCP<Epetra_BlockMap> oneDimensionalMap;
+  Teuchos::RCP<Epetra_BlockMap> threeDimensionalMap;
+  Teuchos::RCP<Epetra_BlockMap> bondMap;
+  //@}
+
+  //! DataManager holding the current neighborhood.
+  Teuchos::RCP<PeridigmNS::DataManager> dataManager;
+
+  //! Neighborhood list for the current neighborhood.
+  std::vector<int> neighborhoodList;
+
+  //! Owned IDs for the current neighborhood.
+  std::vector<int> ownedIDs;
+
+  //! Global IDs for the current neighborhood.
+  std::vector<int> globalIDs;
+
+  //! Overlap local IDs in the source DataManager for the current neighborhood.
+  std::vector<int> sourceLIDs;
+};
+
+}
+
+#endif // PERIDIGM_NEIGHBORHOODWORKSPACE_HPP
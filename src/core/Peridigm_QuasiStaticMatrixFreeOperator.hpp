@@ -0,0 +1,129 @@
+/*! \file Peridigm_QuasiStaticMatrixFreeOperator.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_QUASISTATICMATRIXFREEOPERATOR_HPP
+#define PERIDIGM_QUASISTATICMATRIXFREEOPERATOR_HPP
+
+#include <Epetra_Operator.h>
+#include <Epetra_Map.h>
+#include <Epetra_Vector.h>
+#include <Teuchos_RCP.hpp>
+
+namespace PeridigmNS {
+
+class Peridigm;
+
+/*! \brief Jacobian-free approximation of the quasi-static tangent.
+ *
+ * Applies the (negated) tangent to a vector by differencing the quasi-static residual,
+ * -(R(deltaU + epsilon*w) - R(deltaU))/epsilon, so that the Belos solvers in Peridigm::executeQuasiStatic()
+ * can run without assembling the global tangent.  Rows associated with kinematic boundary conditions
+ * behave as the negated identity, consistent with the assembled tangent after
+ * applyKinematicBC_InsertZerosAndSetDiagonal() and Scale(-1.0).
+ */
+class QuasiStaticMatrixFreeOperator : public Epetra_Operator {
+
+public:
+
+  //! Constructor; baseResidual is the residual at the current iterate and must be kept current by the caller.
+  QuasiStaticMatrixFreeOperator(Peridigm* peridigm_,
+                                Teuchos::RCP<const Epetra_Vector> baseResidual_,
+                                double lambda_);
+
+  //! Destructor.
+  virtual ~QuasiStaticMatrixFreeOperator(){}
+
+  //! Transpose application is not supported.
+  int SetUseTranspose(bool UseTranspose);
+
+  //! Applies the finite-difference tangent to each vector in X.
+  int Apply(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const;
+
+  //! Not supported.
+  int ApplyInverse(const Epetra_MultiVector& X, Epetra_MultiVector& Y) const { return -1; }
+
+  //! Not supported.
+  double NormInf() const { return 0.0; }
+
+  const char* Label() const { return "Peridigm Quasi-Static Matrix-Free Operator"; }
+
+  bool UseTranspose() const { return false; }
+
+  bool HasNormInf() const { return false; }
+
+  const Epetra_Comm& Comm() const { return baseResidual->Comm(); }
+
+  const Epetra_Map& OperatorDomainMap() const { return map; }
+
+  const Epetra_Map& OperatorRangeMap() const { return map; }
+
+protected:
+
+  //! The Peridigm object whose residual is differenced.
+  Peridigm* peridigm;
+
+  //! Residual at the point of linearization.
+  Teuchos::RCP<const Epetra_Vector> baseResidual;
+
+  //! Relative perturbation size.
+  double lambda;
+
+  //! Map for the domain and range.
+  Epetra_Map map;
+
+private:
+
+  //! Default constructor with no implementation.
+  QuasiStaticMatrixFreeOperator();
+
+  //! Copy constructor with no implementation.
+  QuasiStaticMatrixFreeOperator(const QuasiStaticMatrixFreeOperator&);
+};
+
+}
+
+#endif // PERIDIGM_QUASISTATICMATRIXFREEOPERATOR_HPP
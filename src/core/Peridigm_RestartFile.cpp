@@ -0,0 +1,447 @@
+/*! \file Peridigm_RestartFile.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_RestartFile.hpp"
+#include <Epetra_Import.h>
+#include <Teuchos_Assert.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+using namespace std;
+
+namespace {
+
+  const char magic[8] = {'P','D','R','E','S','T','R','T'};
+  const unsigned int byteOrderTag = 0x01020304;
+
+  template<class T>
+  void writeValue(ostream& stream, const T& value){
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template<class T>
+  void readValue(istream& stream, T& value){
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  template<class T>
+  void appendBytes(vector<char>& buffer, const T* data, size_t count){
+    const char* bytes = reinterpret_cast<const char*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + count*sizeof(T));
+  }
+}
+
+unsigned long long PeridigmNS::RestartFile::checksum(const char* data, std::size_t size)
+{
+  unsigned long long hash = 14695981039346656037ULL;
+  for(size_t i=0 ; i<size ; ++i){
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+// Runs of three to 130 identical bytes are stored as a control byte 0x80+(length-3) followed
+// by the byte; everything else is stored as a control byte (length-1) followed by up to 128
+// literal bytes.
+void PeridigmNS::RestartFile::compress(const std::vector<char>& raw, std::vector<char>& packed)
+{
+  packed.clear();
+  packed.reserve(raw.size()/2);
+  size_t n = raw.size();
+  size_t i = 0;
+  while(i < n){
+    size_t run = 1;
+    while(i+run < n && run < 130 && raw[i+run] == raw[i])
+      run++;
+    if(run >= 3){
+      packed.push_back(static_cast<char>(0x80 + (run-3)));
+      packed.push_back(raw[i]);
+      i += run;
+      continue;
+    }
+    size_t start = i;
+    while(i < n && i-start < 128){
+      if(i+2 < n && raw[i] == raw[i+1] && raw[i] == raw[i+2])
+        break;
+      i++;
+    }
+    packed.push_back(static_cast<char>(i-start-1));
+    packed.insert(packed.end(), raw.begin()+start, raw.begin()+i);
+  }
+}
+
+void PeridigmNS::RestartFile::decompress(const std::vector<char>& packed, std::vector<char>& raw, std::size_t rawSize)
+{
+  raw.clear();
+  raw.reserve(rawSize);
+  size_t n = packed.size();
+  size_t i = 0;
+  while(i < n){
+    unsigned char control = static_cast<unsigned char>(packed[i++]);
+    if(control & 0x80){
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(i >= n, "**** Error:  RestartFile::decompress(), truncated run.\n");
+      raw.insert(raw.end(), (control & 0x7f) + 3, packed[i++]);
+    }
+    else{
+      size_t length = control + 1;
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(i+length > n, "**** Error:  RestartFile::decompress(), truncated literal.\n");
+      raw.insert(raw.end(), packed.begin()+i, packed.begin()+i+length);
+      i += length;
+    }
+  }
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(raw.size() != rawSize, "**** Error:  RestartFile::decompress(), decoded size does not match the record header.\n");
+}
+
+std::string PeridigmNS::RestartFile::rankFileName(const std::string& directory, int rank)
+{
+  char fileName[32];
+  sprintf(fileName, "rank-%06d.bin", rank);
+  return directory + "/" + fileName;
+}
+
+std::string PeridigmNS::RestartFile::indexFileName(const std::string& directory)
+{
+  return directory + "/restart.index";
+}
+
+PeridigmNS::RestartWriter::RestartWriter(const Epetra_Comm& comm, const std::string& directory_, bool compress)
+  : myPID(comm.MyPID()), numProcs(comm.NumProc()), directory(directory_), compressRecords(compress)
+{
+}
+
+PeridigmNS::RestartWriter::~RestartWriter()
+{
+  if(writerThread.joinable())
+    writerThread.join();
+  if(!errorMessage.empty())
+    cerr << errorMessage << endl;
+}
+
+void PeridigmNS::RestartWriter::add(const std::string& name, const Epetra_MultiVector& data, const Epetra_BlockMap* ownedMap)
+{
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(writerThread.joinable(), "**** Error:  RestartWriter::add() called while a write is pending.\n");
+
+  const Epetra_BlockMap& map = data.Map();
+  Record record;
+  record.name = name;
+  record.numVectors = data.NumVectors();
+
+  vector<int> lids;
+  for(int lid=0 ; lid<map.NumMyElements() ; ++lid){
+    int globalId = map.GID(lid);
+    if(ownedMap == 0 || ownedMap->MyGID(globalId)){
+      lids.push_back(lid);
+      record.globalIds.push_back(globalId);
+      record.elementSizes.push_back(map.ElementSize(lid));
+    }
+  }
+
+  // Values are stored vector by vector
+  for(int iVec=0 ; iVec<record.numVectors ; ++iVec){
+    const double* values = data[iVec];
+    for(unsigned int i=0 ; i<lids.size() ; ++i){
+      int firstPoint = map.FirstPointInElement(lids[i]);
+      record.values.insert(record.values.end(), values + firstPoint, values + firstPoint + record.elementSizes[i]);
+    }
+  }
+
+  records.push_back(record);
+}
+
+void PeridigmNS::RestartWriter::write(bool asynchronous)
+{
+  wait();
+
+  if(myPID == 0){
+    ofstream indexFile(RestartFile::indexFileName(directory).c_str());
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!indexFile, "**** Error:  Unable to open restart index in " + directory + ".\n");
+    indexFile << "Peridigm binary restart" << endl;
+    indexFile << "Version " << RestartFile::version << endl;
+    indexFile << "Ranks " << numProcs << endl;
+    indexFile << "Compressed " << (compressRecords ? 1 : 0) << endl;
+  }
+
+  if(asynchronous){
+    writerThread = std::thread([this](){ errorMessage = writeRankFile(); });
+  }
+  else{
+    errorMessage = writeRankFile();
+    wait();
+  }
+}
+
+void PeridigmNS::RestartWriter::wait()
+{
+  if(writerThread.joinable())
+    writerThread.join();
+  string message;
+  message.swap(errorMessage);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!message.empty(), message);
+}
+
+std::string PeridigmNS::RestartWriter::writeRankFile()
+{
+  // The file is written under a temporary name and renamed once complete, so that an
+  // interrupted write never leaves a file that looks like a valid restart
+  string fileName = RestartFile::rankFileName(directory, myPID);
+  string temporaryFileName = fileName + ".tmp";
+
+  ofstream file(temporaryFileName.c_str(), ios::binary);
+  if(!file)
+    return "**** Error:  Unable to open restart file " + temporaryFileName + ".\n";
+
+  file.write(magic, sizeof(magic));
+  writeValue(file, byteOrderTag);
+  writeValue(file, RestartFile::version);
+  writeValue(file, myPID);
+  writeValue(file, numProcs);
+  writeValue(file, static_cast<unsigned int>(records.size()));
+
+  vector<char> raw, packed;
+  for(unsigned int iRecord=0 ; iRecord<records.size() ; ++iRecord){
+    Record& record = records[iRecord];
+
+    raw.clear();
+    appendBytes(raw, record.globalIds.data(), record.globalIds.size());
+    appendBytes(raw, record.elementSizes.data(), record.elementSizes.size());
+    appendBytes(raw, record.values.data(), record.values.size());
+
+    unsigned long long rawSize = raw.size();
+    unsigned long long checksum = RestartFile::checksum(raw.data(), raw.size());
+    unsigned int compressed = 0;
+    const vector<char>* stored = &raw;
+    if(compressRecords){
+      RestartFile::compress(raw, packed);
+      if(packed.size() < raw.size()){
+        compressed = 1;
+        stored = &packed;
+      }
+    }
+    unsigned long long storedSize = stored->size();
+    long long numPoints = record.numVectors > 0 ? record.values.size()/record.numVectors : 0;
+
+    writeValue(file, static_cast<unsigned int>(record.name.size()));
+    file.write(record.name.c_str(), record.name.size());
+    writeValue(file, record.numVectors);
+    writeValue(file, static_cast<int>(record.globalIds.size()));
+    writeValue(file, numPoints);
+    writeValue(file, compressed);
+    writeValue(file, rawSize);
+    writeValue(file, storedSize);
+    writeValue(file, checksum);
+    file.write(stored->data(), stored->size());
+
+    // Release the copy as soon as it is on disk
+    vector<int>().swap(record.globalIds);
+    vector<int>().swap(record.elementSizes);
+    vector<double>().swap(record.values);
+  }
+
+  file.close();
+  if(!file)
+    return "**** Error:  Failed writing restart file " + temporaryFileName + ".\n";
+  if(rename(temporaryFileName.c_str(), fileName.c_str()) != 0)
+    return "**** Error:  Unable to rename restart file " + temporaryFileName + ".\n";
+
+  records.clear();
+  return "";
+}
+
+PeridigmNS::RestartReader::RestartReader(const Epetra_Comm& comm_, const std::string& directory_)
+  : comm(comm_), directory(directory_)
+{
+  // Errors are gathered before throwing, because a rank that throws alone would leave the
+  // others waiting in the collective calls that follow
+  string errorMessage;
+  try{
+    scanRankFiles();
+  }
+  catch(const std::exception& e){
+    errorMessage = e.what();
+  }
+  checkAllRanks(errorMessage);
+}
+
+void PeridigmNS::RestartReader::checkAllRanks(const std::string& errorMessage) const
+{
+  int localOk = errorMessage.empty() ? 1 : 0;
+  int globalOk(0);
+  comm.MinAll(&localOk, &globalOk, 1);
+  if(globalOk == 1)
+    return;
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!errorMessage.empty(), errorMessage);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  Reading restart " + directory + " failed on another rank.\n");
+}
+
+void PeridigmNS::RestartReader::scanRankFiles()
+{
+  string indexName = RestartFile::indexFileName(directory);
+  ifstream indexFile(indexName.c_str());
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!indexFile, "**** Error:  Unable to open restart index " + indexName + ".\n");
+
+  string line, key;
+  unsigned int indexVersion(0);
+  int numWriters(0);
+  getline(indexFile, line);
+  indexFile >> key >> indexVersion;
+  indexFile >> key >> numWriters;
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(indexVersion != RestartFile::version,
+                              "**** Error:  Restart " + directory + " was written with an incompatible restart format version.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(numWriters < 1, "**** Error:  Invalid restart index " + indexName + ".\n");
+
+  for(int writer=comm.MyPID() ; writer<numWriters ; writer+=comm.NumProc()){
+    string fileName = RestartFile::rankFileName(directory, writer);
+    ifstream file(fileName.c_str(), ios::binary);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!file, "**** Error:  Unable to open restart file " + fileName + ", the restart is incomplete.\n");
+
+    char fileMagic[sizeof(magic)];
+    unsigned int fileByteOrderTag(0), fileVersion(0), numRecords(0);
+    int fileRank(-1), fileNumRanks(-1);
+    file.read(fileMagic, sizeof(fileMagic));
+    readValue(file, fileByteOrderTag);
+    readValue(file, fileVersion);
+    readValue(file, fileRank);
+    readValue(file, fileNumRanks);
+    readValue(file, numRecords);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!file || memcmp(fileMagic, magic, sizeof(magic)) != 0,
+                                "**** Error:  " + fileName + " is not a Peridigm restart file.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(fileByteOrderTag != byteOrderTag,
+                                "**** Error:  " + fileName + " was written on a machine with a different byte order.\n");
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(fileVersion != RestartFile::version || fileRank != writer || fileNumRanks != numWriters,
+                                "**** Error:  " + fileName + " does not match the restart index.\n");
+
+    for(unsigned int iRecord=0 ; iRecord<numRecords ; ++iRecord){
+      unsigned int nameLength(0), compressed(0);
+      readValue(file, nameLength);
+      string name(nameLength, ' ');
+      file.read(&name[0], nameLength);
+      RecordLocation location;
+      location.fileName = fileName;
+      readValue(file, location.numVectors);
+      readValue(file, location.numElements);
+      readValue(file, location.numPoints);
+      readValue(file, compressed);
+      readValue(file, location.rawSize);
+      readValue(file, location.storedSize);
+      readValue(file, location.checksum);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!file, "**** Error:  Truncated restart file " + fileName + ".\n");
+      location.compressed = (compressed != 0);
+      location.offset = file.tellg();
+      records.insert(make_pair(name, location));
+      file.seekg(location.storedSize, ios::cur);
+    }
+  }
+}
+
+void PeridigmNS::RestartReader::readRecords(const std::string& name,
+                                            int numVectors,
+                                            std::vector<int>& globalIds,
+                                            std::vector<int>& elementSizes,
+                                            std::vector< std::vector<double> >& values) const
+{
+  vector<char> stored, raw;
+  pair<multimap<string, RecordLocation>::const_iterator, multimap<string, RecordLocation>::const_iterator> range = records.equal_range(name);
+  for(multimap<string, RecordLocation>::const_iterator it=range.first ; it!=range.second ; ++it){
+    const RecordLocation& location = it->second;
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(location.numVectors != numVectors,
+                                "**** Error:  Restart record " + name + " in " + location.fileName + " has an unexpected number of vectors.\n");
+
+    ifstream file(location.fileName.c_str(), ios::binary);
+    file.seekg(location.offset);
+    stored.resize(location.storedSize);
+    file.read(stored.data(), stored.size());
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(!file, "**** Error:  Truncated restart file " + location.fileName + ".\n");
+    if(location.compressed)
+      RestartFile::decompress(stored, raw, location.rawSize);
+    else
+      raw.swap(stored);
+
+    size_t expectedSize = 2*location.numElements*sizeof(int) + location.numPoints*numVectors*sizeof(double);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(raw.size() != location.rawSize || raw.size() != expectedSize ||
+                                RestartFile::checksum(raw.data(), raw.size()) != location.checksum,
+                                "**** Error:  Checksum mismatch for restart record " + name + " in " + location.fileName + ".\n");
+
+    const int* recordGlobalIds = reinterpret_cast<const int*>(raw.data());
+    const int* recordElementSizes = recordGlobalIds + location.numElements;
+    const double* recordValues = reinterpret_cast<const double*>(recordElementSizes + location.numElements);
+    globalIds.insert(globalIds.end(), recordGlobalIds, recordGlobalIds + location.numElements);
+    elementSizes.insert(elementSizes.end(), recordElementSizes, recordElementSizes + location.numElements);
+    for(int iVec=0 ; iVec<numVectors ; ++iVec)
+      values[iVec].insert(values[iVec].end(), recordValues + iVec*location.numPoints, recordValues + (iVec+1)*location.numPoints);
+  }
+}
+
+void PeridigmNS::RestartReader::read(const std::string& name, Epetra_MultiVector& target)
+{
+  int numVectors = target.NumVectors();
+  vector<int> globalIds, elementSizes;
+  vector< vector<double> > values(numVectors);
+
+  string errorMessage;
+  try{
+    readRecords(name, numVectors, globalIds, elementSizes, values);
+  }
+  catch(const std::exception& e){
+    errorMessage = e.what();
+  }
+  checkAllRanks(errorMessage);
+
+  // Move the stored entries onto the target map
+  const Epetra_BlockMap& targetMap = target.Map();
+  Epetra_BlockMap sourceMap(-1, static_cast<int>(globalIds.size()), globalIds.data(), elementSizes.data(), targetMap.IndexBase(), comm);
+  Epetra_MultiVector source(sourceMap, numVectors);
+  for(int iVec=0 ; iVec<numVectors ; ++iVec){
+    double* sourceValues = source[iVec];
+    for(unsigned int i=0 ; i<values[iVec].size() ; ++i)
+      sourceValues[i] = values[iVec][i];
+  }
+  Epetra_Import importer(targetMap, sourceMap);
+  target.Import(source, importer, Insert);
+}
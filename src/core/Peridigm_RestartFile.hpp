@@ -0,0 +1,189 @@
+/*! \file Peridigm_RestartFile.hpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#ifndef PERIDIGM_RESTARTFILE_HPP
+#define PERIDIGM_RESTARTFILE_HPP
+
+#include <Epetra_Comm.h>
+#include <Epetra_BlockMap.h>
+#include <Epetra_MultiVector.h>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace PeridigmNS {
+
+/*! \brief Binary restart file format.
+ *
+ * A restart directory contains a text index, restart.index, and one binary file per writing
+ * rank, rank-XXXXXX.bin.  Each rank file holds a header (magic string, byte-order tag,
+ * format version, writing rank, number of writing ranks, number of records) followed by one
+ * record per stored vector.  A record stores the global ids, element sizes and values of the
+ * locally owned entries of an Epetra_MultiVector together with a checksum of that payload, so
+ * that a restart can be read back on any number of ranks by redistributing the stored entries
+ * through an Epetra_Import.
+ */
+namespace RestartFile {
+
+  //! Version of the record layout; files written with a different version are rejected.
+  static const unsigned int version = 1;
+
+  //! Returns the 64-bit FNV-1a checksum of the given bytes.
+  unsigned long long checksum(const char* data, std::size_t size);
+
+  //! Run-length encodes the given bytes.
+  void compress(const std::vector<char>& raw, std::vector<char>& packed);
+
+  //! Decodes bytes produced by compress(); throws if the result does not have the expected size.
+  void decompress(const std::vector<char>& packed, std::vector<char>& raw, std::size_t rawSize);
+
+  //! Name of the file written by the given rank.
+  std::string rankFileName(const std::string& directory, int rank);
+
+  //! Name of the index file.
+  std::string indexFileName(const std::string& directory);
+}
+
+/*! \brief Writes a binary restart.
+ *
+ * Vectors are copied into the writer when they are added, so the solver may continue to
+ * modify them while write() runs in the background.
+ */
+class RestartWriter {
+
+public:
+
+  //! Constructor.
+  RestartWriter(const Epetra_Comm& comm, const std::string& directory, bool compress);
+
+  //! Destructor; waits for a pending asynchronous write.
+  ~RestartWriter();
+
+  //! Copies the locally owned entries of a vector into the writer; if ownedMap is given, only entries whose global id it owns are stored.
+  void add(const std::string& name, const Epetra_MultiVector& data, const Epetra_BlockMap* ownedMap = 0);
+
+  //! Writes the index (rank 0) and this rank's file, in a background thread if asynchronous is true.
+  void write(bool asynchronous);
+
+  //! Blocks until a pending asynchronous write has finished; throws if it failed.
+  void wait();
+
+private:
+
+  //! Private to prohibit copying.
+  RestartWriter(const RestartWriter&);
+
+  //! Private to prohibit copying.
+  RestartWriter& operator=(const RestartWriter&);
+
+  struct Record {
+    std::string name;
+    int numVectors;
+    std::vector<int> globalIds;
+    std::vector<int> elementSizes;
+    std::vector<double> values;
+  };
+
+  //! Serializes the records into this rank's file; returns an error message, empty on success.
+  std::string writeRankFile();
+
+  int myPID;
+  int numProcs;
+  std::string directory;
+  bool compressRecords;
+  std::vector<Record> records;
+  std::thread writerThread;
+  std::string errorMessage;
+};
+
+/*! \brief Reads a binary restart, possibly written on a different number of ranks.
+ *
+ * The rank files are distributed round-robin over the reading ranks; read() then moves the
+ * stored entries onto the map of the target vector with an Epetra_Import.
+ */
+class RestartReader {
+
+public:
+
+  //! Constructor; opens the index and scans the record headers of the rank files assigned to this rank; collective, throws on every rank if any rank finds an error.
+  RestartReader(const Epetra_Comm& comm, const std::string& directory);
+
+  //! Fills the target with the stored vector of the given name; collective, throws on every rank if any rank finds an error.
+  void read(const std::string& name, Epetra_MultiVector& target);
+
+private:
+
+  //! Throws on every rank if the error message is not empty on any rank; collective.
+  void checkAllRanks(const std::string& errorMessage) const;
+
+  //! Scans the record headers of the rank files assigned to this rank.
+  void scanRankFiles();
+
+  //! Reads this rank's part of the given record into the output vectors.
+  void readRecords(const std::string& name, int numVectors, std::vector<int>& globalIds, std::vector<int>& elementSizes, std::vector< std::vector<double> >& values) const;
+
+  struct RecordLocation {
+    std::string fileName;
+    std::streamoff offset;
+    int numVectors;
+    int numElements;
+    long long numPoints;
+    bool compressed;
+    unsigned long long rawSize;
+    unsigned long long storedSize;
+    unsigned long long checksum;
+  };
+
+  const Epetra_Comm& comm;
+  std::string directory;
+  std::multimap<std::string, RecordLocation> records;
+};
+
+}
+
+#endif // PERIDIGM_RESTARTFILE_HPP
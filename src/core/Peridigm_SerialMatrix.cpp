@@ -46,18 +46,18 @@
 //@HEADER
 
 #include <vector>
+#include <algorithm>
 
 #include <Epetra_Import.h>
 #include <Epetra_SerialDenseMatrix.h>
 #include <Teuchos_Exceptions.hpp>
-#include <Teuchos_SerialDenseVector.hpp>
 
 #include "Peridigm_SerialMatrix.hpp"
 
 using namespace std;
 
 PeridigmNS::SerialMatrix::SerialMatrix(Teuchos::RCP<Epetra_FECrsMatrix> epetraFECrsMatrix)
-  : FECrsMatrix(epetraFECrsMatrix)
+  : FECrsMatrix(epetraFECrsMatrix), indicesArePointTriples(false)
 {
 }
 
@@ -81,8 +81,8 @@ void PeridigmNS::SerialMatrix::addValue(int globalRow, int globalCol, double val
 
 void PeridigmNS::SerialMatrix::addValues(int numIndices, const int* globalIndices, const double *const * values)
 {
-  vector<int> localRowIndices(numIndices);
-  vector<int> localColIndices(numIndices);
+  localRowIndices.resize(numIndices);
+  localColIndices.resize(numIndices);
   for(int i=0 ; i<numIndices ; ++i){
     localRowIndices[i] = FECrsMatrix->LRID(globalIndices[i]);
     int localColIndex = FECrsMatrix->LCID(globalIndices[i]);
@@ -90,92 +90,165 @@ void PeridigmNS::SerialMatrix::addValues(int numIndices, const int* globalIndice
     localColIndices[i] = localColIndex;
   }
 
+  // Group the columns into point triples, ordered by local column so that each row can be walked once
+  indicesArePointTriples = FECrsMatrix->Filled() && FECrsMatrix->Sorted() && numIndices%3 == 0;
+  pointColumnOrder.clear();
+  for(int i=0 ; i<numIndices && indicesArePointTriples ; i+=3){
+    indicesArePointTriples = globalIndices[i]%3 == 0 &&
+      globalIndices[i+1] == globalIndices[i]+1 && globalIndices[i+2] == globalIndices[i]+2 &&
+      localColIndices[i+1] == localColIndices[i]+1 && localColIndices[i+2] == localColIndices[i]+2;
+    pointColumnOrder.push_back(i);
+  }
+  if(indicesArePointTriples){
+    const vector<int>& cols = localColIndices;
+    sort(pointColumnOrder.begin(), pointColumnOrder.end(), [&cols](int a, int b){ return cols[a] < cols[b]; });
+  }
+
   for(int iRow=0 ; iRow<numIndices ; ++iRow){
 
-    // If the row is locally owned, then sum into the global tangent with Epetra_CrsMatrix::SumIntoMyValues().
+    // If the row is locally owned, then sum directly into the row's values, or with Epetra_CrsMatrix::SumIntoMyValues()
+    // when the indices are not point triples.
     if(localRowIndices[iRow] != -1){
-      int err = FECrsMatrix->SumIntoMyValues(localRowIndices[iRow], numIndices, values[iRow], &localColIndices[0]);
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::addValues(), SumIntoMyValues() returned nonzero error code.\n");
+      if(!sumIntoMyRowByPointBlocks(localRowIndices[iRow], numIndices, values[iRow])){
+        int err = FECrsMatrix->SumIntoMyValues(localRowIndices[iRow], numIndices, values[iRow], &localColIndices[0]);
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::addValues(), SumIntoMyValues() returned nonzero error code.\n");
+      }
     }
-    // If the row is not locally owned, then sum into the global tangent with Epetra_FECrsMatrix::SumIntoGlobalValues().
-    // This is expensive.
+    // If the row is not locally owned, hold the values until flushOffProcessorValues().
     else{
-      int err = FECrsMatrix->SumIntoGlobalValues(globalIndices[iRow], numIndices, values[iRow], &globalIndices[0]);
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::addValues(), SumIntoGlobalValues() returned nonzero error code.\n");
+      bufferOffProcessorValues(globalIndices[iRow], numIndices, values[iRow], globalIndices);
     }
   }
 }
 
-// This is like the SerialMatrix::addValues routine above, but inserts only the block diagonal values and filters out the rest
-void PeridigmNS::SerialMatrix::addBlockDiagonalValues(int numIndices, const int* globalIndices, const double *const * values)
+bool PeridigmNS::SerialMatrix::sumIntoMyRowByPointBlocks(int localRow, int numIndices, const double* values)
 {
+  if(!indicesArePointTriples)
+    return false;
+
+  int numEntries;
+  double* rowValues;
+  int* rowIndices;
+  int err = FECrsMatrix->ExtractMyRowView(localRow, numEntries, rowValues, rowIndices);
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::addValues(), ExtractMyRowView() returned nonzero error code.\n");
+
+  // Both the row's column indices and the point triples are sorted, so a single pass over the row finds every block
+  int pos = 0;
+  for(unsigned int iPoint=0 ; iPoint<pointColumnOrder.size() ; ++iPoint){
+    int i = pointColumnOrder[iPoint];
+    int col = localColIndices[i];
+    while(pos < numEntries && rowIndices[pos] < col)
+      ++pos;
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(pos+2 >= numEntries || rowIndices[pos] != col || rowIndices[pos+2] != col+2,
+                                "**** PeridigmNS::SerialMatrix::addValues(), entry not present in the matrix graph.\n");
+    rowValues[pos]   += values[i];
+    rowValues[pos+1] += values[i+1];
+    rowValues[pos+2] += values[i+2];
+  }
+  return true;
+}
 
-  // Local row and column indices for each global index
-  vector<int> localRowIndices(numIndices);
-  vector<int> localColIndices(numIndices);
+void PeridigmNS::SerialMatrix::bufferOffProcessorValues(int globalRow, int numIndices, const double* values, const int* globalIndices)
+{
+  OffProcessorEntry entry;
+  entry.row = globalRow;
+  for(int i=0 ; i<numIndices ; ++i){
+    entry.col = globalIndices[i];
+    entry.value = values[i];
+    offProcessorEntries.push_back(entry);
+  }
+}
 
-  // Inverse map that gives index value into globalIndices array for each global index value
-  std::map<int,int> inverseMap;
+void PeridigmNS::SerialMatrix::flushOffProcessorValues()
+{
+  if(offProcessorEntries.empty())
+    return;
+
+  // Combine repeated contributions, then sum each row into the Epetra_FECrsMatrix with a single call
+  sort(offProcessorEntries.begin(), offProcessorEntries.end());
+  vector<int> cols;
+  vector<double> vals;
+  unsigned int i = 0;
+  while(i < offProcessorEntries.size()){
+    int row = offProcessorEntries[i].row;
+    cols.clear();
+    vals.clear();
+    for( ; i<offProcessorEntries.size() && offProcessorEntries[i].row == row ; ++i){
+      if(!cols.empty() && cols.back() == offProcessorEntries[i].col)
+        vals.back() += offProcessorEntries[i].value;
+      else{
+        cols.push_back(offProcessorEntries[i].col);
+        vals.push_back(offProcessorEntries[i].value);
+      }
+    }
+    int err = FECrsMatrix->SumIntoGlobalValues(row, (int)cols.size(), &vals[0], &cols[0]);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::flushOffProcessorValues(), SumIntoGlobalValues() returned nonzero error code.\n");
+  }
+  offProcessorEntries.clear();
+}
+
+int PeridigmNS::SerialMatrix::globalAssemble()
+{
+  flushOffProcessorValues();
+  return FECrsMatrix->GlobalAssemble();
+}
 
-  // Assign local indices and inverse map
+// This is like the SerialMatrix::addValues routine above, but inserts only the block diagonal values and filters out the rest
+void PeridigmNS::SerialMatrix::addBlockDiagonalValues(int numIndices, const int* globalIndices, const double *const * values)
+{
+  // Local row and column indices for each global index
+  localRowIndices.resize(numIndices);
+  localColIndices.resize(numIndices);
   for(int i=0 ; i<numIndices ; ++i){
     localRowIndices[i] = FECrsMatrix->LRID(globalIndices[i]);
-    int localColIndex = FECrsMatrix->LCID(globalIndices[i]);
     // Will be receiving data for columns that we will not fill, so don't check that all column data is locally owned.
-    localColIndices[i] = localColIndex;
-    inverseMap[globalIndices[i]] = i;
+    localColIndices[i] = FECrsMatrix->LCID(globalIndices[i]);
   }
 
+  // The indices come in point triples, so the block diagonal of row iRow is the triple that contains iRow
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(numIndices%3 != 0, "Error in PeridigmNS::SerialMatrix::addBlockDiagonalValues(), bad index.");
+
   // Scratch space for extracting the three nonzeros per row to fill
   int blockDiagonalNumIndices = 3;
-  Teuchos::SerialDenseVector<int,int> blockDiagonalLocalColIndices(blockDiagonalNumIndices);
-  Teuchos::SerialDenseVector<int,int> blockDiagonalGlobalIndices(blockDiagonalNumIndices);
-  Teuchos::SerialDenseVector<int,double> blockDiagonalValues(blockDiagonalNumIndices);
+  double blockDiagonalValues[3];
+  int blockDiagonalLocalColIndices[3];
+  int blockDiagonalGlobalIndices[3];
 
   for(int iRow=0 ; iRow<numIndices ; ++iRow){
 
-    // Determine which global element iRow belongs to
+    // Determine global indices of DOFs for the element iRow belongs to
+    int first = 3*(iRow/3);
     int elem = globalIndices[iRow] / 3;
-    // Determine global indices of DOFs for this element
-    int e1 = 3*elem + 0;
-    int e2 = 3*elem + 1;
-    int e3 = 3*elem + 2;
-
-    // Be sure entries exist in inverseMap
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(inverseMap.count(e1)<=0, "Error in PeridigmNS::SerialMatrix::addBlockDiagonalValues(), bad index.");
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(inverseMap.count(e2)<=0, "Error in PeridigmNS::SerialMatrix::addBlockDiagonalValues(), bad index.");
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(inverseMap.count(e3)<=0, "Error in PeridigmNS::SerialMatrix::addBlockDiagonalValues(), bad index.");
-
-    // Store only the three block diagonal nonzeros to fill
-    int idx1 = inverseMap[e1];
-    blockDiagonalLocalColIndices[0] = localColIndices[idx1];
-    blockDiagonalValues[0]          = values[iRow][idx1];
-    int idx2 = inverseMap[e2];
-    blockDiagonalLocalColIndices[1] = localColIndices[idx2];
-    blockDiagonalValues[1]          = values[iRow][idx2];
-    int idx3 = inverseMap[e3];
-    blockDiagonalLocalColIndices[2] = localColIndices[idx3];
-    blockDiagonalValues[2]          = values[iRow][idx3];
-    // Store global indices in case row not locally owned
-    blockDiagonalGlobalIndices[0] = e1;
-    blockDiagonalGlobalIndices[1] = e2;
-    blockDiagonalGlobalIndices[2] = e3;
+    for(int j=0 ; j<3 ; ++j){
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(globalIndices[first+j] != 3*elem+j, "Error in PeridigmNS::SerialMatrix::addBlockDiagonalValues(), bad index.");
+      blockDiagonalLocalColIndices[j] = localColIndices[first+j];
+      blockDiagonalValues[j]          = values[iRow][first+j];
+      // Store global indices in case row not locally owned
+      blockDiagonalGlobalIndices[j]   = globalIndices[first+j];
+    }
 
     // If the row is locally owned, then sum into the global tangent with Epetra_CrsMatrix::SumIntoMyValues().
     if(localRowIndices[iRow] != -1){
-      int err = FECrsMatrix->SumIntoMyValues(localRowIndices[iRow], blockDiagonalNumIndices, &blockDiagonalValues[0], &blockDiagonalLocalColIndices[0]);
+      int err = FECrsMatrix->SumIntoMyValues(localRowIndices[iRow], blockDiagonalNumIndices, blockDiagonalValues, blockDiagonalLocalColIndices);
       TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::addBlockDiagonalValues(), SumIntoMyValues() returned nonzero error code.\n");
     }
-    // If the row is not locally owned, then sum into the global tangent with Epetra_FECrsMatrix::SumIntoGlobalValues().
-    // This is expensive.
+    // If the row is not locally owned, hold the values until flushOffProcessorValues().
     else{
-      int err = FECrsMatrix->SumIntoGlobalValues(globalIndices[iRow], blockDiagonalNumIndices, const_cast<double *>(&blockDiagonalValues[0]), const_cast<int *>(&blockDiagonalGlobalIndices[0]));
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** PeridigmNS::SerialMatrix::addBlockDiagonalValues(), SumIntoGlobalValues() returned nonzero error code.\n");
+      bufferOffProcessorValues(globalIndices[iRow], blockDiagonalNumIndices, blockDiagonalValues, blockDiagonalGlobalIndices);
     }
   }
 }
 
 void PeridigmNS::SerialMatrix::putScalar(double value)
 {
+  offProcessorEntries.clear();
   FECrsMatrix->PutScalar(value);
 }
+
+double PeridigmNS::SerialMatrix::bufferMemorySize() const
+{
+  double sizeInBytes =
+    (localRowIndices.capacity() + localColIndices.capacity() + pointColumnOrder.capacity())*sizeof(int) +
+    offProcessorEntries.capacity()*sizeof(OffProcessorEntry);
+  return sizeInBytes/1048576.0;
+}
@@ -62,6 +62,12 @@ namespace PeridigmNS {
  *  block-specific data and were designed such that a single, consistent indexing scheme is used for all calculations.  This
  *  indexing scheme differs from the global indexing scheme, hence the index values must be transformed prior to inserting
  *  values into the global tangent matrix.  This translation is the main purpose of PeridigmNS::SerialMatrix.
+ *
+ *  Material models submit dense neighborhood blocks whose indices come in triples (the three displacement degrees of freedom
+ *  of a point).  For locally-owned rows, addValues() locates each 3x3 point block in the row of the filled matrix once and
+ *  sums directly into the row's value array.  Contributions to rows owned by other processors are buffered and summed into
+ *  the Epetra_FECrsMatrix in one pass by flushOffProcessorValues(); globalAssemble() flushes the buffer before calling
+ *  Epetra_FECrsMatrix::GlobalAssemble(), and should be used in place of calling GlobalAssemble() on the matrix directly.
  */
 class SerialMatrix {
 
@@ -81,9 +87,18 @@ public:
   //! Add only block diagonal values at given locations, indexed by global ID
   void addBlockDiagonalValues(int numIndicies, const int* globalIndices, const double *const * values);
 
-  //! Set all entries to given scalar
+  //! Sum the buffered contributions to rows owned by other processors into the Epetra_FECrsMatrix; call once all blocks have been assembled.
+  void flushOffProcessorValues();
+
+  //! Flush the buffered off-processor contributions, then call Epetra_FECrsMatrix::GlobalAssemble(); returns its error code.
+  int globalAssemble();
+
+  //! Set all entries to given scalar, discards any buffered off-processor contributions
   void putScalar(double value);
 
+  //! Returns the memory used by the scratch space and the buffered off-processor contributions, in megabytes
+  double bufferMemorySize() const;
+
   //! Return ref-count pointer to the FECrsMatrix
   Teuchos::RCP<const Epetra_FECrsMatrix> getFECrsMatrix() { return FECrsMatrix; }
 
@@ -91,8 +106,36 @@ protected:
 
   Teuchos::RCP<Epetra_FECrsMatrix> FECrsMatrix;
 
+  //! Sum a row of values into a locally-owned row, one 3x3 point block at a time; returns false if the indices are not point triples.
+  bool sumIntoMyRowByPointBlocks(int localRow, int numIndices, const double* values);
+
+  //! Buffer a row of values destined for a row owned by another processor.
+  void bufferOffProcessorValues(int globalRow, int numIndices, const double* values, const int* globalIndices);
+
 private:
 
+  //! A contribution to a row owned by another processor.
+  struct OffProcessorEntry {
+    int row;
+    int col;
+    double value;
+    bool operator<(const OffProcessorEntry& other) const { return row < other.row || (row == other.row && col < other.col); }
+  };
+
+  //! @name Scratch space reused across calls
+  //@{
+  std::vector<int> localRowIndices;
+  std::vector<int> localColIndices;
+  //! Indices of the first column of each point triple, ordered by local column index.
+  std::vector<int> pointColumnOrder;
+  //@}
+
+  //! True if the indices passed to the current addValues() call form point triples with consecutive local columns.
+  bool indicesArePointTriples;
+
+  //! Buffered contributions to rows owned by other processors.
+  std::vector<OffProcessorEntry> offProcessorEntries;
+
   //! Private to prohibit use.
   SerialMatrix() {}
   SerialMatrix(const SerialMatrix& serialMatrix){}
@@ -50,8 +50,7 @@
 #include <Epetra_Import.h>
 #include <Teuchos_Assert.hpp>
 #include <sstream>
-#include <EpetraExt_MultiVectorOut.h>
-#include <EpetraExt_MultiVectorIn.h>
+#include <cstdio>
 using namespace std;
 
 void PeridigmNS::State::allocatePointData(PeridigmField::Length length,
@@ -150,59 +149,52 @@ void PeridigmNS::State::copyLocallyOwnedDataFromState(Teuchos::RCP<PeridigmNS::S
   }
 }
 
-void PeridigmNS::State::writeStateData(Teuchos::RCP<PeridigmNS::State> source,  std::string stateName,  std::string blockName,  char const * path)
+void PeridigmNS::State::writeStateData(RestartWriter& writer, std::string stateName, std::string blockName, const Epetra_BlockMap& ownedPointMap)
 {
-  char VectorName[100];
-  SetRestartFiles(stateName, blockName, path);
+  char vectorName[100];
   for(unsigned int i=0 ; i<pointData.size() ; ++i){
     if(!pointData[i].is_null()){
-      sprintf(VectorName,"%s%s_Element%d",blockName.c_str(),stateName.c_str(),i);
- 	  EpetraExt::MultiVectorToMatrixMarketFile 	(restartStateFiles[VectorName].c_str(),
- 			  	  	  	  	  *(source->getPointMultiVector(i)),VectorName,"",true);
+      sprintf(vectorName, "%s%s_Element%d", blockName.c_str(), stateName.c_str(), i);
+      writer.add(vectorName, *pointData[i], &ownedPointMap);
     }
   }
   if(!bondData.is_null()){
-	  sprintf(VectorName,"%s%s",blockName.c_str(),stateName.c_str());
-	  EpetraExt::MultiVectorToMatrixMarketFile 	(restartStateFiles[VectorName].c_str(),
-			                 *(source->getBondMultiVector()),VectorName,"",true);
+    sprintf(vectorName, "%s%s", blockName.c_str(), stateName.c_str());
+    writer.add(vectorName, *bondData);
   }
 }
-void PeridigmNS::State::SetRestartFiles( std::string stateName, std::string blockName, char const * path)
+
+void PeridigmNS::State::readStateData(RestartReader& reader, std::string stateName, std::string blockName)
 {
-	  char pathname[100], VectorName[50];
-	  for(unsigned int i=0 ; i<pointData.size() ; ++i){
-		  if(!pointData[i].is_null()){
-			  sprintf(VectorName,"%s%s_Element%d",blockName.c_str(),stateName.c_str(),i);
-			  sprintf(pathname,"%s/pointData_%s.mat",path,VectorName);
-			  restartStateFiles[VectorName] = pathname;
-		  }
-	  }
-	  if(!bondData.is_null()){
-		  sprintf(VectorName,"%s%s",blockName.c_str(),stateName.c_str());
-		  sprintf(pathname,"%s/BondData_%s.mat",path,VectorName);
-		  restartStateFiles[VectorName] = pathname;
-	  }
+  char vectorName[100];
+  for(unsigned int i=0 ; i<pointData.size() ; ++i){
+    if(!pointData[i].is_null()){
+      sprintf(vectorName, "%s%s_Element%d", blockName.c_str(), stateName.c_str(), i);
+      reader.read(vectorName, *pointData[i]);
+    }
+  }
+  if(!bondData.is_null()){
+    sprintf(vectorName, "%s%s", blockName.c_str(), stateName.c_str());
+    reader.read(vectorName, *bondData);
+  }
 }
 
+double PeridigmNS::State::pointDataMemorySize() const
+{
+  double sizeInBytes = 0.0;
+  for(unsigned int i=0 ; i<pointData.size() ; ++i){
+    if(!pointData[i].is_null())
+      sizeInBytes += static_cast<double>(pointData[i]->MyLength())*pointData[i]->NumVectors()*sizeof(double);
+  }
+  return sizeInBytes/1048576.0;
+}
 
-void PeridigmNS::State::readStateData(Teuchos::RCP<PeridigmNS::State> source,  std::string stateName,  std::string blockName, char const * path)
+double PeridigmNS::State::bondDataMemorySize() const
 {
-	 char VectorName[100];
-	  Epetra_MultiVector * MultiVectorUpdate;
-	  SetRestartFiles(stateName, blockName, path);
-	  for(unsigned int i=0 ; i<pointData.size() ; ++i){
-	    if(!pointData[i].is_null()){
-	      sprintf(VectorName,"%s%s_Element%d",blockName.c_str(),stateName.c_str(),i);
-	      EpetraExt::MatrixMarketFileToMultiVector(restartStateFiles[VectorName].c_str(),(source->getPointMultiVector(i))->Map(), MultiVectorUpdate);
-	      copyLocallyOwnedMultiVectorData( *MultiVectorUpdate, *pointData[i] );
-	    }
-	  }
-
-	  if(!bondData.is_null()){
-		  sprintf(VectorName,"%s%s",blockName.c_str(),stateName.c_str());
-	      EpetraExt::MatrixMarketFileToMultiVector(restartStateFiles[VectorName].c_str(),source->getBondMultiVector()->Map(), MultiVectorUpdate);
-	      copyLocallyOwnedMultiVectorData( *MultiVectorUpdate, *bondData );
-	  }
+  if(bondData.is_null())
+    return 0.0;
+  double sizeInBytes = static_cast<double>(bondData->MyLength())*bondData->NumVectors()*sizeof(double);
+  return sizeInBytes/1048576.0;
 }
 
 void PeridigmNS::State::copyLocallyOwnedMultiVectorData(Epetra_MultiVector& source, Epetra_MultiVector& target)
@@ -51,6 +51,7 @@
 #include <Teuchos_RCP.hpp>
 #include <Epetra_Vector.h>
 #include "Peridigm_Field.hpp"
+#include "Peridigm_RestartFile.hpp"
 #include <vector>
 
 namespace PeridigmNS {
@@ -123,14 +124,17 @@ public:
   //! Copies data from a different state object based on global IDs; functions only if all the local IDs in the target map exist in and are locally owned in the source map.
   void copyLocallyOwnedDataFromState(Teuchos::RCP<PeridigmNS::State> source);
 
-  //! Set restart files for state data
-  void SetRestartFiles( std::string stateName, std::string blockName, char const * path);
+  //! Adds the point and bond data to a restart; point data is restricted to the points owned according to ownedPointMap.
+  void writeStateData(RestartWriter& writer, std::string stateName, std::string blockName, const Epetra_BlockMap& ownedPointMap);
 
-  //! Write state data
-  void writeStateData(Teuchos::RCP<PeridigmNS::State> source, std::string stateName, std::string blockName, char const * path);
+  //! Reads the point and bond data from a restart.
+  void readStateData(RestartReader& reader, std::string stateName, std::string blockName);
 
-  //! Read state data
-  void readStateData(Teuchos::RCP<PeridigmNS::State> source,  std::string stateName, std::string blockName, char const * path);
+  //! Returns the memory used by the point data on this processor, in megabytes.
+  double pointDataMemorySize() const;
+
+  //! Returns the memory used by the bond data on this processor, in megabytes.
+  double bondDataMemorySize() const;
 
 
 private:
@@ -138,9 +142,6 @@ private:
   //! Maximum set of an element in the pointData Epetra_MultiVector.
   int maxPointDataElementSize;
 
-  //! Map for restart files
-  std::map <std::string, std::string> restartStateFiles;
-
 protected:
 
   //! Maximum value of field ids.
@@ -2,12 +2,16 @@
 
 #include "Peridigm_Timer.hpp"
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <vector>
+#include <algorithm>
 
 #include <Teuchos_CommHelpers.hpp>
 #include <Teuchos_DefaultComm.hpp>
 #include <Teuchos_GlobalMPISession.hpp>
 #include <Teuchos_RCP.hpp>
+#include <Teuchos_Assert.hpp>
 
 using namespace std;
 
@@ -16,6 +20,95 @@ PeridigmNS::Timer& PeridigmNS::Timer::self() {
   return timer;
 }
 
+PeridigmNS::Timer::Timer()
+  : originTime(0.0), hierarchicalReport(false), traceEnabled(false), maxTraceEvents(0), droppedTraceEvents(0)
+{
+#ifdef HAVE_MPI
+  epetraTime = Teuchos::rcp(new Epetra_Time(Epetra_MpiComm(MPI_COMM_WORLD)));
+#else
+  epetraTime = Teuchos::rcp(new Epetra_Time(Epetra_SerialComm()));
+#endif
+  originTime = epetraTime->WallTime();
+  treeNodes.push_back(TreeNode(-1, -1));
+  runningNodes.push_back(0);
+}
+
+int PeridigmNS::Timer::timerId(const std::string& name) {
+  map<string, int>::iterator it = timerIds.find(name);
+  if(it != timerIds.end())
+    return it->second;
+  int id = (int)( timers.size() );
+  timerIds[name] = id;
+  timerNames.push_back(name);
+  timers.push_back(TimeKeeper());
+  return id;
+}
+
+int PeridigmNS::Timer::childNode(int node, int id) {
+  const vector<int>& children = treeNodes[node].children;
+  for(unsigned int i=0 ; i<children.size() ; ++i){
+    if(treeNodes[children[i]].timerId == id)
+      return children[i];
+  }
+  int child = (int)( treeNodes.size() );
+  treeNodes.push_back(TreeNode(id, node));
+  treeNodes[node].children.push_back(child);
+  return child;
+}
+
+void PeridigmNS::Timer::startTimer(int id) {
+  double now = epetraTime->WallTime();
+  timers[id].start(now);
+  int node = childNode(runningNodes.back(), id);
+  treeNodes[node].startTime = now;
+  runningNodes.push_back(node);
+}
+
+void PeridigmNS::Timer::stopTimer(int id) {
+  double now = epetraTime->WallTime();
+  timers[id].stop(now);
+
+  // Timers are usually stopped in the reverse order they were started, but a timer
+  // may also be stopped while timers started after it are still running
+  for(int i=(int)(runningNodes.size())-1 ; i>0 ; --i){
+    int node = runningNodes[i];
+    if(treeNodes[node].timerId == id){
+      TreeNode& treeNode = treeNodes[node];
+      treeNode.elapsedTime += now - treeNode.startTime;
+      treeNode.count += 1;
+      if(traceEnabled){
+        if((int)( traceEvents.size() ) < maxTraceEvents){
+          TraceEvent event;
+          event.timerId = id;
+          event.startTime = treeNode.startTime - originTime;
+          event.duration = now - treeNode.startTime;
+          traceEvents.push_back(event);
+        }
+        else
+          droppedTraceEvents += 1;
+      }
+      runningNodes.erase(runningNodes.begin() + i);
+      break;
+    }
+  }
+}
+
+void PeridigmNS::Timer::addTime(int id, double seconds) {
+  timers[id].add(seconds);
+  TreeNode& treeNode = treeNodes[childNode(runningNodes.back(), id)];
+  treeNode.elapsedTime += seconds;
+  treeNode.count += 1;
+}
+
+void PeridigmNS::Timer::enableTrace(const std::string& fileName, int maxEvents) {
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(fileName.empty(), "**** Error:  Timer::enableTrace(), the trace file name is empty.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(maxEvents < 0, "**** Error:  Timer::enableTrace(), the maximum number of trace events must be non-negative.\n");
+  traceEnabled = true;
+  traceFileName = fileName;
+  maxTraceEvents = maxEvents;
+  traceEvents.reserve(std::min(maxEvents, 100000));
+}
+
 void PeridigmNS::Timer::printTimingData(ostream &out){
 
   int count = (int)( timers.size() );
@@ -24,31 +117,41 @@ void PeridigmNS::Timer::printTimingData(ostream &out){
   vector<double> minTimes(count);
   vector<double> maxTimes(count);
   vector<double> totalTimes(count);
+  vector<int> maxRankCandidates(count);
+  vector<int> maxRanks(count);
   int i = 0;
-  for(map<string, TimeKeeper>::reverse_iterator it=timers.rbegin() ; it!=timers.rend() ; it++){
+  for(map<string, int>::reverse_iterator it=timerIds.rbegin() ; it!=timerIds.rend() ; it++){
     names[i] = it->first;
-    times[i] = it->second.getElapsedTime();
+    times[i] = timers[it->second].getElapsedTime();
     i++;
   }
 
   Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
-  Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MIN,count,&times[0], &minTimes[0]);
-  Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&times[0], &maxTimes[0]);
-  Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_SUM,count,&times[0], &totalTimes[0]);
+  int nProc = teuchosComm->getSize();
+  int myRank = teuchosComm->getRank();
+  if(count > 0){
+    Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MIN,count,&times[0], &minTimes[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&times[0], &maxTimes[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_SUM,count,&times[0], &totalTimes[0]);
+    // The slowest processor is the lowest rank that attains the maximum
+    for(i=0 ; i<count ; ++i)
+      maxRankCandidates[i] = (times[i] == maxTimes[i]) ? myRank : nProc;
+    Teuchos::reduceAll<int, int>(*teuchosComm,Teuchos::REDUCE_MIN,count,&maxRankCandidates[0], &maxRanks[0]);
+  }
 
   unsigned int nameLength = 0;
   for(unsigned int i=0 ; i<names.size() ; ++i)
     if(names[i].size() > nameLength) nameLength = names[i].size();
 
   int indent = 15;
-  int nProc = teuchosComm->getSize();
 
-  if(nProc > 1 && teuchosComm->getRank() == 0){
+  if(nProc > 1 && myRank == 0){
     out << "Wallclock Time (seconds):" << endl;
     out << "  ";
     out.width(nameLength + 17); out << "Min";
     out.width(indent); out << right << "Max";
     out.width(indent); out << right << "Ave";
+    out.width(indent); out << right << "Slowest Rank";
     out << endl;
     out.precision(2);
     for(unsigned int i=0 ; i<names.size() ; ++i){
@@ -57,6 +160,7 @@ void PeridigmNS::Timer::printTimingData(ostream &out){
       out.width(indent); out << right << minTimes[i];
       out.width(indent); out << right << maxTimes[i];
       out.width(indent); out << right << totalTimes[i]/nProc;
+      out.width(indent); out << right << maxRanks[i];
       out << endl;
     }
     out << endl;
@@ -72,4 +176,163 @@ void PeridigmNS::Timer::printTimingData(ostream &out){
     }
     out << endl;
   }
+
+  if(hierarchicalReport)
+    printTimingTree(out);
+}
+
+void PeridigmNS::Timer::collectTreeNodes(int node,
+                                         const std::string& path,
+                                         int depth,
+                                         std::vector<int>& nodeList,
+                                         std::vector<std::string>& paths,
+                                         std::vector<int>& depths) const {
+  vector< pair<string, int> > children;
+  for(unsigned int i=0 ; i<treeNodes[node].children.size() ; ++i){
+    int child = treeNodes[node].children[i];
+    children.push_back( pair<string, int>(timerNames[treeNodes[child].timerId], child) );
+  }
+  sort(children.begin(), children.end());
+  for(unsigned int i=0 ; i<children.size() ; ++i){
+    string childPath = path + "/" + children[i].first;
+    nodeList.push_back(children[i].second);
+    paths.push_back(childPath);
+    depths.push_back(depth);
+    collectTreeNodes(children[i].second, childPath, depth + 1, nodeList, paths, depths);
+  }
+}
+
+void PeridigmNS::Timer::printTimingTree(ostream &out){
+
+  vector<int> nodeList;
+  vector<string> paths;
+  vector<int> depths;
+  collectTreeNodes(0, "", 0, nodeList, paths, depths);
+
+  Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
+  int nProc = teuchosComm->getSize();
+  int myRank = teuchosComm->getRank();
+
+  // The statistics are reduced node by node, which requires the same call tree on every
+  // processor; this is checked with the node count and the total length of the paths
+  int count = (int)( nodeList.size() );
+  int pathLength = 0;
+  for(unsigned int i=0 ; i<paths.size() ; ++i)
+    pathLength += (int)( paths[i].size() );
+  int localShape[2] = {count, pathLength};
+  int minShape[2], maxShape[2];
+  Teuchos::reduceAll<int, int>(*teuchosComm,Teuchos::REDUCE_MIN,2,localShape,minShape);
+  Teuchos::reduceAll<int, int>(*teuchosComm,Teuchos::REDUCE_MAX,2,localShape,maxShape);
+  bool sameTree = (minShape[0] == maxShape[0] && minShape[1] == maxShape[1]);
+
+  vector<double> times(count), minTimes(count), maxTimes(count), totalTimes(count);
+  vector<int> calls(count), maxRankCandidates(count), maxRanks(count);
+  for(int i=0 ; i<count ; ++i){
+    times[i] = treeNodes[nodeList[i]].elapsedTime;
+    calls[i] = treeNodes[nodeList[i]].count;
+    minTimes[i] = maxTimes[i] = times[i];
+    totalTimes[i] = times[i]*nProc;
+    maxRanks[i] = myRank;
+  }
+  if(sameTree && count > 0){
+    Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MIN,count,&times[0], &minTimes[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_MAX,count,&times[0], &maxTimes[0]);
+    Teuchos::reduceAll<int, double>(*teuchosComm,Teuchos::REDUCE_SUM,count,&times[0], &totalTimes[0]);
+    for(int i=0 ; i<count ; ++i)
+      maxRankCandidates[i] = (times[i] == maxTimes[i]) ? myRank : nProc;
+    Teuchos::reduceAll<int, int>(*teuchosComm,Teuchos::REDUCE_MIN,count,&maxRankCandidates[0], &maxRanks[0]);
+  }
+
+  if(myRank != 0)
+    return;
+
+  unsigned int nameLength = 0;
+  for(int i=0 ; i<count ; ++i){
+    unsigned int length = 2*depths[i] + timerNames[treeNodes[nodeList[i]].timerId].size();
+    if(length > nameLength) nameLength = length;
+  }
+
+  int indent = 15;
+
+  out << "Wallclock Time by Call Tree (seconds):" << endl;
+  if(!sameTree)
+    out << "  The call tree differs across processors, showing processor 0 only." << endl;
+  out << "  ";
+  out.width(nameLength + 17); out << right << (nProc > 1 && sameTree ? "Min" : "Time");
+  if(nProc > 1 && sameTree){
+    out.width(indent); out << right << "Max";
+    out.width(indent); out << right << "Ave";
+    out.width(indent); out << right << "Slowest Rank";
+  }
+  out.width(indent); out << right << "Calls";
+  out << endl;
+  out.precision(2);
+  for(int i=0 ; i<count ; ++i){
+    out << "  ";
+    out.width(nameLength + 2); out << left << string(2*depths[i], ' ') + timerNames[treeNodes[nodeList[i]].timerId];
+    out.width(indent); out << right << minTimes[i];
+    if(nProc > 1 && sameTree){
+      out.width(indent); out << right << maxTimes[i];
+      out.width(indent); out << right << totalTimes[i]/nProc;
+      out.width(indent); out << right << maxRanks[i];
+    }
+    out.width(indent); out << right << calls[i];
+    out << endl;
+  }
+  out << endl;
+}
+
+//! Escapes a string for use in a JSON file.
+static string jsonEscape(const string& str)
+{
+  ostringstream escaped;
+  for(unsigned int i=0 ; i<str.size() ; ++i){
+    char c = str[i];
+    if(c == '"' || c == '\\')
+      escaped << '\\' << c;
+    else if(c == '\n')
+      escaped << "\\n";
+    else
+      escaped << c;
+  }
+  return escaped.str();
+}
+
+void PeridigmNS::Timer::writeTrace(){
+
+  if(!traceEnabled)
+    return;
+
+  Teuchos::RCP<const Teuchos::Comm<int> > teuchosComm = Teuchos::createMpiComm<int>(Teuchos::opaqueWrapper<MPI_Comm>(MPI_COMM_WORLD));
+  int nProc = teuchosComm->getSize();
+  int myRank = teuchosComm->getRank();
+
+  // One file per processor, named like decomposed Exodus files
+  ostringstream fileName;
+  fileName << traceFileName;
+  if(nProc > 1)
+    fileName << "." << nProc << "." << myRank;
+
+  ofstream trace(fileName.str().c_str());
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(!trace.is_open(), "**** Error:  Timer::writeTrace(), unable to open " + fileName.str() + ".\n");
+
+  // Complete ("X") events in microseconds, with the processor as the pid; the viewer nests events by time
+  trace.precision(15);
+  trace << "{\"traceEvents\":[\n";
+  trace << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << myRank << ",\"args\":{\"name\":\"Processor " << myRank << "\"}}";
+  for(unsigned int i=0 ; i<traceEvents.size() ; ++i){
+    const TraceEvent& event = traceEvents[i];
+    trace << ",\n{\"name\":\"" << jsonEscape(timerNames[event.timerId]) << "\",\"cat\":\"Peridigm\",\"ph\":\"X\""
+          << ",\"ts\":" << 1.0e6*event.startTime << ",\"dur\":" << 1.0e6*event.duration
+          << ",\"pid\":" << myRank << ",\"tid\":0}";
+  }
+  trace << "\n],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"droppedEvents\":" << droppedTraceEvents << "}}\n";
+  trace.close();
+
+  if(myRank == 0){
+    cout << "Timer trace written to " << traceFileName;
+    if(nProc > 1)
+      cout << ".<number of processors>.<processor id>";
+    cout << "\n" << endl;
+  }
 }
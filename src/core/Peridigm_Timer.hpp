@@ -59,10 +59,20 @@ typedef int MPI_Comm;
 
 #include <Epetra_Time.h>
 #include <ostream>
+#include <string>
+#include <vector>
+#include <map>
 
 namespace PeridigmNS {
 
-//! Singleton class for performance monitoring; manages a set of TimeKeeper objects.
+/*! \brief Singleton class for performance monitoring; manages a set of TimeKeeper objects.
+ *
+ *  Timers are identified by name or by the integer id returned by timerId(); the id-based
+ *  functions avoid the name lookup and are intended for code called every step.  Timers that
+ *  are started while another timer is running are nested under it, and the resulting call tree
+ *  is printed by printTimingData() when the hierarchical report is enabled.  Each completed
+ *  interval can also be recorded and written in the Chrome trace event format by writeTrace().
+ */
 class Timer {
 
 public:
@@ -73,22 +83,52 @@ public:
   //! Singleton.
   static Timer& self();
 
+  //! Returns the id of the specified timer, creates the timer if it does not exist.
+  int timerId(const std::string& name);
+
+  //! Starts specified timer.
+  void startTimer(int id);
+
+  //! Stops specified timer.
+  void stopTimer(int id);
+
+  //! Adds time measured elsewhere (e.g. on a helper thread) to the specified timer.
+  void addTime(int id, double seconds);
+
+  //! Query specified timer for elasped time.
+  double elapsedTime(int id) const { return timers[id].getElapsedTime(); }
+
   //! Starts specified timer, creates the timer if it does not exist.
-  void startTimer(const std::string& name) { timers[name].start(); }
+  void startTimer(const std::string& name) { startTimer(timerId(name)); }
 
   //! Stops specified timer.
-  void stopTimer(const std::string& name) { timers[name].stop(); }
+  void stopTimer(const std::string& name) { stopTimer(timerId(name)); }
+
+  //! Adds time measured elsewhere (e.g. on a helper thread) to the specified timer, creates the timer if it does not exist.
+  void addTime(const std::string& name, double seconds) { addTime(timerId(name), seconds); }
 
   //! Query specified timer for elasped time.
-  double elapsedTime(const std::string& name) { return timers[name].getElapsedTime(); }
+  double elapsedTime(const std::string& name) { return elapsedTime(timerId(name)); }
+
+  //! Enables the call-tree section of printTimingData().
+  void setHierarchicalReport(bool report) { hierarchicalReport = report; }
 
-  //! Prints out a table of timing data.
+  //! Records every completed timer interval, up to maxEvents, for writeTrace().
+  void enableTrace(const std::string& fileName, int maxEvents);
+
+  //! Returns true if the hierarchical report or the trace is enabled, in which case callers may add finer-grained timers.
+  bool detailedTiming() const { return hierarchicalReport || traceEnabled; }
+
+  //! Prints out a table of timing data (collective).
   void printTimingData(std::ostream &out);
 
+  //! Writes the recorded intervals as a Chrome trace (JSON) file, one file per processor; does nothing if the trace is not enabled.
+  void writeTrace();
+
 private:
 
   //! Private constructor
-  Timer(){}
+  Timer();
 
   //! @name Private and unimplemented to prevent use
   //@{
@@ -101,34 +141,112 @@ private:
 
   public:
 
-    TimeKeeper() : elapsedTime(0.0) {
-#ifdef HAVE_MPI
-      epetraTime = Teuchos::rcp(new Epetra_Time(Epetra_MpiComm(MPI_COMM_WORLD)));
-#else
-      epetraTime = Teuchos::rcp(new Epetra_Time(Epetra_SerialComm()));
-#endif
+    TimeKeeper() : startTime(0.0), elapsedTime(0.0) {}
+
+    void start(double now) {
+      startTime = now;
     }
 
-    void start() {
-      epetraTime->ResetStartTime();
+    void stop(double now) {
+      elapsedTime += now - startTime;
     }
 
-    void stop() {
-      elapsedTime += epetraTime->ElapsedTime();
+    void add(double seconds) {
+      elapsedTime += seconds;
     }
 
     //! Returns the cummulative elapsed time.
     double getElapsedTime() const { return elapsedTime; }
 
   private:
-    Teuchos::RCP<Epetra_Time> epetraTime;
+    double startTime;
     double elapsedTime;
   };
 
+  //! Node of the call tree; the same timer has one node for each timer it was started under.
+  struct TreeNode {
+    TreeNode(int timerId_, int parent_) : timerId(timerId_), parent(parent_), startTime(0.0), elapsedTime(0.0), count(0) {}
+    int timerId;
+    int parent;
+    std::vector<int> children;
+    double startTime;
+    double elapsedTime;
+    int count;
+  };
+
+  //! A completed interval, recorded for the trace.
+  struct TraceEvent {
+    int timerId;
+    double startTime;
+    double duration;
+  };
+
+  //! Returns the child of the given node for the given timer, creates it if it does not exist.
+  int childNode(int node, int id);
+
+  //! Appends the names (as paths from the root) of the nodes below the given node, in depth-first order with children sorted by name.
+  void collectTreeNodes(int node, const std::string& path, int depth, std::vector<int>& nodeList, std::vector<std::string>& paths, std::vector<int>& depths) const;
+
+  //! Prints the call tree (collective).
+  void printTimingTree(std::ostream &out);
+
+  //! Clock shared by all timers.
+  Teuchos::RCP<Epetra_Time> epetraTime;
+
+  //! Wallclock time at which the Timer was constructed, the origin of the trace.
+  double originTime;
+
 protected:
 
-  //! Map that associates a name with a TimeKeeper.
-  std::map<std::string, TimeKeeper> timers;
+  //! Map that associates a name with a timer id.
+  std::map<std::string, int> timerIds;
+
+  //! Timer names, indexed by timer id.
+  std::vector<std::string> timerNames;
+
+  //! TimeKeepers, indexed by timer id.
+  std::vector<TimeKeeper> timers;
+
+  //! Call tree; node zero is the root.
+  std::vector<TreeNode> treeNodes;
+
+  //! Nodes of the running timers, outermost first; starts with the root.
+  std::vector<int> runningNodes;
+
+  //! Flag for printing the call tree.
+  bool hierarchicalReport;
+
+  //! Flag for recording trace events.
+  bool traceEnabled;
+
+  //! Trace file name.
+  std::string traceFileName;
+
+  //! Maximum number of trace events kept.
+  int maxTraceEvents;
+
+  //! Number of trace events discarded after maxTraceEvents was reached.
+  int droppedTraceEvents;
+
+  //! Recorded trace events.
+  std::vector<TraceEvent> traceEvents;
+};
+
+//! Starts a timer on construction and stops it on destruction.
+class ScopedTimer {
+
+public:
+
+  explicit ScopedTimer(int id) : timerId(id) { Timer::self().startTimer(timerId); }
+
+  ~ScopedTimer() { Timer::self().stopTimer(timerId); }
+
+private:
+
+  ScopedTimer(const ScopedTimer&);
+  ScopedTimer& operator=(const ScopedTimer&);
+
+  int timerId;
 };
 
 }
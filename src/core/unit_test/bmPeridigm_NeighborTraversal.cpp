@@ -0,0 +1,266 @@
+/*! \file bmPeridigm_NeighborTraversal.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+// Microbenchmark comparing bond traversal through the count-prefixed neighbor
+// list with traversal through the CSR bond topology of NeighborhoodData, and the
+// interleaved (x0,y0,z0,x1,...) coordinate layout with the structure-of-arrays
+// layout kept by DataManager::setStructureOfArraysFieldIds().
+//
+// Usage: bmPeridigm_NeighborTraversal [mesh_file] [horizon] [num_repetitions]
+//
+// The defaults correspond to the fragmenting_cylinder performance problem.  The
+// mesh file is in the Peridigm text file format (x y z block_id volume).
+
+#include "Peridigm_NeighborhoodData.hpp"
+#include <vector>
+#include <map>
+#include <cmath>
+#include <cstdlib>
+#include <chrono>
+#include <sstream>
+#include <iostream>
+
+using namespace std;
+
+void readTextFileMesh(const string& fileName, vector<double>& x, vector<double>& volume)
+{
+  ifstream input(fileName.c_str());
+  if(!input.good()){
+    cerr << "**** Error, unable to open mesh file " << fileName << endl;
+    exit(1);
+  }
+  string line;
+  while(getline(input, line)){
+    if(line.empty() || line[0] == '#')
+      continue;
+    istringstream iss(line);
+    double coord[3], blockId, vol;
+    if(iss >> coord[0] >> coord[1] >> coord[2] >> blockId >> vol){
+      x.insert(x.end(), coord, coord+3);
+      volume.push_back(vol);
+    }
+  }
+}
+
+//! Neighbor search using a uniform grid of bins with edge length equal to the horizon.
+void buildNeighborhoodData(const vector<double>& x, double horizon, PeridigmNS::NeighborhoodData& neighborhoodData)
+{
+  int numPoints = static_cast<int>(x.size()/3);
+  double minCoord[3] = { 1.0e50, 1.0e50, 1.0e50 };
+  for(int i=0 ; i<numPoints ; ++i)
+    for(int dof=0 ; dof<3 ; ++dof)
+      minCoord[dof] = min(minCoord[dof], x[3*i+dof]);
+
+  map< vector<int>, vector<int> > bins;
+  vector< vector<int> > binIndex(numPoints, vector<int>(3));
+  for(int i=0 ; i<numPoints ; ++i){
+    for(int dof=0 ; dof<3 ; ++dof)
+      binIndex[i][dof] = static_cast<int>((x[3*i+dof] - minCoord[dof])/horizon);
+    bins[binIndex[i]].push_back(i);
+  }
+
+  vector<int> neighborhoodList, neighborhoodPtr(numPoints);
+  vector<int> key(3);
+  for(int i=0 ; i<numPoints ; ++i){
+    neighborhoodPtr[i] = static_cast<int>(neighborhoodList.size());
+    int countIndex = static_cast<int>(neighborhoodList.size());
+    neighborhoodList.push_back(0);
+    for(int bi=-1 ; bi<=1 ; ++bi){
+      for(int bj=-1 ; bj<=1 ; ++bj){
+        for(int bk=-1 ; bk<=1 ; ++bk){
+          key[0] = binIndex[i][0] + bi; key[1] = binIndex[i][1] + bj; key[2] = binIndex[i][2] + bk;
+          map< vector<int>, vector<int> >::const_iterator it = bins.find(key);
+          if(it == bins.end())
+            continue;
+          for(int j : it->second){
+            double dx = x[3*j] - x[3*i], dy = x[3*j+1] - x[3*i+1], dz = x[3*j+2] - x[3*i+2];
+            if(j != i && dx*dx + dy*dy + dz*dz < horizon*horizon)
+              neighborhoodList.push_back(j);
+          }
+        }
+      }
+    }
+    neighborhoodList[countIndex] = static_cast<int>(neighborhoodList.size()) - countIndex - 1;
+  }
+
+  neighborhoodData.SetNumOwned(numPoints);
+  neighborhoodData.SetNeighborhoodListSize(static_cast<int>(neighborhoodList.size()));
+  for(int i=0 ; i<numPoints ; ++i){
+    neighborhoodData.OwnedIDs()[i] = i;
+    neighborhoodData.NeighborhoodPtr()[i] = neighborhoodPtr[i];
+  }
+  memcpy(neighborhoodData.NeighborhoodList(), &neighborhoodList[0], neighborhoodList.size()*sizeof(int));
+  neighborhoodData.BuildCSR();
+}
+
+int main(int argc, char* argv[])
+{
+  string meshFile = argc > 1 ? argv[1] : "fragmenting_cylinder.txt";
+  double horizon = argc > 2 ? atof(argv[2]) : 0.00417462;
+  int numRepetitions = argc > 3 ? atoi(argv[3]) : 100;
+
+  vector<double> x, volume;
+  readTextFileMesh(meshFile, x, volume);
+  int numPoints = static_cast<int>(volume.size());
+  vector<double> y(x), bondDamage;
+  for(int i=0 ; i<numPoints ; ++i)
+    y[3*i] *= 1.001;
+
+  PeridigmNS::NeighborhoodData neighborhoodData;
+  buildNeighborhoodData(x, horizon, neighborhoodData);
+  int numBonds = neighborhoodData.NumBonds();
+  bondDamage.assign(numBonds, 0.0);
+
+  // Structure-of-arrays copies of the coordinates
+  vector<double> xSoA(3*numPoints), ySoA(3*numPoints);
+  for(int i=0 ; i<numPoints ; ++i){
+    for(int dof=0 ; dof<3 ; ++dof){
+      xSoA[dof*numPoints + i] = x[3*i+dof];
+      ySoA[dof*numPoints + i] = y[3*i+dof];
+    }
+  }
+  const double *x0 = &xSoA[0], *x1 = x0 + numPoints, *x2 = x0 + 2*numPoints;
+  const double *y0 = &ySoA[0], *y1 = y0 + numPoints, *y2 = y0 + 2*numPoints;
+
+  // The kernel is a bond stretch sum, representative of the memory traffic of the force kernels.
+  vector<double> result(numPoints);
+  chrono::duration<double> listTime(0.0), csrTime(0.0), csrRandomTime(0.0), soaTime(0.0);
+  double listChecksum(0.0), csrChecksum(0.0), csrRandomChecksum(0.0), soaChecksum(0.0);
+
+  for(int rep=0 ; rep<numRepetitions ; ++rep){
+
+    chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now();
+    const int* neighborhoodList = neighborhoodData.NeighborhoodList();
+    int neighborhoodListIndex(0), bondIndex(0);
+    for(int i=0 ; i<numPoints ; ++i){
+      double sum = 0.0;
+      int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      for(int n=0 ; n<numNeighbors ; ++n, ++bondIndex){
+        int j = neighborhoodList[neighborhoodListIndex++];
+        double dX = std::sqrt((x[3*j]-x[3*i])*(x[3*j]-x[3*i]) + (x[3*j+1]-x[3*i+1])*(x[3*j+1]-x[3*i+1]) + (x[3*j+2]-x[3*i+2])*(x[3*j+2]-x[3*i+2]));
+        double dY = std::sqrt((y[3*j]-y[3*i])*(y[3*j]-y[3*i]) + (y[3*j+1]-y[3*i+1])*(y[3*j+1]-y[3*i+1]) + (y[3*j+2]-y[3*i+2])*(y[3*j+2]-y[3*i+2]));
+        sum += (1.0 - bondDamage[bondIndex])*(dY - dX)/dX*volume[j];
+      }
+      result[i] = sum;
+    }
+    listTime += chrono::high_resolution_clock::now() - start;
+    for(int i=0 ; i<numPoints ; ++i)
+      listChecksum += result[i];
+
+    start = chrono::high_resolution_clock::now();
+    for(int i=0 ; i<numPoints ; ++i){
+      double sum = 0.0;
+      PeridigmNS::NeighborRange neighbors = neighborhoodData.Neighbors(i);
+      const double* damage = &bondDamage[0] + neighbors.bondOffset();
+      for(int n=0 ; n<neighbors.size() ; ++n){
+        int j = neighbors[n];
+        double dX = std::sqrt((x[3*j]-x[3*i])*(x[3*j]-x[3*i]) + (x[3*j+1]-x[3*i+1])*(x[3*j+1]-x[3*i+1]) + (x[3*j+2]-x[3*i+2])*(x[3*j+2]-x[3*i+2]));
+        double dY = std::sqrt((y[3*j]-y[3*i])*(y[3*j]-y[3*i]) + (y[3*j+1]-y[3*i+1])*(y[3*j+1]-y[3*i+1]) + (y[3*j+2]-y[3*i+2])*(y[3*j+2]-y[3*i+2]));
+        sum += (1.0 - damage[n])*(dY - dX)/dX*volume[j];
+      }
+      result[i] = sum;
+    }
+    csrTime += chrono::high_resolution_clock::now() - start;
+    for(int i=0 ; i<numPoints ; ++i)
+      csrChecksum += result[i];
+
+    // random access by point, which the count-prefixed list can only provide through NeighborhoodPtr()
+    start = chrono::high_resolution_clock::now();
+    for(int k=0 ; k<numPoints ; ++k){
+      int i = (static_cast<long long>(k)*7919) % numPoints;
+      double sum = 0.0;
+      PeridigmNS::NeighborRange neighbors = neighborhoodData.Neighbors(i);
+      const double* damage = &bondDamage[0] + neighbors.bondOffset();
+      for(int n=0 ; n<neighbors.size() ; ++n){
+        int j = neighbors[n];
+        double dX = std::sqrt((x[3*j]-x[3*i])*(x[3*j]-x[3*i]) + (x[3*j+1]-x[3*i+1])*(x[3*j+1]-x[3*i+1]) + (x[3*j+2]-x[3*i+2])*(x[3*j+2]-x[3*i+2]));
+        double dY = std::sqrt((y[3*j]-y[3*i])*(y[3*j]-y[3*i]) + (y[3*j+1]-y[3*i+1])*(y[3*j+1]-y[3*i+1]) + (y[3*j+2]-y[3*i+2])*(y[3*j+2]-y[3*i+2]));
+        sum += (1.0 - damage[n])*(dY - dX)/dX*volume[j];
+      }
+      result[i] = sum;
+    }
+    csrRandomTime += chrono::high_resolution_clock::now() - start;
+    for(int i=0 ; i<numPoints ; ++i)
+      csrRandomChecksum += result[i];
+
+    // structure-of-arrays coordinates, same traversal as the CSR sweep
+    start = chrono::high_resolution_clock::now();
+    for(int i=0 ; i<numPoints ; ++i){
+      double sum = 0.0;
+      PeridigmNS::NeighborRange neighbors = neighborhoodData.Neighbors(i);
+      const int* neighborIds = neighbors.begin();
+      const double* damage = &bondDamage[0] + neighbors.bondOffset();
+      int numNeighbors = neighbors.size();
+#ifdef _OPENMP
+#pragma omp simd reduction(+:sum)
+#endif
+      for(int n=0 ; n<numNeighbors ; ++n){
+        int j = neighborIds[n];
+        double dX = std::sqrt((x0[j]-x0[i])*(x0[j]-x0[i]) + (x1[j]-x1[i])*(x1[j]-x1[i]) + (x2[j]-x2[i])*(x2[j]-x2[i]));
+        double dY = std::sqrt((y0[j]-y0[i])*(y0[j]-y0[i]) + (y1[j]-y1[i])*(y1[j]-y1[i]) + (y2[j]-y2[i])*(y2[j]-y2[i]));
+        sum += (1.0 - damage[n])*(dY - dX)/dX*volume[j];
+      }
+      result[i] = sum;
+    }
+    soaTime += chrono::high_resolution_clock::now() - start;
+    for(int i=0 ; i<numPoints ; ++i)
+      soaChecksum += result[i];
+  }
+
+  cout << "\nNeighbor traversal benchmark: " << meshFile << endl;
+  cout << "  points " << numPoints << ", bonds " << numBonds << ", repetitions " << numRepetitions << endl;
+  cout << "  neighbor list sweep    " << listTime.count()/numRepetitions*1.0e3 << " ms/sweep  (checksum " << listChecksum << ")" << endl;
+  cout << "  CSR sweep              " << csrTime.count()/numRepetitions*1.0e3 << " ms/sweep  (checksum " << csrChecksum << ")" << endl;
+  cout << "  CSR random-order sweep " << csrRandomTime.count()/numRepetitions*1.0e3 << " ms/sweep  (checksum " << csrRandomChecksum << ")" << endl;
+  cout << "  CSR sweep, SoA coords  " << soaTime.count()/numRepetitions*1.0e3 << " ms/sweep  (checksum " << soaChecksum << ")" << endl;
+  double bondsSwept = static_cast<double>(numBonds)*numRepetitions;
+  cout << "  bonds/second, interleaved coordinates         " << bondsSwept/csrTime.count() << endl;
+  cout << "  bonds/second, structure-of-arrays coordinates " << bondsSwept/soaTime.count() << endl;
+  cout << "  CSR storage " << neighborhoodData.memorySize() << " MB total for neighborhood data\n" << endl;
+
+  return 0;
+}
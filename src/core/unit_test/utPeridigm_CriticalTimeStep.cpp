@@ -0,0 +1,273 @@
+/*! \file utPeridigm_CriticalTimeStep.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_CriticalTimeStep.hpp"
+#include "Peridigm_HorizonManager.hpp"
+#include "Peridigm_Block.hpp"
+#include "Peridigm_Field.hpp"
+#include "Peridigm_ElasticMaterial.hpp"
+#include "Peridigm_Constants.hpp"
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#ifdef HAVE_MPI
+  #include <Epetra_MpiComm.h>
+#else
+  #include <Epetra_SerialComm.h>
+#endif
+#include <vector>
+#include <set>
+#include <cmath>
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+const int numPoints = 9;
+const double horizon = 2.5;
+const double density = 7800.0;
+const double bulkModulus = 130.0e9;
+
+//! Creates a block of numPoints points with unit volume on the x axis at unit spacing, each bonded to the points within two places of it.
+Block createBlock(const Epetra_Comm& comm)
+{
+  RCP<Epetra_BlockMap> ownedScalarPointMap = rcp(new Epetra_BlockMap(numPoints, 1, 0, comm));
+  RCP<Epetra_BlockMap> ownedVectorPointMap = rcp(new Epetra_BlockMap(numPoints, 3, 0, comm));
+  const int numOwnedPoints = ownedScalarPointMap->NumMyElements();
+  const int* ownedGIDs = ownedScalarPointMap->MyGlobalElements();
+
+  // The overlap map lists the owned points first, followed by the ghosted neighbors
+  vector<int> overlapGIDs(ownedGIDs, ownedGIDs + numOwnedPoints);
+  set<int> ghosts;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    for(int gid=ownedGIDs[i]-2 ; gid<=ownedGIDs[i]+2 ; ++gid){
+      if(gid >= 0 && gid < numPoints && !ownedScalarPointMap->MyGID(gid))
+        ghosts.insert(gid);
+    }
+  }
+  overlapGIDs.insert(overlapGIDs.end(), ghosts.begin(), ghosts.end());
+  RCP<Epetra_BlockMap> overlapScalarPointMap = rcp(new Epetra_BlockMap(-1, overlapGIDs.size(), &overlapGIDs[0], 1, 0, comm));
+  RCP<Epetra_BlockMap> overlapVectorPointMap = rcp(new Epetra_BlockMap(-1, overlapGIDs.size(), &overlapGIDs[0], 3, 0, comm));
+
+  vector<int> neighborhoodList, neighborhoodPtr, bondElementSize;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    neighborhoodPtr.push_back(neighborhoodList.size());
+    vector<int> neighbors;
+    for(int gid=ownedGIDs[i]-2 ; gid<=ownedGIDs[i]+2 ; ++gid){
+      if(gid >= 0 && gid < numPoints && gid != ownedGIDs[i])
+        neighbors.push_back(overlapScalarPointMap->LID(gid));
+    }
+    neighborhoodList.push_back(neighbors.size());
+    neighborhoodList.insert(neighborhoodList.end(), neighbors.begin(), neighbors.end());
+    bondElementSize.push_back(neighbors.size());
+  }
+  RCP<Epetra_BlockMap> ownedScalarBondMap = rcp(new Epetra_BlockMap(-1, numOwnedPoints, const_cast<int*>(ownedGIDs), &bondElementSize[0], 0, comm));
+
+  RCP<NeighborhoodData> neighborhoodData = rcp(new NeighborhoodData);
+  neighborhoodData->SetNumOwned(numOwnedPoints);
+  neighborhoodData->SetNeighborhoodListSize(neighborhoodList.size());
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    neighborhoodData->OwnedIDs()[i] = i;
+    neighborhoodData->NeighborhoodPtr()[i] = neighborhoodPtr[i];
+  }
+  for(unsigned int i=0 ; i<neighborhoodList.size() ; ++i)
+    neighborhoodData->NeighborhoodList()[i] = neighborhoodList[i];
+  neighborhoodData->BuildCSR();
+
+  RCP<Epetra_Vector> blockIds = rcp(new Epetra_Vector(*ownedScalarPointMap));
+  blockIds->PutScalar(1.0);
+
+  ParameterList horizonParams;
+  ParameterList& horizonBlockParams = horizonParams.sublist("My Block");
+  horizonBlockParams.set("Block Names", "block_1");
+  horizonBlockParams.set("Horizon", horizon);
+  HorizonManager::self().loadHorizonInformationFromBlockParameters(horizonParams);
+
+  ParameterList materialParams;
+  materialParams.set("Density", density);
+  materialParams.set("Bulk Modulus", bulkModulus);
+  materialParams.set("Shear Modulus", 78.0e9);
+  materialParams.set("Horizon", horizon);
+
+  ParameterList blockParams;
+  blockParams.set("Material", "My Elastic Material");
+  Block block("block_1", 1, blockParams);
+  block.setMaterialModel(rcp(new ElasticMaterial(materialParams)));
+  block.initialize(ownedScalarPointMap,
+                   overlapScalarPointMap,
+                   ownedVectorPointMap,
+                   overlapVectorPointMap,
+                   ownedScalarBondMap,
+                   blockIds,
+                   neighborhoodData);
+
+  FieldManager& fieldManager = FieldManager::self();
+  block.getData(fieldManager.getFieldId("Volume"), PeridigmField::STEP_NONE)->PutScalar(1.0);
+  Epetra_Vector& x = *block.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+  x.PutScalar(0.0);
+  for(int i=0 ; i<x.Map().NumMyElements() ; ++i)
+    x[3*i] = x.Map().GID(i);
+  *block.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_N) = x;
+  block.getData(fieldManager.getFieldId("Bond_Damage"), PeridigmField::STEP_N)->PutScalar(0.0);
+
+  return block;
+}
+
+//! Scales the current (STEP_N) coordinates of the block by the given factor, relative to the origin.
+void setStretch(Block& block, double stretch)
+{
+  FieldManager& fieldManager = FieldManager::self();
+  *block.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_N) = *block.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE);
+  block.getData(fieldManager.getFieldId("Coordinates"), PeridigmField::STEP_N)->Scale(stretch);
+}
+
+//! The critical time step of a point with neighbors at distances 1, 1, 2, and 2, which is the smallest in the block.
+double referenceCriticalTimeStep()
+{
+  double springConstant = 18.0*bulkModulus/(value_of_pi()*horizon*horizon*horizon*horizon);
+  return std::sqrt(2.0*density/(springConstant*(1.0 + 1.0 + 0.5 + 0.5)));
+}
+
+RCP<Epetra_Comm> createComm()
+{
+  RCP<Epetra_Comm> comm;
+#ifdef HAVE_MPI
+  comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+#else
+  comm = rcp(new Epetra_SerialComm);
+#endif
+  return comm;
+}
+
+//! Without damage or deformation, the estimate from the current configuration equals the estimate from the reference configuration.
+
+TEUCHOS_UNIT_TEST(CriticalTimeStep, ReferenceConfiguration) {
+
+  RCP<Epetra_Comm> comm = createComm();
+  Block block = createBlock(*comm);
+
+  double referenceTimeStep = ComputeCriticalTimeStep(*comm, block);
+  TEST_FLOATING_EQUALITY(referenceTimeStep, referenceCriticalTimeStep(), 1.0e-12);
+  TEST_FLOATING_EQUALITY(ComputeCriticalTimeStep(*comm, block, true), referenceTimeStep, 1.0e-12);
+}
+
+//! Damaged and broken bonds increase the critical time step in proportion to 1/sqrt(1 - damage).
+
+TEUCHOS_UNIT_TEST(CriticalTimeStep, BrokenBonds) {
+
+  RCP<Epetra_Comm> comm = createComm();
+  Block block = createBlock(*comm);
+  double referenceTimeStep = referenceCriticalTimeStep();
+
+  FieldManager& fieldManager = FieldManager::self();
+  Epetra_Vector& bondDamage = *block.getData(fieldManager.getFieldId("Bond_Damage"), PeridigmField::STEP_N);
+
+  // Half damage on every bond halves every bond stiffness
+  bondDamage.PutScalar(0.5);
+  TEST_FLOATING_EQUALITY(ComputeCriticalTimeStep(*comm, block, true), std::sqrt(2.0)*referenceTimeStep, 1.0e-12);
+
+  // Break the bonds of unit length, leaving each interior point with its two bonds of length two
+  double* x;
+  block.getData(fieldManager.getFieldId("Model_Coordinates"), PeridigmField::STEP_NONE)->ExtractView(&x);
+  RCP<NeighborhoodData> neighborhoodData = block.getNeighborhoodData();
+  int bondIndex = 0;
+  for(int iID=0 ; iID<neighborhoodData->NumOwnedPoints() ; ++iID){
+    int nodeID = neighborhoodData->OwnedIDs()[iID];
+    for(int neighborID : neighborhoodData->Neighbors(iID)){
+      bondDamage[bondIndex] = (std::abs(x[3*neighborID] - x[3*nodeID]) < 1.5) ? 1.0 : 0.0;
+      bondIndex += 1;
+    }
+  }
+  TEST_FLOATING_EQUALITY(ComputeCriticalTimeStep(*comm, block, true), std::sqrt(3.0)*referenceTimeStep, 1.0e-12);
+
+  // The estimate from the reference configuration ignores the damage
+  TEST_FLOATING_EQUALITY(ComputeCriticalTimeStep(*comm, block), referenceTimeStep, 1.0e-12);
+}
+
+//! Compressed bonds decrease the critical time step, stretched bonds keep their reference length.
+
+TEUCHOS_UNIT_TEST(CriticalTimeStep, CompressedBonds) {
+
+  RCP<Epetra_Comm> comm = createComm();
+  Block block = createBlock(*comm);
+  double referenceTimeStep = referenceCriticalTimeStep();
+
+  // Bond stiffness varies as 1/length, so the time step varies as sqrt(length)
+  setStretch(block, 0.9);
+  TEST_FLOATING_EQUALITY(ComputeCriticalTimeStep(*comm, block, true), std::sqrt(0.9)*referenceTimeStep, 1.0e-12);
+
+  setStretch(block, 1.1);
+  TEST_FLOATING_EQUALITY(ComputeCriticalTimeStep(*comm, block, true), referenceTimeStep, 1.0e-12);
+
+  // The estimate from the reference configuration ignores the deformation
+  setStretch(block, 0.9);
+  TEST_FLOATING_EQUALITY(ComputeCriticalTimeStep(*comm, block), referenceTimeStep, 1.0e-12);
+}
+
+//! The adaptive time step is limited by the growth factor and clamped to the minimum and maximum time steps.
+
+TEUCHOS_UNIT_TEST(CriticalTimeStep, AdaptiveTimeStep) {
+
+  // A larger critical time step is approached at no more than the growth factor per update
+  TEST_FLOATING_EQUALITY(AdaptiveTimeStep(2.0, 0.5, 0.5, 1.1, 0.0, 1.0e50), 0.55, 1.0e-14);
+  TEST_FLOATING_EQUALITY(AdaptiveTimeStep(2.0, 0.5, 0.95, 1.1, 0.0, 1.0e50), 1.0, 1.0e-14);
+
+  // A smaller critical time step is taken immediately
+  TEST_FLOATING_EQUALITY(AdaptiveTimeStep(1.0, 0.5, 2.0, 1.1, 0.0, 1.0e50), 0.5, 1.0e-14);
+
+  // The bounds take precedence over the critical time step and the growth factor
+  TEST_FLOATING_EQUALITY(AdaptiveTimeStep(1.0, 0.5, 2.0, 1.1, 0.8, 1.0e50), 0.8, 1.0e-14);
+  TEST_FLOATING_EQUALITY(AdaptiveTimeStep(2.0, 0.5, 0.5, 1.1, 0.0, 0.52), 0.52, 1.0e-14);
+}
+
+int main( int argc, char* argv[] ) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,151 @@
+/*! \file utPeridigm_DataManager.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#include "Peridigm_DataManager.hpp"
+#include "Peridigm_Field.hpp"
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <Epetra_SerialComm.h>
+#include <vector>
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+//! Stores the step N values of one bond field in single precision and checks the storage, the step NP1 data, and the step update.
+
+TEUCHOS_UNIT_TEST(DataManager, SinglePrecisionData) {
+
+  // Three points with two, one, and zero bonds
+  Epetra_SerialComm comm;
+  int numPoints = 3;
+  vector<int> globalIDs(numPoints), bondElementSizes(numPoints);
+  for(int i=0 ; i<numPoints ; ++i)
+    globalIDs[i] = i;
+  bondElementSizes[0] = 2;
+  bondElementSizes[1] = 1;
+  bondElementSizes[2] = 0;
+  RCP<Epetra_BlockMap> scalarMap = rcp(new Epetra_BlockMap(-1, numPoints, &globalIDs[0], 1, 0, comm));
+  RCP<Epetra_BlockMap> vectorMap = rcp(new Epetra_BlockMap(-1, numPoints, &globalIDs[0], 3, 0, comm));
+  RCP<Epetra_BlockMap> bondMap = rcp(new Epetra_BlockMap(-1, numPoints, &globalIDs[0], &bondElementSizes[0], 0, comm));
+
+  FieldManager& fieldManager = FieldManager::self();
+  int volumeFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Volume");
+  int bondDamageFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Bond_Damage");
+  int stretchFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Left_Stretch_Tensor_XX");
+  vector<int> fieldIds, singlePrecisionFieldIds;
+  fieldIds.push_back(volumeFieldId);
+  fieldIds.push_back(bondDamageFieldId);
+  fieldIds.push_back(stretchFieldId);
+  // Only two-step bond fields are stored in single precision, the volume is ignored
+  singlePrecisionFieldIds.push_back(volumeFieldId);
+  singlePrecisionFieldIds.push_back(stretchFieldId);
+
+  DataManager reference;
+  reference.setMaps(scalarMap, scalarMap, vectorMap, vectorMap, bondMap);
+  reference.allocateData(fieldIds);
+
+  DataManager dataManager;
+  dataManager.setMaps(scalarMap, scalarMap, vectorMap, vectorMap, bondMap);
+  dataManager.setSinglePrecisionFieldIds(singlePrecisionFieldIds);
+  dataManager.allocateData(fieldIds);
+  TEST_ASSERT(dataManager.hasSinglePrecisionData());
+  TEST_ASSERT(dataManager.hasSinglePrecisionData(stretchFieldId));
+  TEST_ASSERT(!dataManager.hasSinglePrecisionData(volumeFieldId));
+  TEST_ASSERT(!dataManager.hasSinglePrecisionData(bondDamageFieldId));
+
+  // The step NP1 values are available, the step N values only through the single-precision store
+  TEST_ASSERT(dataManager.hasData(stretchFieldId, PeridigmField::STEP_NP1));
+  TEST_ASSERT(!dataManager.hasData(stretchFieldId, PeridigmField::STEP_N));
+  TEST_THROW(dataManager.getData(stretchFieldId, PeridigmField::STEP_N), Teuchos::RangeError);
+  TEST_ASSERT(dataManager.hasData(bondDamageFieldId, PeridigmField::STEP_N));
+
+  // Each bond holds one double and one float instead of two doubles
+  double megabytesPerBond = 1.0/1048576.0;
+  TEST_FLOATING_EQUALITY(reference.bondDataMemorySize(), 3*4*sizeof(double)*megabytesPerBond, 1.0e-12);
+  TEST_FLOATING_EQUALITY(dataManager.bondDataMemorySize(), 3*(3*sizeof(double) + sizeof(float))*megabytesPerBond, 1.0e-12);
+  TEST_FLOATING_EQUALITY(dataManager.singlePrecisionMemorySaving(), 3*(sizeof(double) - sizeof(float))*megabytesPerBond, 1.0e-12);
+
+  // The step update rounds the step NP1 values to single precision
+  Epetra_Vector& stretch = *dataManager.getData(stretchFieldId, PeridigmField::STEP_NP1);
+  TEST_EQUALITY(stretch.MyLength(), 3);
+  double values[] = {1.0 + 1.0e-12, 0.25, -3.0e10};
+  for(int i=0 ; i<3 ; ++i)
+    stretch[i] = values[i];
+  dataManager.updateState();
+  const float* stretchN = dataManager.getSinglePrecisionData(stretchFieldId);
+  for(int i=0 ; i<3 ; ++i)
+    TEST_EQUALITY(stretchN[i], static_cast<float>(values[i]));
+
+  // The step NP1 values are kept until they are overwritten with the step N values
+  TEST_EQUALITY(stretch[0], values[0]);
+  dataManager.copySinglePrecisionDataToField(stretchFieldId);
+  TEST_EQUALITY(stretch[0], 1.0);
+  TEST_EQUALITY(stretch[1], 0.25);
+  TEST_FLOATING_EQUALITY(stretch[2], -3.0e10, 1.0e-7);
+
+  // A copy by global ID includes the single-precision values
+  DataManager copy;
+  copy.setMaps(scalarMap, scalarMap, vectorMap, vectorMap, bondMap);
+  copy.setSinglePrecisionFieldIds(singlePrecisionFieldIds);
+  copy.allocateData(fieldIds);
+  copy.copyLocallyOwnedDataFromDataManager(dataManager);
+  for(int i=0 ; i<3 ; ++i)
+    TEST_EQUALITY(copy.getSinglePrecisionData(stretchFieldId)[i], stretchN[i]);
+
+  // Fields must be selected prior to allocation
+  TEST_THROW(dataManager.setSinglePrecisionFieldIds(singlePrecisionFieldIds), Teuchos::RangeError);
+}
+
+int main( int argc, char* argv[] ) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
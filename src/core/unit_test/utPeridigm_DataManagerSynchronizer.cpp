@@ -0,0 +1,256 @@
+/*! \file utPeridigm_DataManagerSynchronizer.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_Block.hpp"
+#include "Peridigm_Field.hpp"
+#include "Peridigm_ElasticMaterial.hpp"
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#ifdef HAVE_MPI
+  #include <Epetra_MpiComm.h>
+#else
+  #include <Epetra_SerialComm.h>
+#endif
+#include <vector>
+#include <set>
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+//! Global maps, block ids, and neighborhood data for a row of points split between two interleaved blocks.
+struct TwoBlockModel {
+  RCP<Epetra_BlockMap> ownedScalarPointMap;
+  RCP<Epetra_BlockMap> overlapScalarPointMap;
+  RCP<Epetra_BlockMap> ownedVectorPointMap;
+  RCP<Epetra_BlockMap> overlapVectorPointMap;
+  RCP<Epetra_BlockMap> ownedScalarBondMap;
+  RCP<Epetra_Vector> blockIds;
+  RCP<NeighborhoodData> neighborhoodData;
+};
+
+//! Points 0 to numPoints-1 lie on a line; even points are in block 1, odd points in block 2, and each point is bonded to the points within two places of it.
+TwoBlockModel createTwoBlockModel(const Epetra_Comm& comm, int numPoints)
+{
+  TwoBlockModel model;
+  model.ownedScalarPointMap = rcp(new Epetra_BlockMap(numPoints, 1, 0, comm));
+  model.ownedVectorPointMap = rcp(new Epetra_BlockMap(numPoints, 3, 0, comm));
+  const int numOwnedPoints = model.ownedScalarPointMap->NumMyElements();
+  const int* ownedGIDs = model.ownedScalarPointMap->MyGlobalElements();
+
+  // The overlap map lists the owned points first, followed by the ghosted neighbors
+  vector<int> overlapGIDs(ownedGIDs, ownedGIDs + numOwnedPoints);
+  set<int> ghosts;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    for(int gid=ownedGIDs[i]-2 ; gid<=ownedGIDs[i]+2 ; ++gid){
+      if(gid >= 0 && gid < numPoints && !model.ownedScalarPointMap->MyGID(gid))
+        ghosts.insert(gid);
+    }
+  }
+  overlapGIDs.insert(overlapGIDs.end(), ghosts.begin(), ghosts.end());
+  model.overlapScalarPointMap = rcp(new Epetra_BlockMap(-1, overlapGIDs.size(), &overlapGIDs[0], 1, 0, comm));
+  model.overlapVectorPointMap = rcp(new Epetra_BlockMap(-1, overlapGIDs.size(), &overlapGIDs[0], 3, 0, comm));
+
+  vector<int> neighborhoodList, neighborhoodPtr, bondElementSize;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    neighborhoodPtr.push_back(neighborhoodList.size());
+    vector<int> neighbors;
+    for(int gid=ownedGIDs[i]-2 ; gid<=ownedGIDs[i]+2 ; ++gid){
+      if(gid >= 0 && gid < numPoints && gid != ownedGIDs[i])
+        neighbors.push_back(model.overlapScalarPointMap->LID(gid));
+    }
+    neighborhoodList.push_back(neighbors.size());
+    neighborhoodList.insert(neighborhoodList.end(), neighbors.begin(), neighbors.end());
+    bondElementSize.push_back(neighbors.size());
+  }
+  model.ownedScalarBondMap = rcp(new Epetra_BlockMap(-1, numOwnedPoints, const_cast<int*>(ownedGIDs), &bondElementSize[0], 0, comm));
+
+  model.neighborhoodData = rcp(new NeighborhoodData);
+  model.neighborhoodData->SetNumOwned(numOwnedPoints);
+  model.neighborhoodData->SetNeighborhoodListSize(neighborhoodList.size());
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    model.neighborhoodData->OwnedIDs()[i] = i;
+    model.neighborhoodData->NeighborhoodPtr()[i] = neighborhoodPtr[i];
+  }
+  for(unsigned int i=0 ; i<neighborhoodList.size() ; ++i)
+    model.neighborhoodData->NeighborhoodList()[i] = neighborhoodList[i];
+  model.neighborhoodData->BuildCSR();
+
+  model.blockIds = rcp(new Epetra_Vector(*model.ownedScalarPointMap));
+  for(int i=0 ; i<numOwnedPoints ; ++i)
+    (*model.blockIds)[i] = (ownedGIDs[i]%2 == 0) ? 1.0 : 2.0;
+
+  return model;
+}
+
+//! Creates the two blocks with the given fields, filling every owned and ghosted entry with a value unique to the block, point, field, and component.
+RCP< vector<Block> > createBlocks(const TwoBlockModel& model, const vector<int>& fieldIds, const vector<PeridigmField::Step>& steps)
+{
+  ParameterList materialParams;
+  materialParams.set("Density", 7800.0);
+  materialParams.set("Bulk Modulus", 130.0e9);
+  materialParams.set("Shear Modulus", 78.0e9);
+  materialParams.set("Horizon", 2.5);
+
+  RCP< vector<Block> > blocks = rcp(new vector<Block>);
+  for(int blockID=1 ; blockID<=2 ; ++blockID){
+    ParameterList blockParams;
+    blockParams.set("Material", "My Elastic Material");
+    Block block(blockID == 1 ? "block_1" : "block_2", blockID, blockParams);
+    block.setMaterialModel(rcp(new ElasticMaterial(materialParams)));
+    block.setAuxiliaryFieldIds(fieldIds);
+    blocks->push_back(block);
+  }
+
+  for(vector<Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+    blockIt->initialize(model.ownedScalarPointMap,
+                        model.overlapScalarPointMap,
+                        model.ownedVectorPointMap,
+                        model.overlapVectorPointMap,
+                        model.ownedScalarBondMap,
+                        model.blockIds,
+                        model.neighborhoodData);
+    for(unsigned int iField=0 ; iField<fieldIds.size() ; ++iField){
+      RCP<Epetra_Vector> data = blockIt->getData(fieldIds[iField], steps[iField]);
+      const int length = data->Map().ElementSize();
+      for(int i=0 ; i<data->Map().NumMyElements() ; ++i){
+        const int gid = data->Map().GID(i);
+        for(int dof=0 ; dof<length ; ++dof)
+          (*data)[length*i + dof] = 1000.0*blockIt->getID() + 10.0*gid + iField + 0.1*dof;
+      }
+    }
+  }
+  return blocks;
+}
+
+//! Sums the blocks' contributions and copies the sum back one field at a time, as was done before the fields were packed.
+void synchronizeFieldByField(RCP< vector<Block> > blocks, const TwoBlockModel& model,
+                             const vector<int>& fieldIds, const vector<PeridigmField::Step>& steps)
+{
+  for(unsigned int iField=0 ; iField<fieldIds.size() ; ++iField){
+    PeridigmField::Length length = FieldManager::self().getFieldSpec(fieldIds[iField]).getLength();
+    const Epetra_BlockMap& map = (length == PeridigmField::SCALAR) ? *model.ownedScalarPointMap : *model.ownedVectorPointMap;
+    RCP<Epetra_Vector> scratch = rcp(new Epetra_Vector(map));
+    RCP<Epetra_Vector> sum = rcp(new Epetra_Vector(map));
+    for(vector<Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++){
+      scratch->PutScalar(0.0);
+      blockIt->exportData(scratch, fieldIds[iField], steps[iField], Add);
+      sum->Update(1.0, *scratch, 1.0);
+    }
+    for(vector<Block>::iterator blockIt = blocks->begin() ; blockIt != blocks->end() ; blockIt++)
+      blockIt->importData(sum, fieldIds[iField], steps[iField], Insert);
+  }
+}
+
+//! The packed exchange of scalar and vector fields gives the same block data as exchanging the fields one at a time.
+
+TEUCHOS_UNIT_TEST(DataManagerSynchronizer, PackedMatchesFieldByField) {
+
+  RCP<Epetra_Comm> comm;
+#ifdef HAVE_MPI
+  comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+#else
+  comm = rcp(new Epetra_SerialComm);
+#endif
+
+  TwoBlockModel model = createTwoBlockModel(*comm, 12);
+
+  FieldManager& fm = FieldManager::self();
+  vector<int> fieldIds;
+  vector<PeridigmField::Step> steps;
+  fieldIds.push_back(fm.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Synchronizer_Test_Scalar"));
+  steps.push_back(PeridigmField::STEP_NONE);
+  fieldIds.push_back(fm.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::CONSTANT, "Synchronizer_Test_Vector"));
+  steps.push_back(PeridigmField::STEP_NONE);
+  fieldIds.push_back(fm.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Synchronizer_Test_Two_Step_Scalar"));
+  steps.push_back(PeridigmField::STEP_NP1);
+  fieldIds.push_back(fm.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Synchronizer_Test_Two_Step_Vector"));
+  steps.push_back(PeridigmField::STEP_NP1);
+
+  RCP< vector<Block> > packedBlocks = createBlocks(model, fieldIds, steps);
+  RCP< vector<Block> > referenceBlocks = createBlocks(model, fieldIds, steps);
+
+  DataManagerSynchronizer& synchronizer = DataManagerSynchronizer::self();
+  synchronizer.initialize(model.ownedScalarPointMap, model.ownedVectorPointMap);
+
+  // Exchange all the fields, then subsets with fewer columns, then all the fields again with the cached multivectors
+  vector<int> scalarFieldIds(1, fieldIds[0]);
+  vector<PeridigmField::Step> scalarSteps(1, steps[0]);
+  vector<int> vectorFieldIds(1, fieldIds[3]);
+  vector<PeridigmField::Step> vectorSteps(1, steps[3]);
+  synchronizer.synchronize(packedBlocks, fieldIds);
+  synchronizeFieldByField(referenceBlocks, model, fieldIds, steps);
+  synchronizer.synchronize(packedBlocks, scalarFieldIds);
+  synchronizeFieldByField(referenceBlocks, model, scalarFieldIds, scalarSteps);
+  synchronizer.synchronize(packedBlocks, vectorFieldIds);
+  synchronizeFieldByField(referenceBlocks, model, vectorFieldIds, vectorSteps);
+  synchronizer.synchronize(packedBlocks, fieldIds);
+  synchronizeFieldByField(referenceBlocks, model, fieldIds, steps);
+
+  for(unsigned int iBlock=0 ; iBlock<packedBlocks->size() ; ++iBlock){
+    Block& packedBlock = (*packedBlocks)[iBlock];
+    Block& referenceBlock = (*referenceBlocks)[iBlock];
+    // Each block ghosts points of the other block, so the exchange crosses the block boundary
+    TEST_COMPARE(packedBlock.getOverlapScalarPointMap()->NumMyElements(), >, packedBlock.getOwnedScalarPointMap()->NumMyElements());
+    for(unsigned int iField=0 ; iField<fieldIds.size() ; ++iField){
+      const Epetra_Vector& packed = *packedBlock.getData(fieldIds[iField], steps[iField]);
+      const Epetra_Vector& reference = *referenceBlock.getData(fieldIds[iField], steps[iField]);
+      TEST_EQUALITY(packed.MyLength(), reference.MyLength());
+      for(int i=0 ; i<packed.MyLength() ; ++i)
+        TEST_FLOATING_EQUALITY(packed[i], reference[i], 1.0e-14);
+    }
+  }
+}
+
+int main( int argc, char* argv[] ) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
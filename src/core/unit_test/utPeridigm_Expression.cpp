@@ -0,0 +1,162 @@
+/*! \file utPeridigm_Expression.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_Expression.hpp"
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+vector<string> boundaryConditionVariables()
+{
+  vector<string> names;
+  names.push_back("x");
+  names.push_back("y");
+  names.push_back("z");
+  names.push_back("t");
+  names.push_back("value");
+  return names;
+}
+
+TEUCHOS_UNIT_TEST(Expression, Arithmetic) {
+
+  Expression expression(boundaryConditionVariables());
+  double tolerance = 1.0e-14;
+
+  TEST_ASSERT(expression.compile("value = (200 - 50*((z/0.05)-1)^2)*cos(atan2(y,x))"));
+  double values[5] = {0.3, 0.4, 0.02, 1.5, 0.0};
+  TEST_FLOATING_EQUALITY(expression.evaluate(values), (200.0 - 50.0*pow(0.02/0.05 - 1.0, 2))*cos(atan2(0.4, 0.3)), tolerance);
+  TEST_ASSERT(expression.dependsOn(0) && expression.dependsOn(1) && expression.dependsOn(2));
+  TEST_ASSERT(!expression.dependsOn(3));
+
+  // Unary minus applies to the power, as in the run-time compiler
+  TEST_ASSERT(expression.compile("value = -2^2 + 3*(1 - t)"));
+  TEST_FLOATING_EQUALITY(expression.evaluate(values), -4.0 + 3.0*(1.0 - 1.5), tolerance);
+
+  // Constant subexpressions are folded
+  TEST_ASSERT(expression.compile("value = x*cos(1.5*0.2) - y*sin(1.5*0.2)"));
+  TEST_FLOATING_EQUALITY(expression.evaluate(values), 0.3*cos(0.3) - 0.4*sin(0.3), tolerance);
+  TEST_ASSERT(expression.getNumInstructions() <= 7);
+}
+
+TEUCHOS_UNIT_TEST(Expression, Branches) {
+
+  Expression expression(boundaryConditionVariables());
+  double tolerance = 1.0e-14;
+
+  // Braces escaped for yaml decks are accepted
+  TEST_ASSERT(expression.compile(" if(t <= 0.2)\\{ value = 0.0; \\} else\\{ value = 1000*(t-0.2); \\} "));
+  double values[5] = {0.0, 0.0, 0.0, 0.1, 0.0};
+  TEST_FLOATING_EQUALITY(expression.evaluate(values), 0.0, tolerance);
+  values[3] = 0.5;
+  TEST_FLOATING_EQUALITY(expression.evaluate(values), 300.0, tolerance);
+
+  TEST_ASSERT(expression.compile("double a = x + 1; if(a > 1.5) a = 2*a; else if(a < 1.2){ a = 0; } value = a*t;"));
+  double points[3] = {0.1, 0.3, 0.7};
+  double expected[3] = {0.0, 1.3*0.5, 2.0*1.7*0.5};
+  for(int i=0 ; i<3 ; ++i){
+    values[0] = points[i];
+    TEST_FLOATING_EQUALITY(expression.evaluate(values) + 1.0, expected[i] + 1.0, tolerance);
+  }
+}
+
+TEUCHOS_UNIT_TEST(Expression, BatchEvaluation) {
+
+  Expression expression(boundaryConditionVariables());
+
+  // More points than one batch, with the coordinates interleaved as in the mothership vectors
+  int numPoints = 150;
+  vector<double> coordinates(3*numPoints), result(numPoints);
+  for(int i=0 ; i<numPoints ; ++i){
+    coordinates[3*i] = 0.01*i;
+    coordinates[3*i+1] = 1.0 - 0.005*i;
+    coordinates[3*i+2] = 0.002*i;
+  }
+
+  TEST_ASSERT(expression.compile("if(t<=1){value=-y*1.0e-6*t + x*z;} else{value=-y*1.0e-6;}"));
+  for(int dof=0 ; dof<3 ; ++dof)
+    expression.setVariable(dof, &coordinates[dof], 3);
+  expression.setVariable(3, 0.25);
+  expression.setVariable(4, 0.0);
+  expression.evaluate(numPoints, &result[0]);
+  for(int i=0 ; i<numPoints ; ++i){
+    double values[5] = {coordinates[3*i], coordinates[3*i+1], coordinates[3*i+2], 0.25, 0.0};
+    TEST_EQUALITY(result[i], expression.evaluate(values));
+  }
+
+  // Space-independent functions give the same value everywhere
+  TEST_ASSERT(expression.compile("value = 0.01*t"));
+  TEST_ASSERT(!expression.dependsOn(0));
+  expression.evaluate(numPoints, &result[0]);
+  for(int i=0 ; i<numPoints ; ++i)
+    TEST_FLOATING_EQUALITY(result[i], 0.0025, 1.0e-14);
+}
+
+TEUCHOS_UNIT_TEST(Expression, Unsupported) {
+
+  Expression expression(boundaryConditionVariables());
+
+  // Anything outside the supported syntax is rejected so that the caller can use the run-time compiler
+  TEST_ASSERT(!expression.compile("value = undefinedFunction(x)"));
+  TEST_ASSERT(!expression.isCompiled());
+  TEST_ASSERT(!expression.getErrors().empty());
+  TEST_ASSERT(!expression.compile("value = w"));
+  TEST_ASSERT(!expression.compile("int i = 3; value = i"));
+  TEST_ASSERT(!expression.compile("for(i=0;i<3;i=i+1){ value = value + 1; }"));
+}
+
+int main( int argc, char* argv[] ) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
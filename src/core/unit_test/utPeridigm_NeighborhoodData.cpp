@@ -0,0 +1,123 @@
+/*! \file utPeridigm_NeighborhoodData.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_NeighborhoodData.hpp"
+#include <vector>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+//! Create neighborhood data for four points with 2, 0, 3 and 1 neighbors.
+void createNeighborhoodData(NeighborhoodData& neighborhoodData)
+{
+  int list[] = { 2, 1, 2,   0,   3, 0, 1, 3,   1, 2 };
+  int ptr[] = { 0, 3, 4, 8 };
+  neighborhoodData.SetNumOwned(4);
+  for(int i=0 ; i<4 ; ++i){
+    neighborhoodData.OwnedIDs()[i] = i;
+    neighborhoodData.NeighborhoodPtr()[i] = ptr[i];
+  }
+  neighborhoodData.SetNeighborhoodListSize(10);
+  for(int i=0 ; i<10 ; ++i)
+    neighborhoodData.NeighborhoodList()[i] = list[i];
+}
+
+TEUCHOS_UNIT_TEST(NeighborhoodData, CSR) {
+
+  NeighborhoodData neighborhoodData;
+  createNeighborhoodData(neighborhoodData);
+  TEST_ASSERT(!neighborhoodData.HasCSR());
+  neighborhoodData.BuildCSR();
+  TEST_ASSERT(neighborhoodData.HasCSR());
+  TEST_EQUALITY(neighborhoodData.NumBonds(), 6);
+
+  const int* rowOffsets = neighborhoodData.RowOffsets();
+  int expectedRowOffsets[] = { 0, 2, 2, 5, 6 };
+  for(int i=0 ; i<5 ; ++i)
+    TEST_EQUALITY(rowOffsets[i], expectedRowOffsets[i]);
+
+  const int* columnIds = neighborhoodData.ColumnIds();
+  int expectedColumnIds[] = { 1, 2, 0, 1, 3, 2 };
+  for(int i=0 ; i<6 ; ++i)
+    TEST_EQUALITY(columnIds[i], expectedColumnIds[i]);
+
+  // the iterator API must visit the same neighbors, in the same order, as the neighbor list
+  const int* neighborhoodList = neighborhoodData.NeighborhoodList();
+  int neighborhoodListIndex = 0;
+  for(int i=0 ; i<neighborhoodData.NumOwnedPoints() ; ++i){
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    NeighborRange neighbors = neighborhoodData.Neighbors(i);
+    TEST_EQUALITY(neighbors.size(), numNeighbors);
+    TEST_EQUALITY(neighbors.bondOffset(), neighborhoodData.BondOffset(i));
+    for(int neighborId : neighbors)
+      TEST_EQUALITY(neighborId, neighborhoodList[neighborhoodListIndex++]);
+  }
+
+  // the CSR layout is carried over by the copy constructor
+  NeighborhoodData copy(neighborhoodData);
+  TEST_ASSERT(copy.HasCSR());
+  TEST_EQUALITY(copy.NumNeighbors(2), 3);
+  TEST_EQUALITY(copy.Neighbors(2)[2], 3);
+
+  // and invalidated when the list is resized, after which the CSR accessors throw
+  neighborhoodData.SetNeighborhoodListSize(10);
+  TEST_ASSERT(!neighborhoodData.HasCSR());
+  TEST_THROW(neighborhoodData.NumNeighbors(0), std::logic_error);
+  TEST_THROW(neighborhoodData.BondOffset(0), std::logic_error);
+  TEST_THROW(neighborhoodData.Neighbors(0), std::logic_error);
+}
+
+int main( int argc, char* argv[] ) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
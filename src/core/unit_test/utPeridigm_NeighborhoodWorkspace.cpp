@@ -0,0 +1,186 @@
+/*! \file utPeridigm_NeighborhoodWorkspace.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_NeighborhoodWorkspace.hpp"
+#include "Peridigm_Field.hpp"
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <Epetra_SerialComm.h>
+#include <vector>
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+//! Fills the workspace for a large and then a small neighborhood, checks the copied data and that stale entries are cleared.
+
+TEUCHOS_UNIT_TEST(NeighborhoodWorkspace, Fill) {
+
+  // Four points; point 0 is bonded to points 1, 2, and 3, the others are bonded to point 0 only
+  Epetra_SerialComm comm;
+  int numPoints = 4;
+  vector<int> globalIDs(numPoints), bondElementSizes(numPoints, 1);
+  for(int i=0 ; i<numPoints ; ++i)
+    globalIDs[i] = 10 + i;
+  bondElementSizes[0] = 3;
+  RCP<Epetra_BlockMap> scalarMap = rcp(new Epetra_BlockMap(-1, numPoints, &globalIDs[0], 1, 0, comm));
+  RCP<Epetra_BlockMap> vectorMap = rcp(new Epetra_BlockMap(-1, numPoints, &globalIDs[0], 3, 0, comm));
+  RCP<Epetra_BlockMap> bondMap = rcp(new Epetra_BlockMap(-1, numPoints, &globalIDs[0], &bondElementSizes[0], 0, comm));
+  int neighborhoodList[] = {3, 1, 2, 3, 1, 0, 1, 0, 1, 0};
+
+  FieldManager& fieldManager = FieldManager::self();
+  int volumeFieldId = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Volume");
+  int coordinatesFieldId = fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Coordinates");
+  int bondDamageFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Bond_Damage");
+  vector<int> fieldIds;
+  fieldIds.push_back(volumeFieldId);
+  fieldIds.push_back(coordinatesFieldId);
+  fieldIds.push_back(bondDamageFieldId);
+
+  DataManager dataManager;
+  dataManager.setMaps(scalarMap, scalarMap, vectorMap, vectorMap, bondMap);
+  dataManager.allocateData(fieldIds);
+  Epetra_Vector& volume = *dataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+  Epetra_Vector& coordinates = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+  Epetra_Vector& bondDamage = *dataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+  for(int i=0 ; i<numPoints ; ++i){
+    volume[i] = 1.0 + i;
+    for(int j=0 ; j<3 ; ++j)
+      coordinates[3*i+j] = 10.0*i + j;
+  }
+  for(int i=0 ; i<bondDamage.MyLength() ; ++i)
+    bondDamage[i] = 0.1*(i+1);
+
+  NeighborhoodWorkspace workspace;
+  workspace.allocate(numPoints, neighborhoodList, fieldIds);
+  DataManager& workspaceDataManager = workspace.getDataManager();
+  Epetra_Vector& workspaceVolume = *workspaceDataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+  Epetra_Vector& workspaceCoordinates = *workspaceDataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+  Epetra_Vector& workspaceBondDamage = *workspaceDataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+  TEST_EQUALITY(workspaceVolume.MyLength(), 4);
+  TEST_EQUALITY(workspaceBondDamage.MyLength(), 3);
+
+  // Point 0 and all of its neighbors
+  workspace.fill(dataManager, 0, 3, &neighborhoodList[1]);
+  TEST_EQUALITY(workspace.getNumPoints(), 4);
+  TEST_EQUALITY(workspace.getNeighborhoodList()[0], 3);
+  TEST_EQUALITY(workspace.getOwnedIDs()[0], 0);
+  for(int i=0 ; i<4 ; ++i){
+    TEST_EQUALITY(workspace.getGlobalIDs()[i], 10 + i);
+    TEST_FLOATING_EQUALITY(workspaceVolume[i], 1.0 + i, 1.0e-15);
+    TEST_FLOATING_EQUALITY(workspaceCoordinates[3*i+2], 10.0*i + 2.0, 1.0e-15);
+  }
+  for(int i=0 ; i<3 ; ++i)
+    TEST_FLOATING_EQUALITY(workspaceBondDamage[i], 0.1*(i+1), 1.0e-15);
+
+  // Point 2, whose single neighbor is point 0; the neighbor moves to local ID 1 and the remaining slots are cleared
+  workspace.fill(dataManager, 2, 1, &neighborhoodList[7]);
+  TEST_EQUALITY(workspace.getNumPoints(), 2);
+  TEST_EQUALITY(workspace.getNeighborhoodList()[0], 1);
+  TEST_EQUALITY(workspace.getNeighborhoodList()[1], 1);
+  TEST_EQUALITY(workspace.getGlobalIDs()[0], 12);
+  TEST_EQUALITY(workspace.getGlobalIDs()[1], 10);
+  TEST_FLOATING_EQUALITY(workspaceVolume[0], 3.0, 1.0e-15);
+  TEST_FLOATING_EQUALITY(workspaceVolume[1], 1.0, 1.0e-15);
+  TEST_EQUALITY(workspaceVolume[2], 0.0);
+  TEST_EQUALITY(workspaceVolume[3], 0.0);
+  TEST_FLOATING_EQUALITY(workspaceCoordinates[0], 20.0, 1.0e-15);
+  TEST_EQUALITY(workspaceCoordinates[11], 0.0);
+  TEST_FLOATING_EQUALITY(workspaceBondDamage[0], 0.5, 1.0e-15);
+  TEST_EQUALITY(workspaceBondDamage[1], 0.0);
+  TEST_EQUALITY(workspaceBondDamage[2], 0.0);
+
+  // Reallocating for the same fields and a smaller neighborhood keeps the existing storage
+  workspace.allocate(1, fieldIds);
+  TEST_EQUALITY(&workspace.getDataManager(), &workspaceDataManager);
+}
+
+//! Fills the double-precision workspace from a DataManager that stores the step N bond values in single precision.
+
+TEUCHOS_UNIT_TEST(NeighborhoodWorkspace, SinglePrecisionSource) {
+
+  // Two points bonded to each other
+  Epetra_SerialComm comm;
+  int numPoints = 2;
+  vector<int> globalIDs(numPoints);
+  globalIDs[0] = 10;
+  globalIDs[1] = 11;
+  RCP<Epetra_BlockMap> scalarMap = rcp(new Epetra_BlockMap(-1, numPoints, &globalIDs[0], 1, 0, comm));
+  RCP<Epetra_BlockMap> vectorMap = rcp(new Epetra_BlockMap(-1, numPoints, &globalIDs[0], 3, 0, comm));
+  RCP<Epetra_BlockMap> bondMap = rcp(new Epetra_BlockMap(-1, numPoints, &globalIDs[0], 1, 0, comm));
+  int neighborhoodList[] = {1, 1, 1, 0};
+
+  FieldManager& fieldManager = FieldManager::self();
+  int bondDamageFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Bond_Damage");
+  vector<int> fieldIds(1, bondDamageFieldId);
+
+  DataManager dataManager;
+  dataManager.setMaps(scalarMap, scalarMap, vectorMap, vectorMap, bondMap);
+  dataManager.setSinglePrecisionFieldIds(fieldIds);
+  dataManager.allocateData(fieldIds);
+  Epetra_Vector& bondDamage = *dataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+  bondDamage[0] = 0.1;
+  bondDamage[1] = 0.2;
+  dataManager.updateState();
+  bondDamage[0] = 0.3;
+  bondDamage[1] = 0.4;
+
+  NeighborhoodWorkspace workspace;
+  workspace.allocate(numPoints, neighborhoodList, fieldIds);
+  workspace.fill(dataManager, 1, 1, &neighborhoodList[3]);
+  DataManager& workspaceDataManager = workspace.getDataManager();
+  TEST_EQUALITY((*workspaceDataManager.getData(bondDamageFieldId, PeridigmField::STEP_N))[0], static_cast<double>(0.2f));
+  TEST_EQUALITY((*workspaceDataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1))[0], 0.4);
+}
+
+int main( int argc, char* argv[] ) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,222 @@
+/*! \file utPeridigm_RestartFile.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#include "Peridigm_RestartFile.hpp"
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <cstdio>
+#include <fstream>
+#include <vector>
+#include <sys/stat.h>
+
+#ifdef HAVE_MPI
+  #include <Epetra_MpiComm.h>
+#else
+  #include <Epetra_SerialComm.h>
+#endif
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+Teuchos::RCP<Epetra_Comm> createComm()
+{
+#ifdef HAVE_MPI
+  return rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+#else
+  return rcp(new Epetra_SerialComm);
+#endif
+}
+
+//! Variable-size map over numGlobalElements ids; the ids are dealt round-robin or in contiguous chunks.
+Teuchos::RCP<Epetra_BlockMap> createMap(const Epetra_Comm& comm, int numGlobalElements, bool roundRobin)
+{
+  vector<int> globalIds, elementSizes;
+  int chunk = (numGlobalElements + comm.NumProc() - 1)/comm.NumProc();
+  for(int id=0 ; id<numGlobalElements ; ++id){
+    int owner = roundRobin ? id%comm.NumProc() : id/chunk;
+    if(owner == comm.MyPID()){
+      globalIds.push_back(id);
+      elementSizes.push_back(id%3);
+    }
+  }
+  return rcp(new Epetra_BlockMap(-1, globalIds.size(), globalIds.data(), elementSizes.data(), 0, comm));
+}
+
+void fillVector(Epetra_MultiVector& data)
+{
+  const Epetra_BlockMap& map = data.Map();
+  for(int iVec=0 ; iVec<data.NumVectors() ; ++iVec)
+    for(int lid=0 ; lid<map.NumMyElements() ; ++lid)
+      for(int j=0 ; j<map.ElementSize(lid) ; ++j)
+        data[iVec][map.FirstPointInElement(lid)+j] = 100.0*map.GID(lid) + 10.0*iVec + j;
+}
+
+string createDirectory(const Epetra_Comm& comm, const string& name)
+{
+  if(comm.MyPID() == 0)
+    mkdir(name.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+  comm.Barrier();
+  return name;
+}
+
+TEUCHOS_UNIT_TEST(RestartFile, Compression) {
+
+  vector<char> raw;
+  for(int i=0 ; i<1000 ; ++i)
+    raw.push_back(i < 400 ? 0 : static_cast<char>(i*i));
+  vector<char> packed, decoded;
+  RestartFile::compress(raw, packed);
+  TEST_ASSERT(packed.size() < raw.size());
+  RestartFile::decompress(packed, decoded, raw.size());
+  TEST_ASSERT(decoded == raw);
+
+  // Short buffers exercise the boundaries between runs and literals
+  for(int n=0 ; n<20 ; ++n){
+    vector<char> small(n);
+    for(int i=0 ; i<n ; ++i)
+      small[i] = static_cast<char>((i/3)%2);
+    RestartFile::compress(small, packed);
+    RestartFile::decompress(packed, decoded, small.size());
+    TEST_ASSERT(decoded == small);
+  }
+
+  TEST_THROW(RestartFile::decompress(packed, decoded, raw.size()), std::logic_error);
+}
+
+TEUCHOS_UNIT_TEST(RestartFile, RedistributedReadBack) {
+
+  Teuchos::RCP<Epetra_Comm> comm = createComm();
+  int numGlobalElements = 23;
+
+  Teuchos::RCP<Epetra_BlockMap> writeMap = createMap(*comm, numGlobalElements, true);
+  Epetra_MultiVector written(*writeMap, 2);
+  fillVector(written);
+
+  for(int compress=0 ; compress<2 ; ++compress){
+    string directory = createDirectory(*comm, compress ? "utPeridigm_RestartFile_compressed" : "utPeridigm_RestartFile");
+    {
+      RestartWriter writer(*comm, directory, compress == 1);
+      writer.add("data", written);
+      writer.write(true);
+      writer.wait();
+    }
+    comm->Barrier();
+
+    // Read back onto a different partition
+    Teuchos::RCP<Epetra_BlockMap> readMap = createMap(*comm, numGlobalElements, false);
+    Epetra_MultiVector read(*readMap, 2), expected(*readMap, 2);
+    fillVector(expected);
+    RestartReader reader(*comm, directory);
+    reader.read("data", read);
+
+    for(int iVec=0 ; iVec<2 ; ++iVec)
+      for(int i=0 ; i<readMap->NumMyPoints() ; ++i)
+        TEST_FLOATING_EQUALITY(read[iVec][i] + 1.0, expected[iVec][i] + 1.0, 1.0e-15);
+  }
+}
+
+TEUCHOS_UNIT_TEST(RestartFile, Checksum) {
+
+  Teuchos::RCP<Epetra_Comm> comm = createComm();
+
+  Teuchos::RCP<Epetra_BlockMap> map = createMap(*comm, 10, true);
+  Epetra_MultiVector data(*map, 1);
+  fillVector(data);
+
+  string directory = createDirectory(*comm, "utPeridigm_RestartFile_corrupt");
+  {
+    RestartWriter writer(*comm, directory, false);
+    writer.add("data", data);
+    writer.write(false);
+  }
+  comm->Barrier();
+
+  // Only the record read by rank 0 is corrupted; every rank must throw rather than wait in the import
+  if(comm->MyPID() == 0){
+    fstream file(RestartFile::rankFileName(directory, 0).c_str(), ios::in | ios::out | ios::binary);
+    file.seekp(-4, ios::end);
+    file.put('x');
+  }
+  comm->Barrier();
+
+  RestartReader reader(*comm, directory);
+  TEST_THROW(reader.read("data", data), std::logic_error);
+}
+
+TEUCHOS_UNIT_TEST(RestartFile, MissingFile) {
+
+  Teuchos::RCP<Epetra_Comm> comm = createComm();
+
+  Teuchos::RCP<Epetra_BlockMap> map = createMap(*comm, 10, true);
+  Epetra_MultiVector data(*map, 1);
+  fillVector(data);
+
+  string directory = createDirectory(*comm, "utPeridigm_RestartFile_missing");
+  {
+    RestartWriter writer(*comm, directory, false);
+    writer.add("data", data);
+    writer.write(false);
+  }
+  comm->Barrier();
+
+  // The file of the last rank is missing; the ranks that can read their files must throw as well
+  if(comm->MyPID() == comm->NumProc()-1)
+    remove(RestartFile::rankFileName(directory, comm->NumProc()-1).c_str());
+  comm->Barrier();
+
+  TEST_THROW(RestartReader reader(*comm, directory), std::logic_error);
+}
+
+int main( int argc, char* argv[] ) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -0,0 +1,182 @@
+/*! \file utPeridigm_SerialMatrix.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Epetra_ConfigDefs.h> // used to define HAVE_MPI
+#include "Peridigm_SerialMatrix.hpp"
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <Epetra_Map.h>
+#include <vector>
+
+#ifdef HAVE_MPI
+  #include <Epetra_MpiComm.h>
+#else
+  #include <Epetra_SerialComm.h>
+#endif
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+Teuchos::RCP<Epetra_Comm> createComm()
+{
+#ifdef HAVE_MPI
+  return rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+#else
+  return rcp(new Epetra_SerialComm);
+#endif
+}
+
+//! Filled, fully coupled matrix for two points with three dofs each; with two or more processors, processors 0 and 1 each own one point.
+Teuchos::RCP<Epetra_FECrsMatrix> createMatrix(const Epetra_Comm& comm)
+{
+  vector<int> myRows;
+  for(int dof=0 ; dof<6 ; ++dof){
+    int owner = (dof/3)%comm.NumProc();
+    if(owner == comm.MyPID())
+      myRows.push_back(dof);
+  }
+  Epetra_Map rowMap(6, (int)myRows.size(), myRows.data(), 0, comm);
+  Teuchos::RCP<Epetra_FECrsMatrix> matrix = rcp(new Epetra_FECrsMatrix(Copy, rowMap, 6, false));
+  int cols[6] = {0, 1, 2, 3, 4, 5};
+  double zeros[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  for(unsigned int i=0 ; i<myRows.size() ; ++i)
+    matrix->InsertGlobalValues(myRows[i], 6, zeros, cols);
+  matrix->GlobalAssemble();
+  return matrix;
+}
+
+//! Value submitted for the entry at the given global row and column.
+double entryValue(int row, int col)
+{
+  return 1.0 + 10.0*row + col;
+}
+
+//! Submits a dense block for the given global indices.
+void addBlock(SerialMatrix& serialMatrix, const vector<int>& indices)
+{
+  int n = (int)indices.size();
+  vector< vector<double> > rows(n, vector<double>(n));
+  vector<const double*> rowPointers(n);
+  for(int i=0 ; i<n ; ++i){
+    for(int j=0 ; j<n ; ++j)
+      rows[i][j] = entryValue(indices[i], indices[j]);
+    rowPointers[i] = rows[i].data();
+  }
+  serialMatrix.addValues(n, indices.data(), rowPointers.data());
+}
+
+//! Checks every locally owned entry; entries among the first numCoupled dofs are expected to hold numProc contributions, the others zero.
+void checkMatrix(const Epetra_FECrsMatrix& matrix, int numCoupled, int numProc, bool& success, std::ostream& out)
+{
+  const Epetra_Map& rowMap = matrix.RowMap();
+  for(int lid=0 ; lid<rowMap.NumMyElements() ; ++lid){
+    int row = rowMap.GID(lid);
+    int numEntries;
+    double values[6];
+    int indices[6];
+    matrix.ExtractGlobalRowCopy(row, 6, numEntries, values, indices);
+    TEST_EQUALITY(numEntries, 6);
+    for(int i=0 ; i<numEntries ; ++i){
+      int col = indices[i];
+      double expected = (row < numCoupled && col < numCoupled) ? numProc*entryValue(row, col) : 0.0;
+      TEST_FLOATING_EQUALITY(values[i] + 1.0, expected + 1.0, 1.0e-14);
+    }
+  }
+}
+
+//! Point triples take the direct path for owned rows; with two processors, half of each block goes to rows owned by the other processor.
+
+TEUCHOS_UNIT_TEST(SerialMatrix, PointBlocks) {
+
+  Teuchos::RCP<Epetra_Comm> comm = createComm();
+  Teuchos::RCP<Epetra_FECrsMatrix> matrix = createMatrix(*comm);
+  SerialMatrix serialMatrix(matrix);
+
+  // Every processor submits the full block, with the points out of order
+  vector<int> indices;
+  indices.push_back(3); indices.push_back(4); indices.push_back(5);
+  indices.push_back(0); indices.push_back(1); indices.push_back(2);
+  addBlock(serialMatrix, indices);
+
+  TEST_EQUALITY(serialMatrix.globalAssemble(), 0);
+  checkMatrix(*matrix, 6, comm->NumProc(), success, out);
+
+  // Nothing is left in the buffer, so assembling again changes nothing
+  TEST_EQUALITY(serialMatrix.globalAssemble(), 0);
+  checkMatrix(*matrix, 6, comm->NumProc(), success, out);
+}
+
+//! Indices that are not point triples fall back to Epetra_CrsMatrix::SumIntoMyValues() for owned rows.
+
+TEUCHOS_UNIT_TEST(SerialMatrix, Fallback) {
+
+  Teuchos::RCP<Epetra_Comm> comm = createComm();
+  Teuchos::RCP<Epetra_FECrsMatrix> matrix = createMatrix(*comm);
+  SerialMatrix serialMatrix(matrix);
+
+  vector<int> indices;
+  indices.push_back(0); indices.push_back(1); indices.push_back(2); indices.push_back(3);
+  addBlock(serialMatrix, indices);
+
+  TEST_EQUALITY(serialMatrix.globalAssemble(), 0);
+  checkMatrix(*matrix, 4, comm->NumProc(), success, out);
+
+  // putScalar() discards buffered contributions along with the values
+  addBlock(serialMatrix, indices);
+  serialMatrix.putScalar(0.0);
+  TEST_EQUALITY(serialMatrix.globalAssemble(), 0);
+  checkMatrix(*matrix, 0, comm->NumProc(), success, out);
+}
+
+int main( int argc, char* argv[] ) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -185,6 +185,39 @@ TEUCHOS_UNIT_TEST(State, TwoPointTest) {
   }
 }
 
+TEUCHOS_UNIT_TEST(State, MemorySize) {
+
+  Teuchos::RCP<Epetra_Comm> comm;
+
+  #ifdef HAVE_MPI
+    comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+    comm = rcp(new Epetra_SerialComm);
+  #endif
+
+  PeridigmNS::State state;
+  Teuchos::RCP<Epetra_BlockMap> overlapScalarPointMap;
+  Teuchos::RCP<Epetra_BlockMap> overlapVectorPointMap;
+  Teuchos::RCP<Epetra_BlockMap> ownedScalarBondMap;
+  vector<int> scalarPointFieldIds;
+  vector<int> vectorPointFieldIds;
+  vector<int> bondFieldIds;
+
+  state = createTwoPointProblem(comm, overlapScalarPointMap, overlapVectorPointMap, ownedScalarBondMap, scalarPointFieldIds, vectorPointFieldIds, bondFieldIds);
+
+  double pointBytes = (scalarPointFieldIds.size()*overlapScalarPointMap->NumMyPoints() +
+                       vectorPointFieldIds.size()*overlapVectorPointMap->NumMyPoints())*sizeof(double);
+  double bondBytes = bondFieldIds.size()*ownedScalarBondMap->NumMyPoints()*sizeof(double);
+
+  TEST_FLOATING_EQUALITY( state.pointDataMemorySize(), pointBytes/1048576.0, 1.0e-14 );
+  if(bondBytes > 0.0){
+    TEST_FLOATING_EQUALITY( state.bondDataMemorySize(), bondBytes/1048576.0, 1.0e-14 );
+  }
+  else{
+    TEST_EQUALITY_CONST( state.bondDataMemorySize(), 0.0 );
+  }
+}
+
 //! Create a three-point problem for testing.
 
 PeridigmNS::State createThreePointProblem(Teuchos::RCP<Epetra_Comm> comm, Teuchos::RCP<Epetra_BlockMap> &overlapScalarPointMap, Teuchos::RCP<Epetra_BlockMap> &overlapVectorPointMap, Teuchos::RCP<Epetra_BlockMap> &ownedScalarBondMap, vector<int> &scalarPointFieldIds, vector<int> &vectorPointFieldIds, vector<int> &bondFieldIds)
@@ -0,0 +1,220 @@
+/*! \file utPeridigm_Timer.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "Peridigm_Timer.hpp"
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdio>
+
+using namespace Teuchos;
+using namespace PeridigmNS;
+using namespace std;
+
+//! Returns the lines of the call-tree section of the report that name the given timer.
+
+static vector<string> callTreeLines(const string& report, const string& name) {
+  vector<string> lines;
+  size_t start = report.find("Wallclock Time by Call Tree");
+  if(start == string::npos)
+    return lines;
+  istringstream section(report.substr(start));
+  string line;
+  while(getline(section, line)){
+    size_t pos = line.find(name);
+    if(pos != string::npos && line.find_first_not_of(' ') == pos)
+      lines.push_back(line);
+  }
+  return lines;
+}
+
+//! Returns the indentation of a call-tree line, which grows with the depth of the node.
+
+static int callTreeIndent(const string& line) {
+  return (int)( line.find_first_not_of(' ') );
+}
+
+//! Returns the call count, the last column of a call-tree line.
+
+static int callTreeCalls(const string& line) {
+  istringstream columns(line.substr(line.find_last_of(' ') + 1));
+  int calls = -1;
+  columns >> calls;
+  return calls;
+}
+
+//! Returns true if the brackets and braces outside of strings are balanced and the text is a single object.
+
+static bool balancedJson(const string& json) {
+  vector<char> open;
+  bool inString = false;
+  for(unsigned int i=0 ; i<json.size() ; ++i){
+    char c = json[i];
+    if(inString){
+      if(c == '\\') ++i;
+      else if(c == '"') inString = false;
+      continue;
+    }
+    if(c == '"') inString = true;
+    else if(c == '{' || c == '[') open.push_back(c);
+    else if(c == '}' || c == ']'){
+      if(open.empty() || open.back() != (c == '}' ? '{' : '['))
+        return false;
+      open.pop_back();
+      if(open.empty() && json.find_first_not_of(" \n", i+1) != string::npos)
+        return false;
+    }
+  }
+  return open.empty() && !inString && json.find_first_not_of(" \n") == json.find('{');
+}
+
+//! Returns the number of non-overlapping occurrences of pattern in str.
+
+static int countOccurrences(const string& str, const string& pattern) {
+  int count = 0;
+  for(size_t pos = str.find(pattern) ; pos != string::npos ; pos = str.find(pattern, pos + pattern.size()))
+    count += 1;
+  return count;
+}
+
+//! Checks that timer ids are stable and that the id-based and name-based functions refer to the same timer.
+
+TEUCHOS_UNIT_TEST(Timer, Ids) {
+
+  Timer& timer = Timer::self();
+
+  int idA = timer.timerId("Ids A");
+  int idB = timer.timerId("Ids B");
+  TEST_INEQUALITY(idA, idB);
+  TEST_EQUALITY(timer.timerId("Ids A"), idA);
+
+  timer.addTime(idA, 2.0);
+  timer.addTime("Ids A", 0.5);
+  TEST_FLOATING_EQUALITY(timer.elapsedTime(idA), 2.5, 1.0e-15);
+  TEST_FLOATING_EQUALITY(timer.elapsedTime("Ids A"), 2.5, 1.0e-15);
+  TEST_EQUALITY(timer.elapsedTime(idB), 0.0);
+}
+
+//! Nests timers, including a stop that is out of order, and checks the flat table, the call tree, and the trace file.
+
+TEUCHOS_UNIT_TEST(Timer, Nesting) {
+
+  Timer& timer = Timer::self();
+  timer.setHierarchicalReport(true);
+  timer.enableTrace("utPeridigm_Timer.json", 100);
+  TEST_ASSERT(timer.detailedTiming());
+
+  int outerId = timer.timerId("Nesting Outer");
+  int innerId = timer.timerId("Nesting Inner");
+  for(int i=0 ; i<3 ; ++i){
+    ScopedTimer outer(outerId);
+    timer.startTimer(innerId);
+    timer.stopTimer(innerId);
+  }
+
+  ostringstream report;
+  timer.printTimingData(report);
+  TEST_ASSERT(report.str().find("Nesting Outer") != string::npos);
+  TEST_ASSERT(report.str().find("Wallclock Time by Call Tree") != string::npos);
+  vector<string> outerLines = callTreeLines(report.str(), "Nesting Outer");
+  vector<string> innerLines = callTreeLines(report.str(), "Nesting Inner");
+  TEST_EQUALITY((int)( outerLines.size() ), 1);
+  TEST_EQUALITY((int)( innerLines.size() ), 1);
+  if(outerLines.size() == 1 && innerLines.size() == 1){
+    TEST_EQUALITY(callTreeCalls(outerLines[0]), 3);
+    TEST_EQUALITY(callTreeCalls(innerLines[0]), 3);
+    TEST_COMPARE(callTreeIndent(innerLines[0]), >, callTreeIndent(outerLines[0]));
+  }
+
+  // Stopping the outer timer first must leave the inner timer running under the outer node
+  timer.startTimer(outerId);
+  timer.startTimer(innerId);
+  timer.stopTimer(outerId);
+  timer.stopTimer(innerId);
+
+  report.str("");
+  timer.printTimingData(report);
+  outerLines = callTreeLines(report.str(), "Nesting Outer");
+  innerLines = callTreeLines(report.str(), "Nesting Inner");
+  TEST_EQUALITY((int)( outerLines.size() ), 1);
+  TEST_EQUALITY((int)( innerLines.size() ), 1);
+  if(outerLines.size() == 1 && innerLines.size() == 1){
+    TEST_EQUALITY(callTreeCalls(outerLines[0]), 4);
+    TEST_EQUALITY(callTreeCalls(innerLines[0]), 4);
+    TEST_COMPARE(callTreeIndent(innerLines[0]), >, callTreeIndent(outerLines[0]));
+    size_t outerPos = report.str().find(outerLines[0]);
+    size_t innerPos = report.str().find(innerLines[0]);
+    TEST_COMPARE(innerPos, >, outerPos);
+  }
+
+  timer.writeTrace();
+  ifstream trace("utPeridigm_Timer.json");
+  TEST_ASSERT(trace.is_open());
+  stringstream contents;
+  contents << trace.rdbuf();
+  trace.close();
+  TEST_ASSERT(contents.str().find("\"traceEvents\"") != string::npos);
+  TEST_ASSERT(balancedJson(contents.str()));
+  // Four outer and four inner intervals, all recorded after the trace was enabled
+  TEST_EQUALITY(countOccurrences(contents.str(), "\"ph\":\"X\""), 8);
+  TEST_EQUALITY(countOccurrences(contents.str(), "\"name\":\"Nesting Outer\""), 4);
+  TEST_EQUALITY(countOccurrences(contents.str(), "\"name\":\"Nesting Inner\""), 4);
+  remove("utPeridigm_Timer.json");
+
+  timer.setHierarchicalReport(false);
+}
+
+int main( int argc, char* argv[] ) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -47,11 +47,14 @@
 
 #include "Peridigm_CriticalStretchDamageModel.hpp"
 #include "Peridigm_Field.hpp"
+#include "bond_geometry.h"
+#include <algorithm>
 
 using namespace std;
 
 PeridigmNS::CriticalStretchDamageModel::CriticalStretchDamageModel(const Teuchos::ParameterList& params)
-  : DamageModel(params), m_applyThermalStrains(false), m_modelCoordinatesFieldId(-1), m_coordinatesFieldId(-1), m_damageFieldId(-1), m_bondDamageFieldId(-1), m_deltaTemperatureFieldId(-1)
+  : DamageModel(params), m_applyThermalStrains(false), m_cacheBondGeometry(true), m_modelCoordinatesFieldId(-1), m_coordinatesFieldId(-1), m_damageFieldId(-1), m_bondDamageFieldId(-1), m_deltaTemperatureFieldId(-1),
+    m_bondReferenceLengthFieldId(-1), m_bondInverseReferenceLengthFieldId(-1)
 {
   m_criticalStretch = params.get<double>("Critical Stretch");
 
@@ -60,6 +63,9 @@ PeridigmNS::CriticalStretchDamageModel::CriticalStretchDamageModel(const Teuchos
     m_applyThermalStrains = true;
   }
 
+  if(params.isParameter("Cache Bond Geometry"))
+    m_cacheBondGeometry = params.get<bool>("Cache Bond Geometry");
+
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
   m_modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
   m_coordinatesFieldId = fieldManager.getFieldId("Coordinates");
@@ -67,6 +73,10 @@ PeridigmNS::CriticalStretchDamageModel::CriticalStretchDamageModel(const Teuchos
   m_bondDamageFieldId = fieldManager.getFieldId(PeridigmNS::PeridigmField::BOND, PeridigmNS::PeridigmField::SCALAR, PeridigmNS::PeridigmField::TWO_STEP, "Bond_Damage");
   if(m_applyThermalStrains)
     m_deltaTemperatureFieldId = fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Temperature_Change");
+  if(m_cacheBondGeometry){
+    m_bondReferenceLengthFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Reference_Length");
+    m_bondInverseReferenceLengthFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Inverse_Reference_Length");
+  }
 
   m_fieldIds.push_back(m_modelCoordinatesFieldId);
   m_fieldIds.push_back(m_coordinatesFieldId);
@@ -74,6 +84,10 @@ PeridigmNS::CriticalStretchDamageModel::CriticalStretchDamageModel(const Teuchos
   m_fieldIds.push_back(m_bondDamageFieldId);
   if(m_applyThermalStrains)
     m_fieldIds.push_back(m_deltaTemperatureFieldId);
+  if(m_cacheBondGeometry){
+    m_fieldIds.push_back(m_bondReferenceLengthFieldId);
+    m_fieldIds.push_back(m_bondInverseReferenceLengthFieldId);
+  }
 }
 
 PeridigmNS::CriticalStretchDamageModel::~CriticalStretchDamageModel()
@@ -103,6 +117,15 @@ PeridigmNS::CriticalStretchDamageModel::initialize(const double dt,
       bondDamage[bondIndex++] = 0.0;
 	}
   }
+  // The reference bond lengths are constant, they are computed once here and travel with the bond data on rebalance
+  if(m_cacheBondGeometry){
+    double *x, *bondReferenceLength, *bondInverseReferenceLength;
+    dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
+    dataManager.getData(m_bondReferenceLengthFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondReferenceLength);
+    dataManager.getData(m_bondInverseReferenceLengthFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondInverseReferenceLength);
+    MATERIAL_EVALUATION::computeBondGeometry(x,0,neighborhoodList,numOwnedPoints,0.0,PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),
+                                             bondReferenceLength,bondInverseReferenceLength,0,0);
+  }
 }
 
 void
@@ -121,11 +144,16 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
   deltaTemperature = NULL;
   if(m_applyThermalStrains)
     dataManager.getData(m_deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&deltaTemperature);
+  double *bondReferenceLength(0), *bondInverseReferenceLength(0);
+  if(m_cacheBondGeometry){
+    dataManager.getData(m_bondReferenceLengthFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondReferenceLength);
+    dataManager.getData(m_bondInverseReferenceLengthFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondInverseReferenceLength);
+  }
 
   double trialDamage(0.0);
   int neighborhoodListIndex(0), bondIndex(0);
   int nodeId, numNeighbors, neighborID, iID, iNID;
-  double nodeInitialX[3], nodeCurrentX[3], initialDistance, currentDistance, relativeExtension, totalDamage;
+  double nodeInitialX[3], nodeCurrentX[3], initialDistance, inverseInitialDistance, currentDistance, relativeExtension, totalDamage;
 
   // Set the bond damage to the previous value
   *(dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)) = *(dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N));
@@ -133,33 +161,80 @@ PeridigmNS::CriticalStretchDamageModel::computeDamage(const double dt,
   // Update the bond damage
   // Break bonds if the extension is greater than the critical extension
 
-  for(iID=0 ; iID<numOwnedPoints ; ++iID){
-	nodeId = ownedIDs[iID];
-	nodeInitialX[0] = x[nodeId*3];
-	nodeInitialX[1] = x[nodeId*3+1];
-	nodeInitialX[2] = x[nodeId*3+2];
-	nodeCurrentX[0] = y[nodeId*3];
-	nodeCurrentX[1] = y[nodeId*3+1];
-	nodeCurrentX[2] = y[nodeId*3+2];
-	numNeighbors = neighborhoodList[neighborhoodListIndex++];
-	for(iNID=0 ; iNID<numNeighbors ; ++iNID){
-	  neighborID = neighborhoodList[neighborhoodListIndex++];
-      initialDistance = 
-        distance(nodeInitialX[0], nodeInitialX[1], nodeInitialX[2],
-                 x[neighborID*3], x[neighborID*3+1], x[neighborID*3+2]);
-      currentDistance = 
-        distance(nodeCurrentX[0], nodeCurrentX[1], nodeCurrentX[2],
-                 y[neighborID*3], y[neighborID*3+1], y[neighborID*3+2]);
-      if(m_applyThermalStrains)
-        currentDistance -= m_alpha*deltaTemperature[nodeId]*initialDistance;
-      relativeExtension = (currentDistance - initialDistance)/initialDistance;
-      trialDamage = 0.0;
-      if(relativeExtension > m_criticalStretch)
-        trialDamage = 1.0;
-      if(trialDamage > bondDamageNP1[bondIndex]){
-        bondDamageNP1[bondIndex] = trialDamage;
+  if(dataManager.hasStructureOfArraysData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE) &&
+     dataManager.hasStructureOfArraysData(m_coordinatesFieldId, PeridigmField::STEP_NP1)){
+    // Vectorized bond loop on the DataManager's structure-of-arrays copies
+    int numOverlapPoints = dataManager.getOverlapScalarPointMap()->NumMyElements();
+    const double* xSoA = dataManager.getStructureOfArraysData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    const double* ySoA = dataManager.getStructureOfArraysData(m_coordinatesFieldId, PeridigmField::STEP_NP1);
+    const double *x0 = xSoA, *x1 = xSoA + numOverlapPoints, *x2 = xSoA + 2*numOverlapPoints;
+    const double *y0 = ySoA, *y1 = ySoA + numOverlapPoints, *y2 = ySoA + 2*numOverlapPoints;
+    for(iID=0 ; iID<numOwnedPoints ; ++iID){
+      nodeId = ownedIDs[iID];
+      numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      const int* neighbors = neighborhoodList + neighborhoodListIndex;
+      double* nodeBondDamage = bondDamageNP1 + bondIndex;
+      const double* nodeReferenceLength = m_cacheBondGeometry ? bondReferenceLength + bondIndex : 0;
+      const double* nodeInverseReferenceLength = m_cacheBondGeometry ? bondInverseReferenceLength + bondIndex : 0;
+      double thermalStrain = m_applyThermalStrains ? m_alpha*deltaTemperature[nodeId] : 0.0;
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+      for(iNID=0 ; iNID<numNeighbors ; ++iNID){
+        int neighbor = neighbors[iNID];
+        double initialLength, inverseInitialLength;
+        if(m_cacheBondGeometry){
+          initialLength = nodeReferenceLength[iNID];
+          inverseInitialLength = nodeInverseReferenceLength[iNID];
+        }
+        else{
+          initialLength = distance(x0[nodeId], x1[nodeId], x2[nodeId], x0[neighbor], x1[neighbor], x2[neighbor]);
+          inverseInitialLength = 1.0/initialLength;
+        }
+        double currentLength = distance(y0[nodeId], y1[nodeId], y2[nodeId], y0[neighbor], y1[neighbor], y2[neighbor]) - thermalStrain*initialLength;
+        double trial = (currentLength - initialLength)*inverseInitialLength > m_criticalStretch ? 1.0 : 0.0;
+        nodeBondDamage[iNID] = std::max(nodeBondDamage[iNID], trial);
+      }
+      neighborhoodListIndex += numNeighbors;
+      bondIndex += numNeighbors;
+    }
+  }
+  else{
+    for(iID=0 ; iID<numOwnedPoints ; ++iID){
+      nodeId = ownedIDs[iID];
+      nodeInitialX[0] = x[nodeId*3];
+      nodeInitialX[1] = x[nodeId*3+1];
+      nodeInitialX[2] = x[nodeId*3+2];
+      nodeCurrentX[0] = y[nodeId*3];
+      nodeCurrentX[1] = y[nodeId*3+1];
+      nodeCurrentX[2] = y[nodeId*3+2];
+      numNeighbors = neighborhoodList[neighborhoodListIndex++];
+      for(iNID=0 ; iNID<numNeighbors ; ++iNID){
+        neighborID = neighborhoodList[neighborhoodListIndex++];
+        if(m_cacheBondGeometry){
+          initialDistance = bondReferenceLength[bondIndex];
+          inverseInitialDistance = bondInverseReferenceLength[bondIndex];
+        }
+        else{
+          initialDistance =
+            distance(nodeInitialX[0], nodeInitialX[1], nodeInitialX[2],
+                     x[neighborID*3], x[neighborID*3+1], x[neighborID*3+2]);
+          inverseInitialDistance = 1.0/initialDistance;
+        }
+        currentDistance = 
+          distance(nodeCurrentX[0], nodeCurrentX[1], nodeCurrentX[2],
+                   y[neighborID*3], y[neighborID*3+1], y[neighborID*3+2]);
+        if(m_applyThermalStrains)
+          currentDistance -= m_alpha*deltaTemperature[nodeId]*initialDistance;
+        relativeExtension = (currentDistance - initialDistance)*inverseInitialDistance;
+        trialDamage = 0.0;
+        if(relativeExtension > m_criticalStretch)
+          trialDamage = 1.0;
+        if(trialDamage > bondDamageNP1[bondIndex]){
+          bondDamageNP1[bondIndex] = trialDamage;
+        }
+        bondIndex += 1;
       }
-      bondIndex += 1;
     }
   }
 
@@ -101,6 +101,7 @@ namespace PeridigmNS {
     double m_criticalStretch;
     double m_alpha;
     bool m_applyThermalStrains;
+    bool m_cacheBondGeometry;
 
     // field ids for all relevant data
     std::vector<int> m_fieldIds;
@@ -109,6 +110,8 @@ namespace PeridigmNS {
     int m_damageFieldId;
     int m_bondDamageFieldId;
     int m_deltaTemperatureFieldId;
+    int m_bondReferenceLengthFieldId;
+    int m_bondInverseReferenceLengthFieldId;
   };
 
 }
@@ -81,6 +81,19 @@ namespace PeridigmNS {
                const int* neighborhoodList,
                PeridigmNS::DataManager& dataManager) const {}
 
+	//! Update time-dependent model parameters; called once per time step, before the damage is evaluated.
+	virtual void
+	updateTime(const double timeCurrent,
+               const double timePrevious) {}
+
+	//! Called at the start of each time step, after updateTime().
+	virtual void
+	preStep(const double dt,
+            const int numOwnedPoints,
+            const int* ownedIDs,
+            const int* neighborhoodList,
+            PeridigmNS::DataManager& dataManager) const {}
+
 	//! Evaluate the damage
 	virtual void
 	computeDamage(const double dt,
@@ -89,6 +102,14 @@ namespace PeridigmNS {
                   const int* neighborhoodList,
                   PeridigmNS::DataManager& dataManager) const = 0;
 
+	//! Called at the end of each time step, before the state is advanced.
+	virtual void
+	postStep(const double dt,
+             const int numOwnedPoints,
+             const int* ownedIDs,
+             const int* neighborhoodList,
+             PeridigmNS::DataManager& dataManager) const {}
+
   private:
 	
 	//! Default constructor with no arguments, private to prevent use.
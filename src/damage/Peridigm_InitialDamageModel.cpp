@@ -103,8 +103,8 @@ PeridigmNS::InitialDamageModel::initialize(const double dt,
       std::string file_name = params.get<std::string>("File Name");
       std::vector< std::vector< std::vector<double> > > triangles;
       GenesisToTriangles(file_name, triangles);
-      for(unsigned int i=0 ; i<triangles.size() ; i++){
-        std::shared_ptr<PdBondFilter::BondFilter> bondFilter(new PdBondFilter::TriangleFilter(triangles[i][0].data(), triangles[i][1].data(), triangles[i][2].data()));
+      if(triangles.size() > 0){
+        std::shared_ptr<PdBondFilter::BondFilter> bondFilter(new PdBondFilter::TriangleMeshFilter(triangles));
         bondFilters.push_back(bondFilter);
       }
     }
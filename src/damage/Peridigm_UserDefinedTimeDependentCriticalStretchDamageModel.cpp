@@ -60,7 +60,24 @@ PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::UserDefinedTimeD
   rtcFunction = Teuchos::rcp<PG_RuntimeCompiler::Function>(new PG_RuntimeCompiler::Function(2, "rtcUserDefinedTimeDependentShortRangeForceContactModel"));
   rtcFunction->addVar("double", "t");
   rtcFunction->addVar("double", "value");
-    
+
+  // The function is parsed once here rather than every time step
+  string rtcFunctionString = functiondmg;
+  if(rtcFunctionString.find("value") == string::npos)
+    rtcFunctionString = "value = " + rtcFunctionString;
+  std::vector<std::string> variableNames;
+  variableNames.push_back("t");
+  variableNames.push_back("value");
+  expression = Teuchos::rcp(new Expression(variableNames));
+  if(!expression->compile(rtcFunctionString)){
+    expression = Teuchos::null;
+    bool success = rtcFunction->addBody(rtcFunctionString);
+    if(!success){
+      string msg = "\n**** Error:  rtcFunction->addBody(functiondmg) returned nonzero error code in UserDefinedTimeDependentCriticalStretchDamageModel::UserDefinedTimeDependentCriticalStretchDamageModel().\n";
+      msg += "**** " + rtcFunction->getErrors() + "\n";
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+    }
+  }
 
   if(params.isParameter("Thermal Expansion Coefficient")){
     m_alpha = params.get<double>("Thermal Expansion Coefficient");
@@ -94,17 +111,17 @@ PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::~UserDefinedTime
 }
 
 void PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::evaluateParserDmg(double & currentValue, double & previousValue, const double & timeCurrent, const double & timePrevious){
-  
-  string rtcFunctionString = functiondmg;
-  if(rtcFunctionString.find("value") == string::npos)
-    rtcFunctionString = "value = " + rtcFunctionString;
-  bool success = rtcFunction->addBody(rtcFunctionString);
-  if(!success){
-    string msg = "\n**** Error:  rtcFunction->addBody(functiondmg) returned nonzero error code in UserDefinedTimeDependentCriticalStretchDamageModel::evaluateParserDmg().\n";
-    msg += "**** " + rtcFunction->getErrors() + "\n";
-    TEUCHOS_TEST_FOR_EXCEPT_MSG(!success, msg);
+
+  if(!expression.is_null()){
+    double values[2] = {timePrevious, 0.0};
+    previousValue = expression->evaluate(values);
+    values[0] = timeCurrent;
+    currentValue = expression->evaluate(values);
+    m_criticalStretch = currentValue;
+    return;
   }
 
+  bool success(true);
   // set the return value to 0.0
   if(success)
     success = rtcFunction->varValueFill(1, 0.0);
@@ -132,6 +149,11 @@ void PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::evaluatePar
   
 }
 
+void PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::updateTime(const double timeCurrent, const double timePrevious){
+  double currentValue(0.0), previousValue(0.0);
+  evaluateParserDmg(currentValue, previousValue, timeCurrent, timePrevious);
+}
+
 void
 PeridigmNS::UserDefinedTimeDependentCriticalStretchDamageModel::initialize(const double dt,
                                                    const int numOwnedPoints,
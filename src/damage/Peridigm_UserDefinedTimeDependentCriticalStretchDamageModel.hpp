@@ -49,6 +49,7 @@
 #define PERIDIGM_ADAPTIVECRITICALSTRETCHDAMAGEMODEL_HPP
 
 #include "Peridigm_DamageModel.hpp"
+#include "Peridigm_Expression.hpp"
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_ParameterList.hpp>
 #include <Epetra_Vector.h>
@@ -90,6 +91,11 @@ namespace PeridigmNS {
                const int* ownedIDs,
                const int* neighborhoodList,
                PeridigmNS::DataManager& dataManager) const ;
+
+    //! Evaluate the critical stretch at the current time.
+    virtual void
+    updateTime(const double timeCurrent,
+               const double timePrevious);
                
     //void initializeDMG(const double dt, const int current_time);               
 
@@ -128,9 +134,12 @@ namespace PeridigmNS {
     //! string defined funciton
     std::string functiondmg;
 
-    //! Run-time compiler, used as function parser
+    //! Run-time compiler, used as function parser for functions the compiled expression does not support
     Teuchos::RCP<PG_RuntimeCompiler::Function> rtcFunction;
 
+    //! Compiled critical stretch function
+    Teuchos::RCP<Expression> expression;
+
     // field ids for all relevant data
     std::vector<int> m_fieldIds;
     int m_modelCoordinatesFieldId;
@@ -0,0 +1,134 @@
+/*! \file Peridigm_CellListSearchTree.cpp */
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+//@HEADER
+
+#include "Peridigm_CellListSearchTree.hpp"
+#include <cmath>
+#include <algorithm>
+
+PeridigmNS::CellListSearchTree::CellListSearchTree(int numPoints, const double* coordinates_, double cellSize_)
+  : SearchTree(numPoints, coordinates_), coordinates(coordinates_), cellSize(cellSize_)
+{
+  double max[3];
+  for(int dim=0 ; dim<3 ; ++dim){
+    min[dim] = numPoints > 0 ? coordinates[dim] : 0.0;
+    max[dim] = min[dim];
+  }
+  for(int i=0 ; i<numPoints ; ++i){
+    for(int dim=0 ; dim<3 ; ++dim){
+      min[dim] = std::min(min[dim], coordinates[3*i+dim]);
+      max[dim] = std::max(max[dim], coordinates[3*i+dim]);
+    }
+  }
+
+  // Limit the number of cells to a small multiple of the number of points, so that a
+  // small cell size relative to the extent of the points cannot exhaust the memory
+  double largestExtent = std::max(max[0]-min[0], std::max(max[1]-min[1], max[2]-min[2]));
+  if(!(cellSize > 0.0))
+    cellSize = largestExtent > 0.0 ? largestExtent : 1.0;
+  const double maxNumCells = 8.0*numPoints + 1.0;
+  while( (std::floor((max[0]-min[0])/cellSize) + 1.0) * (std::floor((max[1]-min[1])/cellSize) + 1.0) * (std::floor((max[2]-min[2])/cellSize) + 1.0) > maxNumCells )
+    cellSize *= 2.0;
+  for(int dim=0 ; dim<3 ; ++dim)
+    numCells[dim] = static_cast<int>(std::floor((max[dim]-min[dim])/cellSize)) + 1;
+
+  // Counting sort of the points by cell
+  int totalNumCells = numCells[0]*numCells[1]*numCells[2];
+  std::vector<int> pointCell(numPoints);
+  cellStart.assign(totalNumCells+1, 0);
+  for(int i=0 ; i<numPoints ; ++i){
+    const double* x = &coordinates[3*i];
+    int cell = (cellIndex(x[2], 2)*numCells[1] + cellIndex(x[1], 1))*numCells[0] + cellIndex(x[0], 0);
+    pointCell[i] = cell;
+    cellStart[cell+1] += 1;
+  }
+  for(int c=0 ; c<totalNumCells ; ++c)
+    cellStart[c+1] += cellStart[c];
+  pointIds.resize(numPoints);
+  std::vector<int> next(cellStart.begin(), cellStart.end()-1);
+  for(int i=0 ; i<numPoints ; ++i)
+    pointIds[next[pointCell[i]]++] = i;
+}
+
+PeridigmNS::CellListSearchTree::~CellListSearchTree()
+{
+}
+
+int PeridigmNS::CellListSearchTree::cellIndex(double x, int dim) const
+{
+  double index = std::floor((x - min[dim])/cellSize);
+  if(index < 0.0)
+    return 0;
+  if(index > numCells[dim] - 1)
+    return numCells[dim] - 1;
+  return static_cast<int>(index);
+}
+
+void PeridigmNS::CellListSearchTree::FindPointsWithinRadius(const double* point, double searchRadius, std::vector<int>& neighborList)
+{
+  int lower[3], upper[3];
+  for(int dim=0 ; dim<3 ; ++dim){
+    lower[dim] = cellIndex(point[dim] - searchRadius, dim);
+    upper[dim] = cellIndex(point[dim] + searchRadius, dim);
+  }
+
+  double R2 = searchRadius*searchRadius;
+  for(int k=lower[2] ; k<=upper[2] ; ++k){
+    for(int j=lower[1] ; j<=upper[1] ; ++j){
+      int rowOffset = (k*numCells[1] + j)*numCells[0];
+      // The cells of a row are contiguous in pointIds
+      int first = cellStart[rowOffset + lower[0]];
+      int last = cellStart[rowOffset + upper[0] + 1];
+      for(int n=first ; n<last ; ++n){
+        int idx = pointIds[n];
+        const double* x = &coordinates[3*idx];
+        double dx = x[0] - point[0];
+        double dy = x[1] - point[1];
+        double dz = x[2] - point[2];
+        if(dx*dx + dy*dy + dz*dz <= R2)
+          neighborList.push_back(idx);
+      }
+    }
+  }
+}
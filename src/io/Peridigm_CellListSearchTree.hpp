@@ -0,0 +1,102 @@
+/*! \file Peridigm_CellListSearchTree.hpp */
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+//@HEADER
+
+#ifndef PERIDIGM_CELLLISTSEARCHTREE_HPP
+#define PERIDIGM_CELLLISTSEARCHTREE_HPP
+
+#include "Peridigm_SearchTree.hpp"
+
+namespace PeridigmNS {
+
+  /** \brief Uniform-grid (cell list) search.
+   *
+   *  The points are binned into a uniform grid of cubic cells and a search visits only the cells that overlap the
+   *  search sphere.  This is efficient when the points are nearly uniformly distributed and the search radius is
+   *  close to the cell size, as is the case for the contact search.
+   **/
+  class CellListSearchTree : public SearchTree {
+
+  public:
+
+    /** \brief Constructor.
+     *
+     *  \param numPoint     The number of points within the tree.
+     *  \param coordinates  The coordinates of all the points in the tree, stored as (X0, Y0, Z0, X1, Y1, Z1, ..., XN, YN, ZN).
+     *  \param cellSize     The edge length of the cells, typically the largest search radius; it is increased if
+     *                      the grid would otherwise have many more cells than points.
+     **/
+    CellListSearchTree(int numPoints, const double* coordinates, double cellSize);
+
+    //! Destructor.
+    virtual ~CellListSearchTree();
+
+    /** \brief Finds the set of points within a given radius of a given point.
+     *
+     *  \param point         The coordinates of the point at the center of the search sphere; this is an array of length three, (X, Y, Z).
+     *  \param searchRadius  The radius defining the search sphere.
+     *  \param neighborList  The list of ids for all points found within the search sphere; input as an empty list and filled by this function.
+     *
+     *  The ids refer to the positions of the points in the array supplied to the constructor.
+     **/
+    virtual void FindPointsWithinRadius(const double* point, double searchRadius, std::vector<int>& neighborList);
+
+  private:
+
+    //! Index of the cell containing the given coordinate along the given direction, clamped to the grid
+    int cellIndex(double x, int dim) const;
+
+    const double* coordinates;
+    double cellSize;
+    double min[3];
+    int numCells[3];
+
+    //! Point ids sorted by cell; the points in cell c are pointIds[cellStart[c]] through pointIds[cellStart[c+1]-1]
+    std::vector<int> cellStart;
+    std::vector<int> pointIds;
+  };
+
+}
+
+#endif // PERIDIGM_CELLLISTSEARCHTREE_HPP
@@ -81,6 +81,15 @@ namespace PeridigmNS {
     //! Change output frequency (for the sake of Adaptive time-stepping)
     virtual void changeOutputFrequency(int) = 0;
 
+    //! Returns true if the (callsAhead+1)-th upcoming call to write() will write data (or run compute classes).
+    virtual bool willWrite(int callsAhead = 0) const { return true; }
+
+    //! Returns the memory used by output staging buffers on this processor, in megabytes.
+    virtual double memorySize() const { return 0.0; }
+
+    //! Completes any pending writes; throws if a write failed.
+    virtual void flush(){};
+
   protected:
 
     //! Number of processors and processor ID
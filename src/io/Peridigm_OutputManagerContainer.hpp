@@ -78,6 +78,31 @@ namespace PeridigmNS {
         (*it)->write(blocks, current_time);
     }
 
+    //! Returns true if any output manager will write on the (callsAhead+1)-th upcoming call to write()
+    bool willWrite(int callsAhead = 0) const {
+      std::vector< Teuchos::RCP< PeridigmNS::OutputManager > >::const_iterator it;
+      for ( it=outputManagers.begin() ; it < outputManagers.end(); it++ )
+        if ((*it)->willWrite(callsAhead))
+          return true;
+      return false;
+    }
+
+    //! Returns the memory used by all output managers in container, in megabytes
+    double memorySize() const {
+      double sizeInMegabytes = 0.0;
+      std::vector< Teuchos::RCP< PeridigmNS::OutputManager > >::const_iterator it;
+      for ( it=outputManagers.begin() ; it < outputManagers.end(); it++ )
+        sizeInMegabytes += (*it)->memorySize();
+      return sizeInMegabytes;
+    }
+
+    //! Complete the pending writes of all output managers in container
+    void flush() {
+      std::vector< Teuchos::RCP< PeridigmNS::OutputManager > >::iterator it;
+      for ( it=outputManagers.begin() ; it < outputManagers.end(); it++ )
+        (*it)->flush();
+    }
+
     //! Multiply output frequency of all output managers in container
     //  for the sake of reducing load step size in Adaptive Quasi-static
     void multiplyOutputFrequency(double multiplier){
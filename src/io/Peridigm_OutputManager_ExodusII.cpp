@@ -50,6 +50,8 @@
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <sstream>
+#include <chrono>
 
 #include <netcdf.h>
 #include <exodusII.h>
@@ -61,14 +63,39 @@
 #include "Peridigm.hpp"
 #include "Peridigm_OutputManager_ExodusII.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_Timer.hpp"
 
 using namespace std;
 
+namespace {
+
+  //! The exodus and netcdf libraries are not thread safe; every exodus call made while an I/O thread may be active holds this mutex
+  std::mutex& exodusMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  //! Appends a zero-initialized variable of the given size to a frame, reusing storage from previous frames
+  template<class Variable>
+  double* addFrameVariable(std::vector<Variable>& variables, unsigned int& numVariables, int index, int blockId, int size) {
+    if (numVariables == variables.size())
+      variables.push_back(Variable());
+    Variable& variable = variables[numVariables++];
+    variable.index = index;
+    variable.blockId = blockId;
+    variable.values.assign(size, 0.0);
+    return variable.values.data();
+  }
+}
+
 PeridigmNS::OutputManager_ExodusII::OutputManager_ExodusII(const Teuchos::RCP<Teuchos::ParameterList>& params, 
                                                            PeridigmNS::Peridigm *peridigm_,
                                                            Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks) 
-  : peridigm(peridigm_) {
-  
+  : peridigm(peridigm_), asynchronousWrite(false), writerShutdown(false), overlappedWriteTime(0.0) {
+
+  freeFrames.push_back(&frameBuffers[0]);
+  freeFrames.push_back(&frameBuffers[1]);
+
   // No input to validate; no output requested
   iWrite = true;
   if (params == Teuchos::null) {
@@ -125,6 +152,14 @@ PeridigmNS::OutputManager_ExodusII::OutputManager_ExodusII(const Teuchos::RCP<Te
   firstOutputStep = params->get<int>("Initial Output Step",1); 
   lastOutputStep = params->get<int>("Final Output Step",std::numeric_limits<int>::max()-1); 
 
+  // Default to writing on the calling thread
+  asynchronousWrite = params->get<bool>("Asynchronous Write",false);
+  if (asynchronousWrite) {
+    // Register the timers on every rank so that the timing summary lines up across ranks
+    PeridigmNS::Timer::self().addTime("Output (Blocking)", 0.0);
+    PeridigmNS::Timer::self().addTime("Output (Overlapped)", 0.0);
+  }
+
   // User-requested fields for output 
   outputVariables = sublist(params, "Output Variables");
 
@@ -174,6 +209,7 @@ Teuchos::ParameterList PeridigmNS::OutputManager_ExodusII::getValidParameterList
   Teuchos::setStringToIntegralParameter<int>("Output Format","BINARY","ASCII or BINARY",Teuchos::tuple<string>("ASCII","BINARY"),&validParameterList);
   setIntParameter("Output Frequency",-1,"Frequency of Output",&validParameterList,intParam);
   validParameterList.set("Parallel Write",true);
+  validParameterList.set("Asynchronous Write",false);
 
   // Create a vector of valid output variables
   // Do not include bond data, since we can not output it
@@ -205,6 +241,20 @@ Teuchos::ParameterList PeridigmNS::OutputManager_ExodusII::getValidParameterList
 }
 
 PeridigmNS::OutputManager_ExodusII::~OutputManager_ExodusII() {
+  if (writerThread.joinable()) {
+    try {
+      drainFrames();
+    }
+    catch (std::exception& e) {
+      std::cout << e.what() << std::endl;
+    }
+    {
+      std::lock_guard<std::mutex> lock(frameMutex);
+      writerShutdown = true;
+    }
+    frameCondition.notify_all();
+    writerThread.join();
+  }
 }
 
 void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double current_time) {
@@ -222,7 +272,7 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
 
   // Only write if count is in between first and last dumps and frequency count match. 
   // The +/- 1 is to account for the initialization dumps
-  if ((count<(firstOutputStep) || count>(lastOutputStep+1)) || (frequency<=0 || (count-1)%frequency!=0)) return;
+  if (!isOutputCount(count)) return;
 
   // increment exodus_count index
   exodusCount = exodusCount + 1;
@@ -236,6 +286,7 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
 
   // If first call, intialize database
   if (!initializeExodusDatabaseCalled) {
+    std::lock_guard<std::mutex> lock(exodusMutex());
     if(globalDataOnly)
       initializeExodusDatabaseWithOnlyGlobalData(blocks);
     else
@@ -244,32 +295,65 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
 
   // if the interface data was constructed, output that to file
   if(peridigm->interfacesAreConstructed()){
+    std::lock_guard<std::mutex> lock(exodusMutex());
     peridigm->getInterfaceData()->WriteExodusOutput(exodusCount,current_time,peridigm->getX(),peridigm->getY());
   }
 
-  // Open exodus database for writing
-  float version;
-  file_handle = ex_open(filename.str().c_str(), EX_WRITE, &CPU_word_size, &IO_word_size, &version);
-  if (file_handle < 0) reportExodusError(file_handle, "write", "ex_open");
+  if (!asynchronousWrite) {
+    Frame& frame = frameBuffers[0];
+    stageFrame(blocks, current_time, frame);
 
-  // Write time value
-  int retval = ex_put_time(file_handle,exodusCount,&current_time);
-  if (retval!= 0) reportExodusError(retval, "write", "ex_put_time");
+    std::lock_guard<std::mutex> lock(exodusMutex());
+
+    // Open exodus database for writing
+    float version;
+    file_handle = ex_open(filename.str().c_str(), EX_WRITE, &CPU_word_size, &IO_word_size, &version);
+    if (file_handle < 0) reportExodusError(file_handle, "write", "ex_open");
+
+    writeFrame(file_handle, frame);
+
+    int retval = ex_close(file_handle);
+    if (retval!= 0) reportExodusError(retval, "write", "ex_close");
+    return;
+  }
+
+  // Asynchronous output:  wait for a free staging buffer, copy the data into it, and
+  // hand it to the I/O thread, which keeps the database open between frames
+  Frame* frame = NULL;
+  {
+    PeridigmNS::Timer::self().startTimer("Output (Blocking)");
+    std::unique_lock<std::mutex> lock(frameMutex);
+    frameCondition.wait(lock, [this]{ return !freeFrames.empty() || !writerError.empty(); });
+    PeridigmNS::Timer::self().stopTimer("Output (Blocking)");
+    TEUCHOS_TEST_FOR_EXCEPTION(!writerError.empty(), std::runtime_error, writerError);
+    frame = freeFrames.back();
+    freeFrames.pop_back();
+  }
+
+  stageFrame(blocks, current_time, *frame);
+
+  {
+    std::lock_guard<std::mutex> lock(frameMutex);
+    pendingFrames.push_back(frame);
+  }
+  frameCondition.notify_all();
+
+  if (!writerThread.joinable())
+    writerThread = std::thread(&PeridigmNS::OutputManager_ExodusII::writerThreadLoop, this);
+}
+
+void PeridigmNS::OutputManager_ExodusII::stageFrame(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double current_time, Frame& frame) {
+
+  frame.exodusCount = exodusCount;
+  frame.time = current_time;
+  frame.globals.assign(global_output_field_map.size(), 0.0);
+  frame.numNodalVariables = 0;
+  frame.numElementVariables = 0;
 
   int num_nodes(1);
   if(!globalDataOnly)
     num_nodes = peridigm->getOneDimensionalMap()->NumMyElements();
 
-  // Allocate temporary storage for all mothership-like data
-  std::vector<double> x_vec(num_nodes), y_vec(num_nodes), z_vec(num_nodes);
-  double *xptr = &x_vec[0];
-  double *yptr = &y_vec[0];
-  double *zptr = &z_vec[0];
-
-  // allocate temporate storage for globals
-  int num_global_vars = global_output_field_map.size();
-  std::vector<double> globals_vec(num_global_vars);
-  double *globals = &globals_vec[0];
   unsigned int globalsIndex = 0;
 
   for (Teuchos::ParameterList::ConstIterator it = outputVariables->begin(); it != outputVariables->end(); ++it) {
@@ -280,34 +364,34 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
     double *block_ptr = NULL;
     if (spec.getRelation() == PeridigmField::GLOBAL) {
       // global vars are static within a block, so only need to reference first block
-      if (spec.getLength() == PeridigmField::SCALAR) {
-        TEUCHOS_TEST_FOR_EXCEPTION(globalsIndex >= globals_vec.size(), std::invalid_argument, "PeridigmNS::OutputManager_ExodusII::write() -- error writing global variable.");
-        if (spec.getTemporal() == PeridigmField::CONSTANT)
-          globals[globalsIndex++] = (*(blocks->begin()->getData(spec.getId(), PeridigmField::STEP_NONE)))[0];
-        else
-          globals[globalsIndex++] = (*(blocks->begin()->getData(spec.getId(), PeridigmField::STEP_NP1)))[0];
-      }
-      else if (spec.getLength() == PeridigmField::VECTOR) {
-        TEUCHOS_TEST_FOR_EXCEPTION(globalsIndex >= globals_vec.size(), std::invalid_argument, "PeridigmNS::OutputManager_ExodusII::write() -- error writing global variable.");
-        if (spec.getTemporal() == PeridigmField::CONSTANT){
-          globals[globalsIndex++] = (*(blocks->begin()->getData(spec.getId(), PeridigmField::STEP_NONE)))[0];
-          globals[globalsIndex++] = (*(blocks->begin()->getData(spec.getId(), PeridigmField::STEP_NONE)))[1];
-          globals[globalsIndex++] = (*(blocks->begin()->getData(spec.getId(), PeridigmField::STEP_NONE)))[2];
-        }
-        else{
-          globals[globalsIndex++] = (*(blocks->begin()->getData(spec.getId(), PeridigmField::STEP_NP1)))[0];
-          globals[globalsIndex++] = (*(blocks->begin()->getData(spec.getId(), PeridigmField::STEP_NP1)))[1];
-          globals[globalsIndex++] = (*(blocks->begin()->getData(spec.getId(), PeridigmField::STEP_NP1)))[2];
-        }
-      }
+      PeridigmField::Step step = PeridigmField::STEP_NP1;
+      if (spec.getTemporal() == PeridigmField::CONSTANT)
+        step = PeridigmField::STEP_NONE;
+      int length = 0;
+      if (spec.getLength() == PeridigmField::SCALAR)
+        length = 1;
+      else if (spec.getLength() == PeridigmField::VECTOR)
+        length = 3;
       else {
         TEUCHOS_TEST_FOR_EXCEPTION(true, std::invalid_argument, "PeridigmNS::OutputManager_ExodusII::write() -- unsupported global type (must be scalar or vector).");
       }
-      retval = ex_put_glob_vars(file_handle, exodusCount, num_global_vars, globals);
-      if (retval!= 0) reportExodusError(retval, "write", "ex_put_glob_vars");
+      for (int i=0 ; i<length ; ++i) {
+        TEUCHOS_TEST_FOR_EXCEPTION(globalsIndex >= frame.globals.size(), std::invalid_argument, "PeridigmNS::OutputManager_ExodusII::write() -- error writing global variable.");
+        frame.globals[globalsIndex++] = (*(blocks->begin()->getData(spec.getId(), step)))[i];
+      }
     }
     // Exodus ignores element blocks when writing nodal variables
     else if (spec.getRelation() == PeridigmField::NODE) {
+      double *xptr(NULL), *yptr(NULL), *zptr(NULL);
+      if (spec.getLength() == PeridigmField::SCALAR) {
+        xptr = addFrameVariable(frame.nodalVariables, frame.numNodalVariables, node_output_field_map[name], 0, num_nodes);
+      }
+      else if (spec.getLength() == PeridigmField::VECTOR) {
+        // Writing all vector output as per-node data
+        xptr = addFrameVariable(frame.nodalVariables, frame.numNodalVariables, node_output_field_map[name+"X"], 0, num_nodes);
+        yptr = addFrameVariable(frame.nodalVariables, frame.numNodalVariables, node_output_field_map[name+"Y"], 0, num_nodes);
+        zptr = addFrameVariable(frame.nodalVariables, frame.numNodalVariables, node_output_field_map[name+"Z"], 0, num_nodes);
+      }
       // Loop over all blocks, copying data from each block into mothership-like vector
       std::vector<PeridigmNS::Block>::iterator blockIt;
       for(blockIt = blocks->begin(); blockIt != blocks->end() ; blockIt++) {
@@ -338,42 +422,24 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
           }
         } // end switch on data dimension
       } // end loop over blocks
-      // Mothership-like vectors filled now; pass data to exodus database (switch again on dimension of data)
-      if (spec.getLength() == PeridigmField::SCALAR) {
-        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[name], num_nodes, xptr);
-        if (retval!= 0) reportExodusError(retval, "write", "ex_put_nodal_var");
-      }
-      else if (spec.getLength() == PeridigmField::VECTOR) {
-        // Writing all vector output as per-node data
-        string tmpnameX = name+"X";
-        string tmpnameY = name+"Y";
-        string tmpnameZ = name+"Z";
-        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[tmpnameX], num_nodes, xptr);
-        if (retval!= 0) reportExodusError(retval, "write", "ex_put_nodal_var");
-        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[tmpnameY], num_nodes, yptr);
-        if (retval!= 0) reportExodusError(retval, "write", "ex_put_nodal_var");
-        retval = ex_put_nodal_var(file_handle, exodusCount, node_output_field_map[tmpnameZ], num_nodes, zptr);
-        if (retval!= 0) reportExodusError(retval, "write", "ex_put_nodal_var");
-      }
     } // end if per-node variable
     // Exodus wants element data written individually for each element block
     else if (spec.getRelation() == PeridigmField::ELEMENT) {
-      // Loop over all blocks, passing data from each block to exodus database
+      // Loop over all blocks, copying the data of each block into non-interleaved arrays
       std::vector<PeridigmNS::Block>::iterator blockIt;
       for(blockIt = blocks->begin(); blockIt != blocks->end() ; blockIt++) {
         int block_num_nodes = (blockIt->getDataManager()->getOwnedScalarPointMap())->NumMyElements();
         if (block_num_nodes == 0) continue; // Don't write data for empty blocks
+        int blockId = blockIt->getID();
         if (spec.getId() == elementIdFieldId) { // Handle special case of ID (int type)
+          double *xptr = addFrameVariable(frame.elementVariables, frame.numElementVariables, element_output_field_map[name], blockId, block_num_nodes);
           for (int j=0; j<block_num_nodes; j++)
             xptr[j] = (double)(((blockIt->getDataManager()->getOwnedScalarPointMap())->GID(j))+1);
-          retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[name], blockIt->getID(), block_num_nodes, xptr);
-          if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
         }
         else if (spec.getId() == procNumFieldId) { // Handle special case of Proc_Num (int type)
+          double *xptr = addFrameVariable(frame.elementVariables, frame.numElementVariables, element_output_field_map[name], blockId, block_num_nodes);
           for (int j=0; j<block_num_nodes; j++)
             xptr[j] = (double)myPID;
-          retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[name], blockIt->getID(), block_num_nodes, xptr);
-          if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
         }
         else {
           Teuchos::RCP<Epetra_Vector> epetra_vector;
@@ -384,34 +450,20 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
             epetra_vector = blockIt->getData(spec.getId(), step);
             epetra_vector->ExtractView(&block_ptr);
             // switch on dimension of data
+            vector<string> suffix;
             if (spec.getLength() == PeridigmField::SCALAR) {
-              retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[name], blockIt->getID(), block_num_nodes, block_ptr);
-              if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
+              suffix.push_back("");
             }
             else if (spec.getLength() == PeridigmField::VECTOR) {
-              // copy data into x, y, and z vectors (non-interleaved)
-              for (int j=0;j<block_num_nodes; j++) {
-                xptr[j] = block_ptr[3*j];
-                yptr[j] = block_ptr[3*j+1];
-                zptr[j] = block_ptr[3*j+2];
-              }
-              // write the vectors to the exodus file
-              string tmpnameX = name+"X";
-              string tmpnameY = name+"Y";
-              string tmpnameZ = name+"Z";
-              retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[tmpnameX], blockIt->getID(), block_num_nodes, xptr);
-              if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
-              retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[tmpnameY], blockIt->getID(), block_num_nodes, yptr);
-              if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
-              retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[tmpnameZ], blockIt->getID(), block_num_nodes, zptr);
-              if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
+              suffix.push_back("X");
+              suffix.push_back("Y");
+              suffix.push_back("Z");
             }
             else if (spec.getLength() == PeridigmField::SYMMETRIC_TENSOR) {
               TEUCHOS_TEST_FOR_EXCEPT_MSG(spec.getLength() == PeridigmField::SYMMETRIC_TENSOR,
                                           "\nPeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(), output for SYMMETRIC_TENSOR currently not supported!\n");
             }
             else if (spec.getLength() == PeridigmField::FULL_TENSOR) {
-              vector<string> suffix;
               suffix.push_back("XX");
               suffix.push_back("XY");
               suffix.push_back("XZ");
@@ -421,49 +473,123 @@ void PeridigmNS::OutputManager_ExodusII::write(Teuchos::RCP< std::vector<Peridig
               suffix.push_back("ZX");
               suffix.push_back("ZY");
               suffix.push_back("ZZ");
-              for(int component=0 ; component<9 ; ++component){
-                // copy data into a non-interleaved array
-                for (int j=0; j<block_num_nodes; j++)
-                  xptr[j] = block_ptr[9*j+component];
-                // write data to exodus file
-                string tmpname = name+suffix[component];
-                retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[tmpname], blockIt->getID(), block_num_nodes, xptr);
-                if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
-              }
             }
             else {
               int length = PeridigmField::variableDimension(spec.getLength());
-              vector<string> suffix;
-              suffix.push_back("_1");
-              suffix.push_back("_2");
-              suffix.push_back("_3");
-              suffix.push_back("_4");
-              suffix.push_back("_5");
-              suffix.push_back("_6");
-              suffix.push_back("_7");
-              suffix.push_back("_8");
-              suffix.push_back("_9");
               for(int component=0 ; component<length ; ++component){
-                // copy data into a non-interleaved array
-                for (int j=0; j<block_num_nodes; j++)
-                  xptr[j] = block_ptr[length*j+component];
-                // write data to exodus file
-                string tmpname = name+suffix[component];
-                retval = ex_put_elem_var(file_handle, exodusCount, element_output_field_map[tmpname], blockIt->getID(), block_num_nodes, xptr);
-                if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
+                std::ostringstream tmpname;
+                tmpname << "_" << component+1;
+                suffix.push_back(tmpname.str());
               }
             }  // end switch on data dimension
+            int length = suffix.size();
+            for(int component=0 ; component<length ; ++component){
+              // copy data into a non-interleaved array
+              double *xptr = addFrameVariable(frame.elementVariables, frame.numElementVariables, element_output_field_map[name+suffix[component]], blockId, block_num_nodes);
+              for (int j=0; j<block_num_nodes; j++)
+                xptr[j] = block_ptr[length*j+component];
+            }
           }
         }
       } // end loop over blocks
     } // if per-element variable
   }
+}
+
+void PeridigmNS::OutputManager_ExodusII::writeFrame(int fileHandle, const Frame& frame) {
+
+  // Write time value
+  int retval = ex_put_time(fileHandle, frame.exodusCount, &frame.time);
+  if (retval!= 0) reportExodusError(retval, "write", "ex_put_time");
+
+  if (!frame.globals.empty()) {
+    retval = ex_put_glob_vars(fileHandle, frame.exodusCount, frame.globals.size(), &frame.globals[0]);
+    if (retval!= 0) reportExodusError(retval, "write", "ex_put_glob_vars");
+  }
+
+  for (unsigned int i=0 ; i<frame.numNodalVariables ; ++i) {
+    const FrameVariable& variable = frame.nodalVariables[i];
+    retval = ex_put_nodal_var(fileHandle, frame.exodusCount, variable.index, variable.values.size(), variable.values.data());
+    if (retval!= 0) reportExodusError(retval, "write", "ex_put_nodal_var");
+  }
+
+  for (unsigned int i=0 ; i<frame.numElementVariables ; ++i) {
+    const FrameVariable& variable = frame.elementVariables[i];
+    retval = ex_put_elem_var(fileHandle, frame.exodusCount, variable.index, variable.blockId, variable.values.size(), variable.values.data());
+    if (retval!= 0) reportExodusError(retval, "write", "ex_put_elem_var");
+  }
 
   // Flush write
-  retval = ex_update(file_handle);
+  retval = ex_update(fileHandle);
   if (retval!= 0) reportExodusError(retval, "write", "ex_update");
-  retval = ex_close(file_handle);
-  if (retval!= 0) reportExodusError(retval, "write", "ex_close");
+}
+
+void PeridigmNS::OutputManager_ExodusII::writerThreadLoop() {
+
+  int fileHandle = -1;
+  while (true) {
+    Frame* frame = NULL;
+    {
+      std::unique_lock<std::mutex> lock(frameMutex);
+      frameCondition.wait(lock, [this]{ return !pendingFrames.empty() || writerShutdown; });
+      if (pendingFrames.empty())
+        break;
+      frame = pendingFrames.front();
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    string error;
+    try {
+      std::lock_guard<std::mutex> exodusLock(exodusMutex());
+      if (fileHandle < 0) {
+        int cpuWordSize(CPU_word_size), ioWordSize(IO_word_size);
+        float version;
+        fileHandle = ex_open(filename.str().c_str(), EX_WRITE, &cpuWordSize, &ioWordSize, &version);
+        if (fileHandle < 0) reportExodusError(fileHandle, "write", "ex_open");
+      }
+      writeFrame(fileHandle, *frame);
+    }
+    catch (std::exception& e) {
+      error = e.what();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    {
+      std::lock_guard<std::mutex> lock(frameMutex);
+      pendingFrames.pop_front();
+      freeFrames.push_back(frame);
+      overlappedWriteTime += elapsed.count();
+      if (!error.empty() && writerError.empty())
+        writerError = error;
+    }
+    frameCondition.notify_all();
+  }
+
+  if (fileHandle >= 0) {
+    std::lock_guard<std::mutex> exodusLock(exodusMutex());
+    ex_close(fileHandle);
+  }
+}
+
+void PeridigmNS::OutputManager_ExodusII::drainFrames() {
+
+  if (!writerThread.joinable())
+    return;
+
+  PeridigmNS::Timer::self().startTimer("Output (Blocking)");
+  {
+    std::unique_lock<std::mutex> lock(frameMutex);
+    frameCondition.wait(lock, [this]{ return pendingFrames.empty(); });
+  }
+  PeridigmNS::Timer::self().stopTimer("Output (Blocking)");
+
+  std::lock_guard<std::mutex> lock(frameMutex);
+  PeridigmNS::Timer::self().addTime("Output (Overlapped)", overlappedWriteTime);
+  overlappedWriteTime = 0.0;
+  // The error is reported once
+  string error;
+  error.swap(writerError);
+  TEUCHOS_TEST_FOR_EXCEPTION(!error.empty(), std::runtime_error, error);
 }
 
 void PeridigmNS::OutputManager_ExodusII::initializeExodusDatabase(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks) {
@@ -1126,6 +1252,33 @@ void PeridigmNS::OutputManager_ExodusII::multiplyOutputFrequency(double multipli
   frequency *= multiplier;
 }
 
+bool PeridigmNS::OutputManager_ExodusII::isOutputCount(int writeCount) const {
+  return !((writeCount<(firstOutputStep) || writeCount>(lastOutputStep+1)) || (frequency<=0 || (writeCount-1)%frequency!=0));
+}
+
+bool PeridigmNS::OutputManager_ExodusII::willWrite(int callsAhead) const {
+  if (!iWrite) return false;
+  int writeCount = count + 1 + callsAhead;
+  // The first call also initializes the compute classes
+  if (writeCount == 1) return true;
+  return isOutputCount(writeCount);
+}
+
 void PeridigmNS::OutputManager_ExodusII::changeOutputFrequency(int output_frequency) {
   frequency = output_frequency;
 }
+
+double PeridigmNS::OutputManager_ExodusII::memorySize() const {
+  // Buffers are only resized on the calling thread, so their capacities can be read while frames are written
+  double sizeInBytes = 0.0;
+  for(int i=0 ; i<2 ; ++i){
+    const Frame& frame = frameBuffers[i];
+    sizeInBytes += frame.globals.capacity()*sizeof(double);
+    sizeInBytes += (frame.nodalVariables.capacity() + frame.elementVariables.capacity())*sizeof(FrameVariable);
+    for(unsigned int j=0 ; j<frame.nodalVariables.size() ; ++j)
+      sizeInBytes += frame.nodalVariables[j].values.capacity()*sizeof(double);
+    for(unsigned int j=0 ; j<frame.elementVariables.size() ; ++j)
+      sizeInBytes += frame.elementVariables[j].values.capacity()*sizeof(double);
+  }
+  return sizeInBytes/1048576.0;
+}
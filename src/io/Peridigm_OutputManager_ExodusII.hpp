@@ -47,6 +47,10 @@
 #define PERIDIGM_OUTPUTMANAGER_EXODUSII_HPP
 
 #include <map>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include <Peridigm_OutputManager.hpp>
 
@@ -80,6 +84,15 @@ namespace PeridigmNS {
     //! Change output frequency, for the sake of switching from Quasi-static to explicit solver
     virtual void changeOutputFrequency(int);
 
+    //! Returns true if the (callsAhead+1)-th upcoming call to write() will write data.
+    virtual bool willWrite(int callsAhead = 0) const;
+
+    //! Returns the memory used by the frame staging buffers, in megabytes.
+    virtual double memorySize() const;
+
+    //! Waits until every staged frame has been written; throws if the I/O thread failed to write a frame.
+    virtual void flush() { drainFrames(); }
+
   private:
     
     //! Copy constructor.
@@ -103,6 +116,71 @@ namespace PeridigmNS {
     //! Write the QA record
     void writeQARecord(int exoid);
 
+    //! Returns true if the write() call with the given count writes data
+    bool isOutputCount(int writeCount) const;
+
+    //! Values of one Exodus variable in a staged frame.
+    struct FrameVariable {
+      //! Exodus variable index
+      int index;
+      //! Element block id, unused for nodal variables
+      int blockId;
+      std::vector<double> values;
+    };
+
+    //! Copy of all data written for one output step; buffers are reused from frame to frame.
+    struct Frame {
+      int exodusCount;
+      double time;
+      std::vector<double> globals;
+      std::vector<FrameVariable> nodalVariables;
+      std::vector<FrameVariable> elementVariables;
+      unsigned int numNodalVariables;
+      unsigned int numElementVariables;
+    };
+
+    //! Copies the requested output fields into a frame
+    void stageFrame(Teuchos::RCP< std::vector<PeridigmNS::Block> > blocks, double current_time, Frame& frame);
+
+    //! Writes a staged frame to an open exodus database
+    void writeFrame(int fileHandle, const Frame& frame);
+
+    //! Main loop of the I/O thread used for asynchronous output
+    void writerThreadLoop();
+
+    //! Blocks until the I/O thread has written every staged frame; rethrows any error raised on the I/O thread
+    void drainFrames();
+
+    //! Flag indicating that frames are handed to a background I/O thread
+    bool asynchronousWrite;
+
+    //! Staging buffers for asynchronous output; one can be filled while the other is written
+    Frame frameBuffers[2];
+
+    //! Staged frames waiting for the I/O thread, oldest first
+    std::deque<Frame*> pendingFrames;
+
+    //! Staging buffers not currently owned by the I/O thread
+    std::vector<Frame*> freeFrames;
+
+    //! Guards pendingFrames, freeFrames, writerShutdown, writerError and overlappedWriteTime
+    std::mutex frameMutex;
+
+    //! Signals changes of pendingFrames and freeFrames
+    std::condition_variable frameCondition;
+
+    //! The I/O thread, started on the first asynchronous write
+    std::thread writerThread;
+
+    //! Set to stop the I/O thread once pendingFrames is empty
+    bool writerShutdown;
+
+    //! Error message raised on the I/O thread
+    std::string writerError;
+
+    //! Seconds spent by the I/O thread writing frames, not yet reported to the timer
+    double overlappedWriteTime;
+
     //! Parent pointer
     PeridigmNS::Peridigm *peridigm;
 
@@ -48,6 +48,7 @@
 #include "Peridigm_AlbanyDiscretization.hpp"
 #include "Peridigm_ProximitySearch.hpp"
 #include "Peridigm_HorizonManager.hpp"
+#include "Peridigm_Timer.hpp"
 
 #include <Epetra_Map.h>
 #include <Epetra_Vector.h>
@@ -144,7 +145,10 @@ PeridigmNS::AlbanyDiscretization::AlbanyDiscretization(const MPI_Comm& mpiComm,
   // Perform the proximity search to identify neighbors
   int neighborListSize;
   int* neighborList;
+  // The bond filters are applied during the search, so their cost is included in the search time
+  PeridigmNS::Timer::self().startTimer("Neighborhood Search");
   ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters);
+  PeridigmNS::Timer::self().stopTimer("Neighborhood Search");
 
   createNeighborhoodData(neighborListSize, neighborList);
 
@@ -47,6 +47,7 @@
 
 #include "Peridigm_Discretization.hpp"
 #include "Peridigm_GenesisToTriangles.hpp"
+#include "Peridigm_Timer.hpp"
 #include <sstream>
 #include <set>
 
@@ -150,6 +151,7 @@ Epetra_BlockMap PeridigmNS::Discretization::getOverlapMap(const Epetra_Comm& com
 
 void PeridigmNS::Discretization::createBondFilters(const Teuchos::RCP<Teuchos::ParameterList>& params){
   if(params->isSublist("Bond Filters")){
+    PeridigmNS::Timer::self().startTimer("Create Bond Filters");
     Teuchos::RCP<Teuchos::ParameterList> bondFilterParameters = sublist(params, "Bond Filters");
     for (Teuchos::ParameterList::ConstIterator it = bondFilterParameters->begin(); it != bondFilterParameters->end(); ++it) {
       string parameterListName = it->first;
@@ -188,8 +190,9 @@ void PeridigmNS::Discretization::createBondFilters(const Teuchos::RCP<Teuchos::P
         std::string file_name = params.get<string>("File Name");
         std::vector< std::vector< std::vector<double> > > triangles;
         GenesisToTriangles(file_name, triangles);
-        for(unsigned int i=0 ; i<triangles.size() ; i++){
-          std::shared_ptr<PdBondFilter::BondFilter> bondFilter(new PdBondFilter::TriangleFilter(triangles[i][0].data(), triangles[i][1].data(), triangles[i][2].data()));
+        // A single filter holds the whole surface in a bounding-volume hierarchy
+        if(triangles.size() > 0){
+          std::shared_ptr<PdBondFilter::BondFilter> bondFilter(new PdBondFilter::TriangleMeshFilter(triangles));
           bondFilters.push_back(bondFilter);
         }
       }
@@ -199,6 +202,7 @@ void PeridigmNS::Discretization::createBondFilters(const Teuchos::RCP<Teuchos::P
         TEUCHOS_TEST_FOR_EXCEPT_MSG(true, msg);
       }
     }
+    PeridigmNS::Timer::self().stopTimer("Create Bond Filters");
   }
 }
 
@@ -231,3 +235,21 @@ int PeridigmNS::Discretization::blockNameToBlockId(string blockName) const {
 
   return bID;
 }
+
+bool PeridigmNS::Discretization::hasWeightedLoadBalance(const Teuchos::ParameterList& params)
+{
+  return params.isSublist("Load Balance");
+}
+
+double PeridigmNS::Discretization::getBlockCostFactor(const Teuchos::ParameterList& params, const std::string& blockName)
+{
+  if(!params.isSublist("Load Balance"))
+    return 1.0;
+  const Teuchos::ParameterList& loadBalanceParams = params.sublist("Load Balance");
+  if(!loadBalanceParams.isSublist("Block Cost Factors"))
+    return 1.0;
+  const Teuchos::ParameterList& costFactors = loadBalanceParams.sublist("Block Cost Factors");
+  if(!costFactors.isParameter(blockName))
+    return 1.0;
+  return costFactors.get<double>(blockName);
+}
@@ -161,6 +161,12 @@ namespace PeridigmNS {
     //! Get the block id for a given block name
     int blockNameToBlockId(std::string blockName) const;
 
+    //! Returns true if the discretization parameters contain a "Load Balance" sublist, which turns on weighted partitioning.
+    static bool hasWeightedLoadBalance(const Teuchos::ParameterList& params);
+
+    //! Relative cost of a point in the given block for weighted partitioning ("Block Cost Factors" in the "Load Balance" sublist, default one).
+    static double getBlockCostFactor(const Teuchos::ParameterList& params, const std::string& blockName);
+
   protected:
 
     //! Get the overlap map.
@@ -51,6 +51,7 @@
 #include "Peridigm_GeometryUtils.hpp"
 #include "Peridigm_Constants.hpp"
 #include "Peridigm_Enums.hpp"
+#include "Peridigm_Timer.hpp"
 #include <Epetra_Map.h>
 #include <Epetra_Vector.h>
 #include <Epetra_Import.h>
@@ -87,6 +88,10 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
 {
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params->get<string>("Type") != "Exodus", "Invalid Type in ExodusDiscretization");
 
+  // Exodus meshes are read in the decomposition written by decomp/nem_slice, so weighted partitioning cannot be applied
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(hasWeightedLoadBalance(*params),
+                              "\n**** Error:  The \"Load Balance\" sublist is not supported for Exodus discretizations, the mesh is read in its existing decomposition.\n");
+
   string meshFileName = params->get<string>("Input Mesh File");
 
   if(params->isParameter("Omit Bonds Between Blocks"))
@@ -154,10 +159,13 @@ PeridigmNS::ExodusDiscretization::ExodusDiscretization(const Teuchos::RCP<const
 
   // Execute the neighbor search
   // When computing element-horizon intersections, the search is expanded by the maximum element dimension
+  // The bond filters are applied during the search, so their cost is included in the search time
+  PeridigmNS::Timer::self().startTimer("Neighborhood Search");
   if(computeIntersections)
     ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters, maxElementDimension);
   else
     ProximitySearch::GlobalProximitySearch(initialX, horizonForEachPoint, oneDimensionalOverlapMap, neighborListSize, neighborList, bondFilters);
+  PeridigmNS::Timer::self().stopTimer("Neighborhood Search");
 
   // Ghost exodus data so that element-horizon intersections can be calculated for ghosted neighbors
   if(storeExodusMesh)
@@ -210,6 +210,24 @@ QUICKGRID::Data PeridigmNS::PdQuickGridDiscretization::getDiscretization(const T
   TEUCHOS_TEST_FOR_EXCEPT_MSG(!horizonManager.blockHasConstantHorizon(blockName), "\n**** Error, variable horizon not supported for QuickGrid discretizations!\n");
   double horizon = horizonManager.getBlockConstantHorizonValue(blockName);
 
+  // Load balance the decomposition, weighting each point by its bond count if requested
+  // (the QuickGrid decomposition carries its neighborhood list into the rebalance)
+#ifdef HAVE_MPI
+  bool weightedLoadBalance = hasWeightedLoadBalance(*params);
+  double costFactor = getBlockCostFactor(*params, blockName);
+  auto loadBalance = [&](QUICKGRID::Data& gridData) -> QUICKGRID::Data& {
+    if(!weightedLoadBalance)
+      return PDNEIGH::getLoadBalancedDiscretization(gridData);
+    gridData.weights = PDNEIGH::getNeighborhoodWeights(gridData);
+    PDNEIGH::getLoadBalancedDiscretization(gridData);
+    double myLoad(0.0);
+    for(size_t i=0 ; i<gridData.numPoints ; ++i)
+      myLoad += costFactor*(1.0 + gridData.neighborhood.get()[gridData.neighborhoodPtr.get()[i]]);
+    PDNEIGH::printLoadImbalance("Initial decomposition", myLoad, *comm);
+    return gridData;
+  };
+#endif
+
   // param list should have a "sublist" with different types that we switch on here
   QUICKGRID::Data decomp;
   if (params->isSublist("TensorProduct3DMeshGenerator")){
@@ -233,7 +251,7 @@ QUICKGRID::Data PeridigmNS::PdQuickGridDiscretization::getDiscretization(const T
     decomp =  QUICKGRID::getDiscretization(myPID, cellPerProcIter);
     // Load balance and write new decomposition
 #ifdef HAVE_MPI
-    decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
+    decomp = loadBalance(decomp);
 #endif
       
     minElementRadius = pow(0.238732414637843*(xLength/nx)*(yLength/ny)*(zLength/nz), 0.33333333333333333);
@@ -274,7 +292,7 @@ QUICKGRID::Data PeridigmNS::PdQuickGridDiscretization::getDiscretization(const T
     decomp =  QUICKGRID::getDiscretization(myPID, cellPerProcIter);
     // Load balance and write new decomposition
 #ifdef HAVE_MPI
-    decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
+    decomp = loadBalance(decomp);
 #endif
 
 //     minElementRadius = pow(0.238732414637843*(xLength/nx)*(yLength/ny)*(zLength/nz), 0.33333333333333333);
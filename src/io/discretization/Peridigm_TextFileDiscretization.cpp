@@ -48,6 +48,7 @@
 #include "Peridigm_TextFileDiscretization.hpp"
 #include "Peridigm_HorizonManager.hpp"
 #include "Peridigm_Enums.hpp"
+#include "Peridigm_Timer.hpp"
 #include "NeighborhoodList.h"
 #include "PdZoltan.h"
 
@@ -62,6 +63,7 @@
 
 #include <sstream>
 #include <fstream>
+#include <cmath>
 
 using namespace std;
 
@@ -250,6 +252,27 @@ QUICKGRID::Data PeridigmNS::TextFileDiscretization::getDecomp(const string& text
   for(unsigned int i=0 ; i<blockIds.size() ; ++i)
     tempBlockIDPtr[i] = blockIds[i];
 
+  // Weighted partitioning:  the cost of a point is its block cost factor times one plus the
+  // number of bonds, which is estimated here from the horizon and the point volume because the
+  // neighborhood list is not available until after the rebalance
+  bool weightedLoadBalance = hasWeightedLoadBalance(*params);
+  PeridigmNS::HorizonManager& horizonManager = PeridigmNS::HorizonManager::self();
+  if(weightedLoadBalance){
+    UTILITIES::Array<float> weights(numElements);
+    for(int i=0 ; i<numElements ; ++i){
+      stringstream blockName;
+      blockName << "block_" << blockIds[i];
+      double horizon;
+      if(horizonManager.blockHasConstantHorizon(blockName.str()))
+        horizon = horizonManager.getBlockConstantHorizonValue(blockName.str());
+      else
+        horizon = horizonManager.evaluateHorizon(blockName.str(), coordinates[3*i], coordinates[3*i+1], coordinates[3*i+2]);
+      double estimatedNumNeighbors = 4.0*M_PI*horizon*horizon*horizon/(3.0*volumes[i]);
+      weights[i] = static_cast<float>(getBlockCostFactor(*params, blockName.str())*(1.0 + estimatedNumNeighbors));
+    }
+    decomp.weights = weights.get_shared_ptr();
+  }
+
   // call the rebalance function on the current-configuration decomp
   decomp = PDNEIGH::getLoadBalancedDiscretization(decomp);
 
@@ -280,7 +303,6 @@ QUICKGRID::Data PeridigmNS::TextFileDiscretization::getDecomp(const string& text
   }
 
   // Record the horizon for each point
-  PeridigmNS::HorizonManager& horizonManager = PeridigmNS::HorizonManager::self();
   Teuchos::RCP<Epetra_Vector> rebalancedHorizonForEachPoint = Teuchos::rcp(new Epetra_Vector(rebalancedMap));
   double* rebalancedX = decomp.myX.get();
   for(map<string, vector<int> >::const_iterator it = elementBlocks->begin() ; it != elementBlocks->end() ; it++){
@@ -308,18 +330,34 @@ QUICKGRID::Data PeridigmNS::TextFileDiscretization::getDecomp(const string& text
   }
 
   // execute neighbor search and update the decomp to include resulting ghosts
+  // The bond filters are applied during the search, so their cost is included in the search time
   std::shared_ptr<const Epetra_Comm> commSp(comm.getRawPtr(), NonDeleter<const Epetra_Comm>());
   Teuchos::RCP<PDNEIGH::NeighborhoodList> list;
+  PeridigmNS::Timer::self().startTimer("Neighborhood Search");
   if(bondFilters.size() == 0){
     list = Teuchos::rcp(new PDNEIGH::NeighborhoodList(commSp,decomp.zoltanPtr.get(),decomp.numPoints,decomp.myGlobalIDs,decomp.myX,rebalancedHorizonForEachPoint));
   }
   else{
     list = Teuchos::rcp(new PDNEIGH::NeighborhoodList(commSp,decomp.zoltanPtr.get(),decomp.numPoints,decomp.myGlobalIDs,decomp.myX,rebalancedHorizonForEachPoint,bondFilters));
   }
+  PeridigmNS::Timer::self().stopTimer("Neighborhood Search");
   decomp.neighborhood=list->get_neighborhood();
   decomp.sizeNeighborhoodList=list->get_size_neighborhood_list();
   decomp.neighborhoodPtr=list->get_neighborhood_ptr();
 
+  // Report the resulting imbalance in terms of the actual bond counts
+  if(weightedLoadBalance){
+    double myLoad(0.0);
+    for(map<string, vector<int> >::const_iterator it = elementBlocks->begin() ; it != elementBlocks->end() ; it++){
+      double costFactor = getBlockCostFactor(*params, it->first);
+      for(unsigned int i=0 ; i<it->second.size() ; ++i){
+        int localId = rebalancedMap.LID(it->second[i]);
+        myLoad += costFactor*(1.0 + decomp.neighborhood.get()[decomp.neighborhoodPtr.get()[localId]]);
+      }
+    }
+    PDNEIGH::printLoadImbalance("Initial decomposition", myLoad, *comm);
+  }
+
   // Create all the maps.
   createMaps(decomp);
 
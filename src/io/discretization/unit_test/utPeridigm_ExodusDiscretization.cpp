@@ -603,6 +603,24 @@ TEUCHOS_UNIT_TEST(ExodusDiscretization, Exodus2x2x2Test) {
   TEST_FLOATING_EQUALITY(exodusNodePositions[23], 0.5, 1.0e-16);    
 }
 
+TEUCHOS_UNIT_TEST(ExodusDiscretization, LoadBalanceNotSupported) {
+
+  Teuchos::RCP<const Epetra_Comm> comm;
+  #ifdef HAVE_MPI
+    comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+  #else
+    comm = rcp(new Epetra_SerialComm);
+  #endif
+
+  // Exodus meshes keep their existing decomposition, a "Load Balance" sublist must be rejected rather than ignored
+  RCP<ParameterList> discParams = rcp(new ParameterList);
+  discParams->set("Type", "Exodus");
+  discParams->set("Input Mesh File", "utPeridigm_ExodusDiscretization_2x2x2.g");
+  discParams->sublist("Load Balance").sublist("Block Cost Factors").set("block_1", 2.0);
+
+  TEST_THROW(rcp(new ExodusDiscretization(comm, discParams)), std::logic_error);
+}
+
 int main
 (int argc, char* argv[])
 {
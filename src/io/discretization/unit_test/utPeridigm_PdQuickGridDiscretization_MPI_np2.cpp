@@ -342,6 +342,59 @@ TEUCHOS_UNIT_TEST(PdQuickGridDiscretization_MPI_np2, SimpleTensorProductMeshTest
   }
 }
 
+TEUCHOS_UNIT_TEST(PdQuickGridDiscretization_MPI_np2, WeightedLoadBalanceTest) {
+
+  Teuchos::RCP<Epetra_Comm> comm;
+  comm = rcp(new Epetra_MpiComm(MPI_COMM_WORLD));
+
+  TEST_COMPARE(comm->NumProc(), ==, 2);
+  if(comm->NumProc() != 2)
+    return;
+
+  // a 4x2x2 mesh, partitioned once unweighted and once weighted by bond count
+  ParameterList blockParameterList;
+  ParameterList& blockParams = blockParameterList.sublist("My Block");
+  blockParams.set("Block Names", "block_1");
+  blockParams.set("Horizon", 0.501);
+  PeridigmNS::HorizonManager::self().loadHorizonInformationFromBlockParameters(blockParameterList);
+
+  unsigned int numBonds[2];
+  for(int weighted=0 ; weighted<2 ; ++weighted){
+    RCP<ParameterList> discParams = rcp(new ParameterList);
+    discParams->set("Type", "PdQuickGrid");
+    discParams->set("NeighborhoodType", "Spherical");
+    ParameterList& quickGridParams = discParams->sublist("TensorProduct3DMeshGenerator");
+    quickGridParams.set("Type", "PdQuickGrid");
+    quickGridParams.set("X Origin", 0.0);
+    quickGridParams.set("Y Origin", 0.0);
+    quickGridParams.set("Z Origin", 0.0);
+    quickGridParams.set("X Length", 2.0);
+    quickGridParams.set("Y Length", 1.0);
+    quickGridParams.set("Z Length", 1.0);
+    quickGridParams.set("Number Points X", 4);
+    quickGridParams.set("Number Points Y", 2);
+    quickGridParams.set("Number Points Z", 2);
+    if(weighted)
+      discParams->sublist("Load Balance").sublist("Block Cost Factors").set("block_1", 2.0);
+
+    RCP<PdQuickGridDiscretization> discretization = rcp(new PdQuickGridDiscretization(comm, discParams));
+
+    // every point is owned exactly once and both processors receive work
+    Teuchos::RCP<const Epetra_BlockMap> map = discretization->getGlobalOwnedMap(1);
+    TEST_ASSERT(map->NumGlobalElements() == 16);
+    TEST_ASSERT(map->UniqueGIDs() == true);
+    TEST_ASSERT(map->NumMyElements() > 0);
+
+    unsigned int myNumBonds = discretization->getNumBonds();
+    int myNumBondsInt = static_cast<int>(myNumBonds), globalNumBonds(0);
+    comm->SumAll(&myNumBondsInt, &globalNumBonds, 1);
+    numBonds[weighted] = static_cast<unsigned int>(globalNumBonds);
+  }
+
+  // the weighted partition moves points but must not change the bond set
+  TEST_EQUALITY(numBonds[0], numBonds[1]);
+}
+
 int main
 (int argc, char* argv[])
 {
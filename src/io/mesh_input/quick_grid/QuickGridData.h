@@ -67,6 +67,12 @@ typedef struct Data {
 	std::shared_ptr<int> neighborhoodPtr;
 	std::shared_ptr<char> exportFlag;
 	std::shared_ptr<struct Zoltan_Struct> zoltanPtr;
+	/*
+	 * Optional load balance weight for each point (length numPoints); when set, Zoltan balances
+	 * the sum of the weights instead of the number of points.  The weights are not migrated and
+	 * are cleared by the load balance.
+	 */
+	std::shared_ptr<float> weights;
 	Data() : dimension(-1), globalNumPoints(-1), numPoints(-1), sizeNeighborhoodList(-1), numExport(0) {}
 	Data(int d, int numPoints, int myNumPts) : dimension(d), globalNumPoints(numPoints), numPoints(myNumPts) {}
 } QuickGridData;
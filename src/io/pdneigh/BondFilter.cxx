@@ -45,6 +45,7 @@
 
 #include "BondFilter.h"
 #include <cmath>
+#include <algorithm>
 #include <float.h>
 
 #include <iostream>
@@ -287,4 +288,176 @@ bool TriangleFilter::pointInTriangle(const double* x) const {
   return in_triangle;
 }
 
+void TriangleFilter::boundingBox(double lower[3], double upper[3]) const {
+  for (int i=0 ; i<3 ; i++) {
+    lower[i] = std::min(v1_[i], std::min(v2_[i], v3_[i]));
+    upper[i] = std::max(v1_[i], std::max(v2_[i], v3_[i]));
+  }
+}
+
+TriangleMeshFilter::TriangleMeshFilter(const std::vector< std::vector< std::vector<double> > >& triangles)
+: BondFilter(false), numIntersectionTests_(0)
+{
+  size_t numTriangles = triangles.size();
+  triangles_.reserve(numTriangles);
+  boxes_.resize(6*numTriangles);
+  order_.resize(numTriangles);
+  for(size_t i=0 ; i<numTriangles ; i++){
+    std::vector<double> v1(triangles[i][0]), v2(triangles[i][1]), v3(triangles[i][2]);
+    triangles_.push_back(TriangleFilter(v1.data(), v2.data(), v3.data()));
+    double *lower = &boxes_[6*i];
+    double *upper = &boxes_[6*i+3];
+    triangles_[i].boundingBox(lower, upper);
+    /*
+     * Pad the box so that intersections accepted by the barycentric tolerance are not culled
+     */
+    double extent = std::max(upper[0]-lower[0], std::max(upper[1]-lower[1], upper[2]-lower[2]));
+    for(int dim=0 ; dim<3 ; dim++){
+      lower[dim] -= 1.0e-12*extent;
+      upper[dim] += 1.0e-12*extent;
+    }
+    order_[i] = static_cast<int>(i);
+  }
+  if(numTriangles > 0){
+    nodes_.reserve(2*numTriangles);
+    build(0, static_cast<int>(numTriangles));
+  }
+}
+
+int TriangleMeshFilter::build(int first, int count) {
+
+  const int maxTrianglesPerLeaf = 4;
+
+  int nodeIndex = static_cast<int>(nodes_.size());
+  nodes_.push_back(Node());
+
+  /*
+   * Bounds of the triangle boxes, and of their centroids
+   */
+  double lower[3], upper[3], centroidLower[3], centroidUpper[3];
+  for(int dim=0 ; dim<3 ; dim++){
+    lower[dim] = centroidLower[dim] = DBL_MAX;
+    upper[dim] = centroidUpper[dim] = -DBL_MAX;
+  }
+  for(int i=first ; i<first+count ; i++){
+    const double *box = &boxes_[6*order_[i]];
+    for(int dim=0 ; dim<3 ; dim++){
+      double centroid = 0.5*(box[dim] + box[3+dim]);
+      lower[dim] = std::min(lower[dim], box[dim]);
+      upper[dim] = std::max(upper[dim], box[3+dim]);
+      centroidLower[dim] = std::min(centroidLower[dim], centroid);
+      centroidUpper[dim] = std::max(centroidUpper[dim], centroid);
+    }
+  }
+  for(int dim=0 ; dim<3 ; dim++){
+    nodes_[nodeIndex].lower[dim] = lower[dim];
+    nodes_[nodeIndex].upper[dim] = upper[dim];
+  }
+
+  /*
+   * Split at the median centroid along the longest axis
+   */
+  int axis = 0;
+  for(int dim=1 ; dim<3 ; dim++){
+    if(centroidUpper[dim] - centroidLower[dim] > centroidUpper[axis] - centroidLower[axis])
+      axis = dim;
+  }
+  if(count <= maxTrianglesPerLeaf || centroidUpper[axis] == centroidLower[axis]){
+    nodes_[nodeIndex].first = first;
+    nodes_[nodeIndex].count = count;
+    nodes_[nodeIndex].right = -1;
+    return nodeIndex;
+  }
+  int half = count/2;
+  const std::vector<double>& boxes = boxes_;
+  std::nth_element(order_.begin()+first, order_.begin()+first+half, order_.begin()+first+count,
+                   [&boxes, axis](int a, int b) {
+                     return boxes[6*a+axis] + boxes[6*a+3+axis] < boxes[6*b+axis] + boxes[6*b+3+axis];
+                   });
+  build(first, half);
+  int right = build(first+half, count-half);
+  nodes_[nodeIndex].first = first;
+  nodes_[nodeIndex].count = 0;
+  nodes_[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+void TriangleMeshFilter::findCandidates(const double lower[3], const double upper[3]) {
+
+  candidates_.clear();
+  if(nodes_.empty())
+    return;
+  stack_.clear();
+  stack_.push_back(0);
+  while(!stack_.empty()){
+    const Node& node = nodes_[stack_.back()];
+    int nodeIndex = stack_.back();
+    stack_.pop_back();
+    if(!boxesOverlap(node.lower, node.upper, lower, upper))
+      continue;
+    if(node.count > 0){
+      for(int i=node.first ; i<node.first+node.count ; i++){
+        int triangle = order_[i];
+        if(boxesOverlap(&boxes_[6*triangle], &boxes_[6*triangle+3], lower, upper))
+          candidates_.push_back(triangle);
+      }
+    }
+    else{
+      stack_.push_back(node.right);
+      stack_.push_back(nodeIndex+1);
+    }
+  }
+}
+
+void TriangleMeshFilter::filterBonds(std::vector<int>& treeList, const double *pt, const size_t ptLocalId, const double *xOverlap, bool *bondFlags) {
+
+  /*
+   * Gather the triangles that may be cut by any bond of this neighborhood
+   */
+  double lower[3], upper[3];
+  for(int dim=0 ; dim<3 ; dim++)
+    lower[dim] = upper[dim] = pt[dim];
+  for(unsigned int p=0;p<treeList.size();p++){
+    const double *p1 = xOverlap+(3*treeList[p]);
+    for(int dim=0 ; dim<3 ; dim++){
+      lower[dim] = std::min(lower[dim], p1[dim]);
+      upper[dim] = std::max(upper[dim], p1[dim]);
+    }
+  }
+  findCandidates(lower, upper);
+
+  const double *p0 = pt;
+  const double *p1;
+  bool *flagIter = bondFlags;
+  for(unsigned int p=0;p<treeList.size();p++,flagIter++){
+
+    // Local id of point within neighborhood
+    size_t uid = treeList[p];
+
+    // Set flag for bonds that will be excluded from the neighborlist
+    p1 = xOverlap+(3*uid);
+    if(ptLocalId==uid && !includeSelf) {
+      *flagIter=1;
+      continue;
+    }
+    if(candidates_.empty())
+      continue;
+    double bondLower[3], bondUpper[3];
+    for(int dim=0 ; dim<3 ; dim++){
+      bondLower[dim] = std::min(p0[dim], p1[dim]);
+      bondUpper[dim] = std::max(p0[dim], p1[dim]);
+    }
+    for(unsigned int c=0;c<candidates_.size();c++){
+      int triangle = candidates_[c];
+      if(!boxesOverlap(&boxes_[6*triangle], &boxes_[6*triangle+3], bondLower, bondUpper))
+        continue;
+      numIntersectionTests_++;
+      if( triangles_[triangle].bondIntersectsTriangle(p0, p1) ) {
+        *flagIter=1;
+        break;
+      }
+    }
+  }
+}
+
 } // namespace PdBondFilter
@@ -173,8 +173,12 @@ public:
   }
 	virtual ~TriangleFilter() {}
 	virtual void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* markForExclusion);
-private:
   bool bondIntersectsTriangle(const double* p0, const double* p1) const;
+  /*
+   * Axis-aligned bounding box of the triangle
+   */
+  void boundingBox(double lower[3], double upper[3]) const;
+private:
   bool pointInTriangle(const double* x) const;
   double v1_[3];
   double v2_[3];
@@ -183,6 +187,54 @@ private:
   double tolerance_;
 };
 
+/**
+ * Filter removes bonds from Neighborhood that intersect any triangle of a surface mesh;
+ * The triangles are stored in a bounding-volume hierarchy (binary tree of axis-aligned boxes),
+ * so that each bond is only tested against the triangles whose boxes overlap the box of the bond.
+ * Equivalent to one TriangleFilter per triangle, at a cost that grows with log(numTriangles).
+ * NOTE: This filter does NOT include the point x in its own neighborhood H(x)
+ */
+class TriangleMeshFilter: public BondFilter {
+public:
+  /*
+   * @param triangles: triangles[i][j] are the coordinates of vertex j of triangle i
+   */
+  explicit TriangleMeshFilter(const std::vector< std::vector< std::vector<double> > >& triangles);
+	virtual ~TriangleMeshFilter() {}
+	virtual void filterBonds(std::vector<int>& treeList, const double *pt, const std::size_t ptLocalId, const double *xOverlap, bool* markForExclusion);
+  std::size_t numTriangles() const { return triangles_.size(); }
+  /*
+   * Number of exact bond-triangle intersection tests performed so far
+   */
+  std::size_t numIntersectionTests() const { return numIntersectionTests_; }
+private:
+  /*
+   * Tree node; the left child of an interior node immediately follows it in nodes_,
+   * a leaf (count > 0) holds triangles order_[first] through order_[first+count-1]
+   */
+  struct Node {
+    double lower[3];
+    double upper[3];
+    int first;
+    int count;
+    int right;
+  };
+  int build(int first, int count);
+  void findCandidates(const double lower[3], const double upper[3]);
+  bool boxesOverlap(const double* lowerA, const double* upperA, const double* lowerB, const double* upperB) const {
+    return lowerA[0] <= upperB[0] && lowerB[0] <= upperA[0] &&
+           lowerA[1] <= upperB[1] && lowerB[1] <= upperA[1] &&
+           lowerA[2] <= upperB[2] && lowerB[2] <= upperA[2];
+  }
+  std::vector<TriangleFilter> triangles_;
+  std::vector<double> boxes_;
+  std::vector<int> order_;
+  std::vector<Node> nodes_;
+  std::vector<int> candidates_;
+  std::vector<int> stack_;
+  std::size_t numIntersectionTests_;
+};
+
 }
 
 #endif /* BONDFILTER_H_ */
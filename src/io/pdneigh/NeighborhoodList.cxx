@@ -55,6 +55,7 @@
 
 #include "Peridigm_JAMSearchTree.hpp"
 #include "Peridigm_ZoltanSearchTree.hpp"
+#include "Peridigm_CellListSearchTree.hpp"
 #include "Peridigm_Memstat.hpp"
 
 #include <stdexcept>
@@ -142,7 +143,8 @@ NeighborhoodList::NeighborhoodList
 		shared_ptr<int> ownedGIDs,
 		shared_ptr<double> owned_coordinates,
 		Teuchos::RCP<Epetra_Vector> horizonList,
-		std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters
+		std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters,
+		SearchType searchType
 )
 :
 		epetraComm(comm),
@@ -159,7 +161,8 @@ NeighborhoodList::NeighborhoodList
 		num_neighbors(num_owned_points),
 		sharedGIDs(),
 		zoltan(zz),
-		filter_ptrs(bondFilters)
+		filter_ptrs(bondFilters),
+		search_type(searchType)
 {
         if(filter_ptrs.size() == 0){
           filter_ptrs.push_back(shared_ptr<PdBondFilter::BondFilter>(new PdBondFilter::BondFilterDefault()));
@@ -204,7 +207,8 @@ NeighborhoodList::NeighborhoodList
 		shared_ptr<int> ownedGIDs,
 		shared_ptr<double> owned_coordinates,
 		double horizon,
-		std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters
+		std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters,
+		SearchType searchType
 )
 :
 		epetraComm(comm),
@@ -220,7 +224,8 @@ NeighborhoodList::NeighborhoodList
 		num_neighbors(num_owned_points),
 		sharedGIDs(),
 		zoltan(zz),
-		filter_ptrs(bondFilters)
+		filter_ptrs(bondFilters),
+		search_type(searchType)
 {
      if(filter_ptrs.size() == 0){
        filter_ptrs.push_back(shared_ptr<PdBondFilter::BondFilter>(new PdBondFilter::BondFilterDefault()));
@@ -627,9 +632,17 @@ void NeighborhoodList::buildNeighborhoodList
 	/*
 	 * Create KdTree
      * There are two implemenations available:  JAM and Zoltan
+     * Alternatively, a cell list binned at the largest horizon
 	 */
     //PeridigmNS::SearchTree* searchTree = new PeridigmNS::JAMSearchTree(numOverlapPoints, xOverlapPtr.get());
-    PeridigmNS::SearchTree* searchTree = new PeridigmNS::ZoltanSearchTree(numOverlapPoints, xOverlapPtr.get());
+    PeridigmNS::SearchTree* searchTree;
+    if(CELL_LIST==search_type){
+        double maxHorizon;
+        horizons->MaxValue(&maxHorizon);
+        searchTree = new PeridigmNS::CellListSearchTree(numOverlapPoints, xOverlapPtr.get(), maxHorizon);
+    }
+    else
+        searchTree = new PeridigmNS::ZoltanSearchTree(numOverlapPoints, xOverlapPtr.get());
 
 	/*
 	 * this is used by bond filters
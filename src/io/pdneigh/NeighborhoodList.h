@@ -123,6 +123,12 @@ private:
 	};
 
 public:
+	/*
+	 * Local search over the owned and ghosted points:  an RCB tree (Zoltan), or a uniform grid
+	 * with cells the size of the largest horizon, which is cheaper for nearly uniform point clouds
+	 */
+	enum SearchType { ZOLTAN_TREE=0, CELL_LIST=1 };
+
 	NeighborhoodList(
 			shared_ptr<const Epetra_Comm> comm,
 			struct Zoltan_Struct* zz,
@@ -130,7 +136,8 @@ public:
 			shared_ptr<int> ownedGIDs,
 			shared_ptr<double> owned_coordinates,
 			Teuchos::RCP<Epetra_Vector> horizonList,
-			std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< shared_ptr<PdBondFilter::BondFilter> >()
+			std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< shared_ptr<PdBondFilter::BondFilter> >(),
+			SearchType searchType = ZOLTAN_TREE
 			);
 	NeighborhoodList(
 			shared_ptr<const Epetra_Comm> comm,
@@ -139,7 +146,8 @@ public:
 			shared_ptr<int> ownedGIDs,
 			shared_ptr<double> owned_coordinates,
 			double horizon,
-			std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< shared_ptr<PdBondFilter::BondFilter> >()
+			std::vector< shared_ptr<PdBondFilter::BondFilter> > bondFilters = std::vector< shared_ptr<PdBondFilter::BondFilter> >(),
+			SearchType searchType = ZOLTAN_TREE
 			);
 	double get_frameset_buffer_size() const;
 	size_t get_num_owned_points() const;
@@ -179,6 +187,7 @@ private:
 	Array<int> neighborhood, local_neighborhood, neighborhood_ptr, num_neighbors, sharedGIDs;
 	struct Zoltan_Struct* zoltan;
 	std::vector< shared_ptr<PdBondFilter::BondFilter> > filter_ptrs;
+	SearchType search_type;
 
 };
 
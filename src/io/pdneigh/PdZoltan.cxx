@@ -159,7 +159,11 @@ struct Zoltan_Struct * createAndInitializeZoltan(QuickGridData& pdGridData){
 	 * The number of weights (to be supplied by the user in a query function) associated with an object.
 	 * If this parameter is zero, all objects have equal weight.
 	 */
-	Zoltan_Set_Param(zoltan, "OBJ_WEIGHT_DIM", "0");
+	/*
+	 * Weighted partitioning is used when the application supplies weights; every
+	 * processor must set (or not set) the weights so that the value is consistent.
+	 */
+	Zoltan_Set_Param(zoltan, "OBJ_WEIGHT_DIM", pdGridData.weights ? "1" : "0");
 
 	/*
 	 * Must set this so that we can later call Zoltan_LB_Box_PP_Assign
@@ -366,6 +370,50 @@ void zoltanQuery_objectList
 		zoltanGlobalIds[i] = gIds[i];
 		zoltanLocalIds[i] = i;
 	}
+	if(numWeights > 0){
+		float *weights = gridData->weights.get();
+		for(size_t i=0; i<gridData->numPoints; i++)
+			objectWts[i] = weights[i];
+	}
+}
+
+std::shared_ptr<float> getNeighborhoodWeights(const QuickGridData& pdGridData, const double* costFactors){
+	UTILITIES::Array<float> weights(pdGridData.numPoints);
+	float *w = weights.get();
+	const int *neighborhood = pdGridData.neighborhood.get();
+	const int *neighborhoodPtr = pdGridData.neighborhoodPtr.get();
+	for(size_t p=0;p<pdGridData.numPoints;p++){
+		int numNeigh = neighborhood[neighborhoodPtr[p]];
+		double factor = costFactors ? costFactors[p] : 1.0;
+		w[p] = static_cast<float>(factor*(1+numNeigh));
+	}
+	return weights.get_shared_ptr();
+}
+
+void printLoadImbalance(const std::string& label, double myLoad, const Epetra_Comm& comm){
+	int rank = comm.MyPID();
+	int numProcs = comm.NumProc();
+	vector<double> loads(numProcs);
+	comm.GatherAll(&myLoad, &loads[0], 1);
+	if(rank != 0)
+		return;
+
+	double sum=0, maxLoad=loads[0], minLoad=loads[0];
+	for(int p=0;p<numProcs;p++){
+		sum += loads[p];
+		if(loads[p] > maxLoad) maxLoad = loads[p];
+		if(loads[p] < minLoad) minLoad = loads[p];
+	}
+	double average = sum/numProcs;
+	cout << label << ": load imbalance (max/average) " << (average > 0 ? maxLoad/average : 1.0)
+	     << ", min " << minLoad << ", max " << maxLoad << ", average " << average << endl;
+	cout << "  Load per processor (relative to average):";
+	for(int p=0;p<numProcs;p++){
+		if(p%8 == 0)
+			cout << "\n   ";
+		cout << " " << p << ":" << (average > 0 ? loads[p]/average : 1.0);
+	}
+	cout << "\n" << endl;
 }
 
 int zoltanQuery_dimension
@@ -800,6 +848,7 @@ void zoltanQuery_unPackPointsMultiFunction
 	gridData->neighborhood = newNeighborhood.get_shared_ptr();
 	gridData->neighborhoodPtr = newNeighborhoodPtr;
 	gridData->exportFlag = newGridData.exportFlag;
+	gridData->weights.reset();
 //	std::cout << "zoltanQuery_unPackPointsMultiFunction: Finish" << std::endl;
 }
 
@@ -48,6 +48,8 @@
 
 #include "zoltan.h"
 #include "QuickGridData.h"
+#include <Epetra_Comm.h>
+#include <string>
 
 namespace PDNEIGH {
 
@@ -63,6 +65,17 @@ struct Zoltan_Struct * createAndInitializeZoltan(QUICKGRID::QuickGridData& pdGri
  */
 QUICKGRID::QuickGridData& getLoadBalancedDiscretization(QUICKGRID::QuickGridData& pdGridData);
 
+/*
+ * Load balance weights proportional to the cost of each point:  costFactors[i]*(1+numNeighbors[i]);
+ * costFactors may be null, in which case all factors are one.  Requires the neighborhood list.
+ */
+std::shared_ptr<float> getNeighborhoodWeights(const QUICKGRID::QuickGridData& pdGridData, const double* costFactors = 0);
+
+/*
+ * Collective over comm; gathers the load of every processor and prints the imbalance (max/average) on processor 0
+ */
+void printLoadImbalance(const std::string& label, double myLoad, const Epetra_Comm& comm);
+
 /*
  * Zoltan call back functions
  */
@@ -0,0 +1,134 @@
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "../BondFilter.h"
+#include <vector>
+#include <memory>
+
+using std::vector;
+
+TEUCHOS_UNIT_TEST(TriangleMeshFilter, MatchesTriangleFilters) {
+
+	/*
+	 * Unit cube of points cut by a staircase of triangles: each step is a pair of triangles
+	 * spanning the cube in y, at height z = 0.25 + 0.05*i over the strip x in [0.1*i, 0.1*(i+1)]
+	 */
+	vector< vector< vector<double> > > triangles;
+	for(int i=0;i<10;i++){
+		double x0 = 0.1*i, x1 = 0.1*(i+1), z = 0.25 + 0.05*i;
+		vector<double> a(3), b(3), c(3), d(3);
+		a[0]=x0; a[1]=0.0; a[2]=z;
+		b[0]=x1; b[1]=0.0; b[2]=z;
+		c[0]=x1; c[1]=1.0; c[2]=z;
+		d[0]=x0; d[1]=1.0; d[2]=z;
+		vector< vector<double> > t1(3), t2(3);
+		t1[0]=a; t1[1]=b; t1[2]=c;
+		t2[0]=a; t2[1]=c; t2[2]=d;
+		triangles.push_back(t1);
+		triangles.push_back(t2);
+	}
+	PdBondFilter::TriangleMeshFilter meshFilter(triangles);
+	TEST_ASSERT(meshFilter.numTriangles() == triangles.size());
+
+	vector< std::shared_ptr<PdBondFilter::TriangleFilter> > triangleFilters;
+	for(size_t i=0;i<triangles.size();i++)
+		triangleFilters.push_back(std::shared_ptr<PdBondFilter::TriangleFilter>(new PdBondFilter::TriangleFilter(triangles[i][0].data(), triangles[i][1].data(), triangles[i][2].data())));
+
+	/*
+	 * 7x7x7 lattice of points; the candidate neighbors of each point are those within a radius of 0.35
+	 */
+	int n = 7;
+	vector<double> x;
+	for(int i=0;i<n;i++)
+		for(int j=0;j<n;j++)
+			for(int k=0;k<n;k++){
+				x.push_back((i+0.5)/n);
+				x.push_back((j+0.5)/n);
+				x.push_back((k+0.5)/n);
+			}
+	int numPoints = n*n*n;
+
+	int numCut = 0;
+	size_t numBonds = 0;
+	for(int p=0;p<numPoints;p++){
+		vector<int> treeList;
+		for(int q=0;q<numPoints;q++){
+			double dx = x[3*q]-x[3*p], dy = x[3*q+1]-x[3*p+1], dz = x[3*q+2]-x[3*p+2];
+			if(dx*dx + dy*dy + dz*dz < 0.35*0.35)
+				treeList.push_back(q);
+		}
+		numBonds += treeList.size() - 1;
+		std::unique_ptr<bool[]> meshFlags(new bool[treeList.size()]);
+		std::unique_ptr<bool[]> triangleFlags(new bool[treeList.size()]);
+		for(size_t i=0;i<treeList.size();i++){
+			meshFlags[i] = false;
+			triangleFlags[i] = false;
+		}
+		meshFilter.filterBonds(treeList, &x[3*p], p, x.data(), meshFlags.get());
+		for(size_t f=0;f<triangleFilters.size();f++)
+			triangleFilters[f]->filterBonds(treeList, &x[3*p], p, x.data(), triangleFlags.get());
+		for(size_t i=0;i<treeList.size();i++){
+			TEST_EQUALITY(meshFlags[i], triangleFlags[i]);
+			if(triangleFlags[i] && treeList[i] != p)
+				numCut++;
+		}
+	}
+
+	/*
+	 * The surface cuts bonds, and the hierarchy avoids testing every bond against every triangle
+	 */
+	TEST_ASSERT(numCut > 0);
+	TEST_ASSERT(meshFilter.numIntersectionTests() > 0);
+	TEST_ASSERT(meshFilter.numIntersectionTests() < numBonds*triangles.size());
+}
+
+int main( int argc, char* argv[] ) {
+
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
@@ -51,6 +51,7 @@
 #include "Peridigm_Timer.hpp"
 #include "Peridigm_JAMSearchTree.hpp"
 #include "Peridigm_ZoltanSearchTree.hpp"
+#include "Peridigm_CellListSearchTree.hpp"
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_UnitTestHarness.hpp>
 #include "Teuchos_UnitTestRepository.hpp"
@@ -67,16 +68,46 @@ using namespace PeridigmNS;
 
 
 
-PeridigmNS::SearchTree* createTree(string treeType, int numPoints, double* coordinates)
+PeridigmNS::SearchTree* createTree(string treeType, int numPoints, double* coordinates, double searchRadius)
 {
   PeridigmNS::SearchTree* tree(NULL);
   if(treeType == "Zoltan")
     tree = new PeridigmNS::ZoltanSearchTree(numPoints, coordinates);
   else if(treeType == "JAM")
     tree = new PeridigmNS::JAMSearchTree(numPoints, coordinates);
+  else if(treeType == "CellList")
+    tree = new PeridigmNS::CellListSearchTree(numPoints, coordinates, searchRadius);
   return tree;
 }
 
+//! Read a mesh from a text file, storing the coordinates
+bool readMesh(string fileName, vector<double>& mesh)
+{
+  mesh.clear();
+  ifstream inFile(fileName.c_str());
+  if(!inFile.is_open()){
+    cout << "\n**** Warning:  This test can only be run from the directory where it resides (otherwise it won't find the input files) ****\n" << endl;
+    return false;
+  }
+  string str;
+  vector<double> data;
+  double num;
+  while(inFile.good()){
+    getline(inFile, str);
+    if( !(str[0] == '#' || str[0] == '/' || str[0] == '*' || str.size() == 0) ){
+      istringstream iss(str);
+      while ( iss >> num) data.push_back(num);
+      if(data.size() != 5)
+        return false;
+      mesh.push_back(data[0]);
+      mesh.push_back(data[1]);
+      mesh.push_back(data[2]);
+      data.clear();
+    }
+  }
+  return true;
+}
+
 
 //! Performance tests
 
@@ -91,7 +122,7 @@ void testPerformance( vector<int> neighborList, double searchRadius, vector<doub
    int degreesOfFreedom(3);
    //neighborList.clear();
    
-   searchTree = createTree(treeType, static_cast<int>(mesh.size()/3), meshPtr);
+   searchTree = createTree(treeType, static_cast<int>(mesh.size()/3), meshPtr, searchRadius);
    neighborList.resize(130);
 
    for(unsigned int i=0 ; i<mesh.size()/3 ; i++){
@@ -598,6 +629,39 @@ TEUCHOS_UNIT_TEST(SearchTree_Performance, JAMTest) {
 }
 
 
+//! Cell list search on the same meshes; the timings can be compared to those of the Zoltan and JAM trees
+
+TEUCHOS_UNIT_TEST(SearchTree_Performance, CellListTest) {
+
+  vector<int> neighborList;
+  vector<double> mesh;
+  string testName, treeType("CellList");
+  PeridigmNS::SearchTree* searchTree(NULL);
+  unsigned int totalBonds, maxBonds, minBonds;
+
+  const int numMeshes = 5;
+  string fileNames[numMeshes] = {"./input_files/dumbbell.txt", "./input_files/random.txt", "./input_files/cube_27000.txt",
+                                 "./input_files/cube_8000.txt", "./input_files/cube_1000.txt"};
+  string descriptions[numMeshes] = {"test 1)  Dumbbell mesh with 8022 points", "test 2)  Random mesh with 8000 points",
+                                    "test 3)  Equally-Spaced Cube with 27000 points", "test 4)  Equally-Spaced Cube with 8000 points",
+                                    "test 5)  Equally-Spaced Cube with 1000 points"};
+  double searchRadii[numMeshes] = {(1.0/3.0)*3.015, 3.0, (1.0/3.0)*3.015, 0.5*3.015, 1.0*3.015};
+  unsigned int expectedTotalBonds[numMeshes] = {8630086, 5005818, 2929168, 816728, 84288};
+  unsigned int expectedMaxBonds[numMeshes] = {1934, 963, 122, 122, 122};
+  unsigned int expectedMinBonds[numMeshes] = {52, 127, 28, 28, 28};
+
+  for(int i=0 ; i<numMeshes ; ++i){
+    TEST_EQUALITY(readMesh(fileNames[i], mesh), true);
+    testName = treeType + " " + descriptions[i];
+    PeridigmNS::Timer::self().startTimer(testName);
+    testPerformance( neighborList, searchRadii[i], mesh, testName, treeType, searchTree, totalBonds, maxBonds, minBonds);
+    TEST_EQUALITY(totalBonds, expectedTotalBonds[i]);
+    TEST_EQUALITY(maxBonds, expectedMaxBonds[i]);
+    TEST_EQUALITY(minBonds, expectedMinBonds[i]);
+    delete searchTree;
+    PeridigmNS::Timer::self().stopTimer(testName);
+  }
+}
 
 int main
 (int argc, char* argv[])
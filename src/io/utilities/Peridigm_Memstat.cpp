@@ -59,8 +59,50 @@ void PeridigmNS::Memstat::addStat(const std::string & description){
     stats.insert(std::pair<std::string,unsigned int>(description,heap_size));
 }
 
+void PeridigmNS::Memstat::setComponentStat(const std::string & category, double megabytes){
+  componentStats[category] = megabytes;
+}
+
+double PeridigmNS::Memstat::getComponentStat(const std::string & category) const {
+  std::map<std::string, double>::const_iterator it = componentStats.find(category);
+  if(it == componentStats.end())
+    return 0.0;
+  return it->second;
+}
+
+void PeridigmNS::Memstat::getComponentStatistics(std::vector<std::string>& categories,
+                                                 std::vector<double>& minMegabytes,
+                                                 std::vector<double>& maxMegabytes,
+                                                 std::vector<double>& aveMegabytes) const {
+  int count = (int)( componentStats.size() );
+  categories.resize(count);
+  minMegabytes.resize(count);
+  maxMegabytes.resize(count);
+  aveMegabytes.resize(count);
+  if(count == 0)
+    return;
+
+  vector<double> megabytes(count);
+  int i = 0;
+  for(std::map<std::string, double>::const_iterator it=componentStats.begin() ; it!=componentStats.end() ; ++it){
+    categories[i] = it->first;
+    megabytes[i] = it->second;
+    i++;
+  }
+  myComm->MinAll(&megabytes[0], &minMegabytes[0], count);
+  myComm->MaxAll(&megabytes[0], &maxMegabytes[0], count);
+  myComm->SumAll(&megabytes[0], &aveMegabytes[0], count);
+  for(i=0 ; i<count ; ++i)
+    aveMegabytes[i] /= myComm->NumProc();
+}
+
 void PeridigmNS::Memstat::printStats(){
 
+    // Collective, so it is called on every processor before the output below
+    vector<std::string> categories;
+    vector<double> minMegabytes, maxMegabytes, aveMegabytes;
+    getComponentStatistics(categories, minMegabytes, maxMegabytes, aveMegabytes);
+
     if(myComm->NumProc()== 1){
       if(myComm->MyPID() == 0){
       cout << "Memory Usage (Heap Alloc MB):\n";
@@ -106,4 +148,25 @@ void PeridigmNS::Memstat::printStats(){
       cout << "\n";
       }
     }
+    if(categories.size() > 0 && myComm->MyPID() == 0){
+      cout << "Memory Usage by Category (MB):\n";
+      if(myComm->NumProc() == 1){
+        for(unsigned int i=0 ; i<categories.size() ; ++i){
+          std::string desc = categories[i];
+          if(desc.length() > 25) desc.resize(25);
+          cout << "  " << left << setw(30) << desc << right << setw(12) << minMegabytes[i] << "\n";
+        }
+      }
+      else{
+        cout << "  " << left << setw(30) << " " << right << setw(12) << "Min" << right << setw(15) << "Max" << right << setw(15) << "Ave" << endl;
+        for(unsigned int i=0 ; i<categories.size() ; ++i){
+          std::string desc = categories[i];
+          if(desc.length() > 25) desc.resize(25);
+          cout << "  " << left << setw(30) << desc << right << setw(12) << minMegabytes[i]
+                                              << right << setw(15) << maxMegabytes[i]
+                                              << right << setw(15) << aveMegabytes[i] << "\n";
+        }
+      }
+      cout << "\n";
+    }
 }
@@ -50,6 +50,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <Teuchos_RCP.hpp>
 #include <Epetra_MpiComm.h>
 #include <Epetra_SerialComm.h>
@@ -57,6 +58,9 @@
 // This is a very simple class that keeps track of memory use at selected
 // points in the code that are usually associated with large allocations
 // (i.e. allocating the jacobian, or performing the neighborhood search)
+// It also keeps the footprint reported by the main data structures, by
+// category (i.e. bond data, jacobian, contact), so that the heap can be
+// attributed to its owners.
 // For more sophisticated profiling, the user should use a tool like valgrind.
 
 namespace PeridigmNS {
@@ -80,6 +84,21 @@ public:
   //! Add a memory stat and catagory to the list
   void addStat(const std::string & description);
 
+  //! Record the footprint of a category of data, in megabytes, replacing any previous value
+  void setComponentStat(const std::string & category, double megabytes);
+
+  //! Returns the footprint recorded on this processor for a category, in megabytes (zero if never recorded)
+  double getComponentStat(const std::string & category) const;
+
+  /*! \brief Min, max, and average over the processors of the footprint of each category, in megabytes.
+   *
+   *  Collective; every processor must have recorded the same categories.
+   */
+  void getComponentStatistics(std::vector<std::string>& categories,
+                              std::vector<double>& minMegabytes,
+                              std::vector<double>& maxMegabytes,
+                              std::vector<double>& aveMegabytes) const;
+
   //! Print out the stats
   void printStats();
 
@@ -97,6 +116,9 @@ private:
   //! Map that associates a description with a stat
   std::map<std::string, unsigned int> stats;
 
+  //! Map that associates a category with the megabytes reported for it
+  std::map<std::string, double> componentStats;
+
   static Memstat * myMemstatPtr;
   static Teuchos::RCP<const Epetra_Comm> myComm;
 
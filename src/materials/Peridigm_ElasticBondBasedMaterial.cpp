@@ -48,11 +48,13 @@
 #include "Peridigm_ElasticBondBasedMaterial.hpp"
 #include "Peridigm_Field.hpp"
 #include "elastic_bond_based.h"
+#include "Peridigm_Constants.hpp"
 #include <Teuchos_Assert.hpp>
+#include <vector>
 
 PeridigmNS::ElasticBondBasedMaterial::ElasticBondBasedMaterial(const Teuchos::ParameterList& params)
   : Material(params),
-    m_bulkModulus(0.0), m_density(0.0), m_horizon(0.0), m_volumeFieldId(-1), m_damageFieldId(-1),
+    m_bulkModulus(0.0), m_density(0.0), m_horizon(0.0), m_applyAnalyticJacobian(false), m_volumeFieldId(-1), m_damageFieldId(-1),
     m_modelCoordinatesFieldId(-1), m_coordinatesFieldId(-1), m_forceDensityFieldId(-1), m_bondDamageFieldId(-1)
 {
   //! \todo Add meaningful asserts on material properties.
@@ -62,6 +64,8 @@ PeridigmNS::ElasticBondBasedMaterial::ElasticBondBasedMaterial(const Teuchos::Pa
   if(params.isParameter("Young's Modulus") || params.isParameter("Poisson's Ratio") || params.isParameter("Shear Modulus")){
     TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Error:  The Elastic bond based material model supports only one elastic constant, the bulk modulus.");
   }
+  if(params.isParameter("Apply Analytic Jacobian"))
+    m_applyAnalyticJacobian = params.get<bool>("Apply Analytic Jacobian");
 
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
   m_volumeFieldId                  = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR,      PeridigmField::CONSTANT, "Volume");
@@ -113,3 +117,97 @@ PeridigmNS::ElasticBondBasedMaterial::computeForce(const double dt,
 
   MATERIAL_EVALUATION::computeInternalForceElasticBondBased(x,y,cellVolume,bondDamage,force,neighborhoodList,numOwnedPoints,m_bulkModulus,m_horizon);
 }
+
+void
+PeridigmNS::ElasticBondBasedMaterial::computeJacobian(const double dt,
+                                                      const int numOwnedPoints,
+                                                      const int* ownedIDs,
+                                                      const int* neighborhoodList,
+                                                      PeridigmNS::DataManager& dataManager,
+                                                      PeridigmNS::SerialMatrix& jacobian,
+                                                      PeridigmNS::Material::JacobianType jacobianType) const
+{
+  if(!m_applyAnalyticJacobian){
+    // Call the base class function, which computes the Jacobian by finite difference
+    PeridigmNS::Material::computeJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, jacobianType);
+    return;
+  }
+
+  // Tangent of the forces computed by computeInternalForceElasticBondBased().  For the bond from point p
+  // to neighbor q, with M = (y_q - y_p)/|y_q - y_p|, the force density is f_pq = t M and
+  //
+  //   d f_pq / d y_q = (1-d) c/(2 zeta) M M^T + t/|y_q - y_p| (I - M M^T),
+  //
+  // which enters the rows of p with V_p V_q and the rows of q with -V_p V_q.
+
+  double *x, *y, *cellVolume, *bondDamage;
+  dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
+  dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
+  dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
+  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+  const Epetra_BlockMap& ownedScalarPointMap = *dataManager.getOwnedScalarPointMap();
+  const Epetra_BlockMap& overlapScalarPointMap = *dataManager.getOverlapScalarPointMap();
+
+  const double pi = PeridigmNS::value_of_pi();
+  double constant = 18.0*m_bulkModulus/(pi*m_horizon*m_horizon*m_horizon*m_horizon);
+
+  std::vector<int> globalIndices;
+  int neighborhoodListIndex(0), bondIndex(0);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    const int* neighbors = neighborhoodList + neighborhoodListIndex;
+    neighborhoodListIndex += numNeighbors;
+    int numDof = 3*(numNeighbors+1);
+
+    // Rows and columns are ordered as the point itself, then its neighbors
+    globalIndices.resize(numDof);
+    int globalID = ownedScalarPointMap.GID(iID);
+    for(int j=0 ; j<3 ; ++j)
+      globalIndices[j] = 3*globalID+j;
+    for(int n=0 ; n<numNeighbors ; ++n){
+      globalID = overlapScalarPointMap.GID(neighbors[n]);
+      for(int j=0 ; j<3 ; ++j)
+        globalIndices[3*(n+1)+j] = 3*globalID+j;
+    }
+
+    if(scratchMatrix.Dimension() < numDof)
+      scratchMatrix.Resize(numDof);
+    for(int row=0 ; row<numDof ; ++row)
+      for(int col=0 ; col<numDof ; ++col)
+        scratchMatrix(row, col) = 0.0;
+
+    const double* X = &x[3*iID];
+    const double* Y = &y[3*iID];
+    double volume = cellVolume[iID];
+    for(int n=0 ; n<numNeighbors ; ++n, ++bondIndex){
+      int q = neighbors[n];
+      double initialBondLength = distance(X[0], X[1], X[2], x[3*q], x[3*q+1], x[3*q+2]);
+      double currentBondLength = distance(Y[0], Y[1], Y[2], y[3*q], y[3*q+1], y[3*q+2]);
+      double M[3];
+      for(int j=0 ; j<3 ; ++j)
+        M[j] = (y[3*q+j] - Y[j])/currentBondLength;
+      double stretch = (currentBondLength - initialBondLength)/initialBondLength;
+      double t = 0.5*(1.0 - bondDamage[bondIndex])*stretch*constant;
+      double axial = 0.5*(1.0 - bondDamage[bondIndex])*constant/initialBondLength;
+      double transverse = t/currentBondLength;
+      double scale = volume*cellVolume[q];
+      for(int i=0 ; i<3 ; ++i){
+        for(int j=0 ; j<3 ; ++j){
+          double value = scale*((axial - transverse)*M[i]*M[j] + (i == j ? transverse : 0.0));
+          scratchMatrix(i, j) -= value;
+          scratchMatrix(i, 3*(n+1)+j) += value;
+          scratchMatrix(3*(n+1)+i, j) += value;
+          scratchMatrix(3*(n+1)+i, 3*(n+1)+j) -= value;
+        }
+      }
+    }
+
+    if (jacobianType == PeridigmNS::Material::FULL_MATRIX)
+      jacobian.addValues(numDof, &globalIndices[0], scratchMatrix.Data());
+    else if (jacobianType == PeridigmNS::Material::BLOCK_DIAGONAL)
+      jacobian.addBlockDiagonalValues(numDof, &globalIndices[0], scratchMatrix.Data());
+    else // unknown jacobian type
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Unknown Jacobian Type\n");
+  }
+}
@@ -97,6 +97,16 @@ namespace PeridigmNS {
                  const int* neighborhoodList,
                  PeridigmNS::DataManager& dataManager) const;
 
+    //! Evaluate the jacobian by finite difference, or from the closed-form bond stiffness if "Apply Analytic Jacobian" is true.
+    virtual void
+    computeJacobian(const double dt,
+                    const int numOwnedPoints,
+                    const int* ownedIDs,
+                    const int* neighborhoodList,
+                    PeridigmNS::DataManager& dataManager,
+                    PeridigmNS::SerialMatrix& jacobian,
+                    PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
+
   protected:
 	
     //! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
@@ -110,6 +120,7 @@ namespace PeridigmNS {
     double m_bulkModulus;
     double m_density;
     double m_horizon;
+    bool m_applyAnalyticJacobian;
 
     // field spec ids for all relevant data
     std::vector<int> m_fieldIds;
@@ -47,12 +47,13 @@
 
 #include "Peridigm_ElasticMaterial.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_Timer.hpp"
 #include "elastic.h"
 #include "material_utilities.h"
 #include <Teuchos_Assert.hpp>
-#include <Epetra_SerialComm.h>
 #include <Sacado.hpp>
 #include <cmath>
+#include <algorithm>
 
 using namespace std;
 
@@ -60,12 +61,15 @@ PeridigmNS::ElasticMaterial::ElasticMaterial(const Teuchos::ParameterList& param
   : Material(params),
     m_bulkModulus(0.0), m_shearModulus(0.0), m_density(0.0), m_alpha(0.0), m_horizon(0.0),
     m_applyAutomaticDifferentiationJacobian(true),
+    m_applyAnalyticJacobian(false),
     m_applyThermalStrains(false),
     m_computePartialStress(false),
+    m_cacheBondGeometry(true),
     m_OMEGA(PeridigmNS::InfluenceFunction::self().getInfluenceFunction()),
     m_volumeFieldId(-1), m_damageFieldId(-1), m_weightedVolumeFieldId(-1), m_dilatationFieldId(-1), m_modelCoordinatesFieldId(-1),
     m_coordinatesFieldId(-1), m_forceDensityFieldId(-1), m_partialStressFieldId(-1), m_bondDamageFieldId(-1),
-    m_temperatureFieldId(-1), m_deltaTemperatureFieldId(-1)
+    m_temperatureFieldId(-1), m_deltaTemperatureFieldId(-1),
+    m_bondReferenceLengthFieldId(-1), m_bondInfluenceFunctionValueFieldId(-1), m_bondNeighborVolumeFieldId(-1)
 {
   //! \todo Add meaningful asserts on material properties.
   m_bulkModulus = calculateBulkModulus(params);
@@ -74,6 +78,11 @@ PeridigmNS::ElasticMaterial::ElasticMaterial(const Teuchos::ParameterList& param
   m_horizon = params.get<double>("Horizon");
   if(params.isParameter("Apply Automatic Differentiation Jacobian"))
     m_applyAutomaticDifferentiationJacobian = params.get<bool>("Apply Automatic Differentiation Jacobian");
+  // The closed-form Jacobian is opt-in; it takes precedence over the default automatic differentiation Jacobian
+  if(params.isParameter("Apply Analytic Jacobian"))
+    m_applyAnalyticJacobian = params.get<bool>("Apply Analytic Jacobian");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(m_applyAnalyticJacobian && params.isParameter("Apply Automatic Differentiation Jacobian") && m_applyAutomaticDifferentiationJacobian,
+                              "**** Error:  \"Apply Analytic Jacobian\" and \"Apply Automatic Differentiation Jacobian\" cannot both be true.\n");
 
   if(params.isParameter("Thermal Expansion Coefficient")){
     m_alpha = params.get<double>("Thermal Expansion Coefficient");
@@ -83,6 +92,11 @@ PeridigmNS::ElasticMaterial::ElasticMaterial(const Teuchos::ParameterList& param
   if(params.isParameter("Compute Partial Stress"))
     m_computePartialStress = params.get<bool>("Compute Partial Stress");
 
+  if(params.isParameter("Cache Bond Geometry"))
+    m_cacheBondGeometry = params.get<bool>("Cache Bond Geometry");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(m_threadParallelForce && !PeridigmNS::InfluenceFunction::isThreadSafe(PeridigmNS::InfluenceFunction::self().getInfluenceFunction()),
+                              "**** Error:  Thread Parallel Force Evaluation is not supported for user-defined influence functions that require the run-time compiler.\n");
+
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
   m_volumeFieldId                  = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR,      PeridigmField::CONSTANT, "Volume");
   m_damageFieldId                  = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR,      PeridigmField::TWO_STEP, "Damage");
@@ -99,6 +113,11 @@ PeridigmNS::ElasticMaterial::ElasticMaterial(const Teuchos::ParameterList& param
   if(m_computePartialStress){
     m_partialStressFieldId         = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::FULL_TENSOR, PeridigmField::TWO_STEP, "Partial_Stress");
   }
+  if(m_cacheBondGeometry){
+    m_bondReferenceLengthFieldId        = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Reference_Length");
+    m_bondInfluenceFunctionValueFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Influence_Function_Value");
+    m_bondNeighborVolumeFieldId         = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Bond_Neighbor_Volume");
+  }
 
   m_fieldIds.push_back(m_volumeFieldId);
   m_fieldIds.push_back(m_damageFieldId);
@@ -115,6 +134,11 @@ PeridigmNS::ElasticMaterial::ElasticMaterial(const Teuchos::ParameterList& param
   if(m_computePartialStress){
     m_fieldIds.push_back(m_partialStressFieldId);
   }
+  if(m_cacheBondGeometry){
+    m_fieldIds.push_back(m_bondReferenceLengthFieldId);
+    m_fieldIds.push_back(m_bondInfluenceFunctionValueFieldId);
+    m_fieldIds.push_back(m_bondNeighborVolumeFieldId);
+  }
 }
 
 PeridigmNS::ElasticMaterial::~ElasticMaterial()
@@ -134,8 +158,19 @@ PeridigmNS::ElasticMaterial::initialize(const double dt,
   dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolumeOverlap);
   dataManager.getData(m_weightedVolumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&weightedVolume);
 
-  MATERIAL_EVALUATION::computeWeightedVolume(xOverlap,cellVolumeOverlap,weightedVolume,numOwnedPoints,neighborhoodList,m_horizon);
+  m_influenceFunctionSelection = PeridigmNS::InfluenceFunction::Selection(m_OMEGA);
+
+  MATERIAL_EVALUATION::computeWeightedVolume(xOverlap,cellVolumeOverlap,weightedVolume,numOwnedPoints,neighborhoodList,m_horizon,m_influenceFunctionSelection);
 
+  // The reference bond geometry is constant, it is computed once here and travels with the bond data on rebalance
+  if(m_cacheBondGeometry){
+    double *bondReferenceLength, *bondInfluenceFunctionValue, *bondNeighborVolume;
+    dataManager.getData(m_bondReferenceLengthFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondReferenceLength);
+    dataManager.getData(m_bondInfluenceFunctionValueFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondInfluenceFunctionValue);
+    dataManager.getData(m_bondNeighborVolumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondNeighborVolume);
+    MATERIAL_EVALUATION::computeBondGeometry(xOverlap,cellVolumeOverlap,neighborhoodList,numOwnedPoints,m_horizon,m_OMEGA,
+                                             bondReferenceLength,0,bondInfluenceFunctionValue,bondNeighborVolume);
+  }
 }
 
 void
@@ -167,8 +202,46 @@ PeridigmNS::ElasticMaterial::computeForce(const double dt,
   if(m_computePartialStress)
     dataManager.getData(m_partialStressFieldId, PeridigmField::STEP_NP1)->ExtractView(&partialStress);
 
-  MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,cellVolume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
-  MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,y,weightedVolume,cellVolume,dilatation,bondDamage,force,partialStress,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+  MATERIAL_EVALUATION::BondGeometry bondGeometry;
+  MATERIAL_EVALUATION::BondGeometry* bondGeometryPtr = 0;
+  if(m_cacheBondGeometry){
+    double *bondReferenceLength, *bondInfluenceFunctionValue, *bondNeighborVolume;
+    dataManager.getData(m_bondReferenceLengthFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondReferenceLength);
+    dataManager.getData(m_bondInfluenceFunctionValueFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondInfluenceFunctionValue);
+    dataManager.getData(m_bondNeighborVolumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondNeighborVolume);
+    bondGeometry.referenceLength = bondReferenceLength;
+    bondGeometry.influenceFunctionValue = bondInfluenceFunctionValue;
+    bondGeometry.neighborVolume = bondNeighborVolume;
+    bondGeometryPtr = &bondGeometry;
+  }
+
+  int timerId = forceKernelTimerId();
+  PeridigmNS::Timer::self().startTimer(timerId);
+  bool structureOfArrays = !m_threadParallelForce && !m_computePartialStress &&
+    dataManager.hasStructureOfArraysData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE) &&
+    dataManager.hasStructureOfArraysData(m_coordinatesFieldId, PeridigmField::STEP_NP1) &&
+    dataManager.hasStructureOfArraysData(m_forceDensityFieldId, PeridigmField::STEP_NP1);
+  if(structureOfArrays){
+    // Vectorized kernels on the DataManager's structure-of-arrays copies; the force is copied back for export
+    int numOverlapPoints = dataManager.getOverlapScalarPointMap()->NumMyElements();
+    double* xSoA = dataManager.getStructureOfArraysData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    double* ySoA = dataManager.getStructureOfArraysData(m_coordinatesFieldId, PeridigmField::STEP_NP1);
+    double* forceSoA = dataManager.getStructureOfArraysData(m_forceDensityFieldId, PeridigmField::STEP_NP1);
+    std::fill(forceSoA, forceSoA + 3*numOverlapPoints, 0.0);
+    MATERIAL_EVALUATION::computeDilatationSoA(xSoA,ySoA,numOverlapPoints,weightedVolume,cellVolume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,m_influenceFunctionSelection,m_alpha,deltaTemperature,bondGeometryPtr);
+    MATERIAL_EVALUATION::computeInternalForceLinearElasticSoA(xSoA,ySoA,numOverlapPoints,weightedVolume,cellVolume,dilatation,bondDamage,forceSoA,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_influenceFunctionSelection,m_alpha,deltaTemperature,bondGeometryPtr);
+    dataManager.copyStructureOfArraysDataToField(m_forceDensityFieldId, PeridigmField::STEP_NP1);
+  }
+  else if(m_threadParallelForce){
+    int numOverlapPoints = dataManager.getOverlapScalarPointMap()->NumMyElements();
+    MATERIAL_EVALUATION::computeDilatationThreaded(x,y,weightedVolume,cellVolume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,m_influenceFunctionSelection,m_alpha,deltaTemperature,m_threadScratch,bondGeometryPtr);
+    MATERIAL_EVALUATION::computeInternalForceLinearElasticThreaded(x,y,weightedVolume,cellVolume,dilatation,bondDamage,force,partialStress,neighborhoodList,numOwnedPoints,numOverlapPoints,m_bulkModulus,m_shearModulus,m_horizon,m_influenceFunctionSelection,m_alpha,deltaTemperature,m_deterministicThreading,m_threadScratch,bondGeometryPtr);
+  }
+  else{
+    MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,cellVolume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,m_influenceFunctionSelection,m_alpha,deltaTemperature,bondGeometryPtr);
+    MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,y,weightedVolume,cellVolume,dilatation,bondDamage,force,partialStress,neighborhoodList,numOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_influenceFunctionSelection,m_alpha,deltaTemperature,bondGeometryPtr);
+  }
+  PeridigmNS::Timer::self().stopTimer(timerId);
 }
 
 void
@@ -244,7 +317,11 @@ PeridigmNS::ElasticMaterial::computeJacobian(const double dt,
                                              PeridigmNS::SerialMatrix& jacobian,
                                              PeridigmNS::Material::JacobianType jacobianType) const
 {
-  if(m_applyAutomaticDifferentiationJacobian){
+  if(m_applyAnalyticJacobian){
+    // Compute the Jacobian from the closed-form tangent
+    computeAnalyticJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, jacobianType);
+  }
+  else if(m_applyAutomaticDifferentiationJacobian){
     // Compute the Jacobian via automatic differentiation
     computeAutomaticDifferentiationJacobian(dt, numOwnedPoints, ownedIDs, neighborhoodList, dataManager, jacobian, jacobianType);  
   }
@@ -270,48 +347,25 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
   // current coordinates (independent variables).
   static vector<Sacado::Fad::DFad<double> > y_AD;
 
+  // The neighborhood workspace holds this material's fields; it is sized to the largest neighborhood once and refilled for each point.
+  jacobianWorkspace.allocate(numOwnedPoints, neighborhoodList, FieldIds());
+  PeridigmNS::DataManager& tempDataManager = jacobianWorkspace.getDataManager();
+
+  // There is only one owned ID, and it has local ID zero in the tempDataManager.
+  int tempNumOwnedPoints = 1;
+  const int* tempOwnedIDs = jacobianWorkspace.getOwnedIDs();
+  const int* tempNeighborhoodList = jacobianWorkspace.getNeighborhoodList();
+
   // Loop over all points.
   int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
 
-    // Create a temporary neighborhood consisting of a single point and its neighbors.
+    // Load the point and its neighbors into the workspace; the point itself has local ID zero.
     int numNeighbors = neighborhoodList[neighborhoodListIndex++];
     int numEntries = numNeighbors+1;
     int numDof = 3*numEntries;
-    vector<int> tempMyGlobalIDs(numEntries);
-    // Put the node at the center of the neighborhood at the beginning of the list.
-    tempMyGlobalIDs[0] = dataManager.getOwnedScalarPointMap()->GID(iID);
-    vector<int> tempNeighborhoodList(numEntries); 
-    tempNeighborhoodList[0] = numNeighbors;
-    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
-      int neighborID = neighborhoodList[neighborhoodListIndex++];
-      tempMyGlobalIDs[iNID+1] = dataManager.getOverlapScalarPointMap()->GID(neighborID);
-      tempNeighborhoodList[iNID+1] = iNID+1;
-    }
-
-    Epetra_SerialComm serialComm;
-    Teuchos::RCP<Epetra_BlockMap> tempOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numEntries, numEntries, &tempMyGlobalIDs[0], 1, 0, serialComm));
-    Teuchos::RCP<Epetra_BlockMap> tempThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numEntries, numEntries, &tempMyGlobalIDs[0], 3, 0, serialComm));
-    Teuchos::RCP<Epetra_BlockMap> tempBondMap = Teuchos::rcp(new Epetra_BlockMap(1, 1, &tempMyGlobalIDs[0], numNeighbors, 0, serialComm));
-
-    // Create a temporary DataManager containing data for this point and its neighborhood.
-    PeridigmNS::DataManager tempDataManager;
-    tempDataManager.setMaps(Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempOneDimensionalMap,
-                            Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempThreeDimensionalMap,
-                            tempBondMap);
-
-    // The temporary data manager will have the same field specs and data as the real data manager.
-    vector<int> fieldIds = dataManager.getFieldIds();
-    tempDataManager.allocateData(fieldIds);
-    tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
-
-    // Set up numOwnedPoints and ownedIDs.
-    // There is only one owned ID, and it has local ID zero in the tempDataManager.
-    int tempNumOwnedPoints = 1;
-    vector<int> tempOwnedIDs(tempNumOwnedPoints);
-    tempOwnedIDs[0] = 0;
+    jacobianWorkspace.fill(dataManager, iID, numNeighbors, &neighborhoodList[neighborhoodListIndex]);
+    neighborhoodListIndex += numNeighbors;
 
     // Use the scratchMatrix as sub-matrix for storing tangent values prior to loading them into the global tangent matrix.
     // Resize scratchMatrix if necessary
@@ -321,7 +375,7 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
     // Create a list of global indices for the rows/columns in the scratch matrix.
     vector<int> globalIndices(numDof);
     for(int i=0 ; i<numEntries ; ++i){
-      int globalID = tempOneDimensionalMap->GID(i);
+      int globalID = jacobianWorkspace.getGlobalIDs()[i];
       for(int j=0 ; j<3 ; ++j)
         globalIndices[3*i+j] = 3*globalID+j;
     }
@@ -357,8 +411,8 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
     }
 
     // Evaluate the constitutive model using the AD types
-    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],&tempNeighborhoodList[0],tempNumOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
-    MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,&y_AD[0],weightedVolume,cellVolume,&dilatation_AD[0],bondDamage,&force_AD[0],partialStress_AD_Ptr,&tempNeighborhoodList[0],tempNumOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],tempNeighborhoodList,tempNumOwnedPoints,m_horizon,m_influenceFunctionSelection,m_alpha,deltaTemperature);
+    MATERIAL_EVALUATION::computeInternalForceLinearElastic(x,&y_AD[0],weightedVolume,cellVolume,&dilatation_AD[0],bondDamage,&force_AD[0],partialStress_AD_Ptr,tempNeighborhoodList,tempNumOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_influenceFunctionSelection,m_alpha,deltaTemperature);
 
     // Load derivative values into scratch matrix
     // Multiply by volume along the way to convert force density to force
@@ -381,3 +435,172 @@ PeridigmNS::ElasticMaterial::computeAutomaticDifferentiationJacobian(const doubl
       TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Unknown Jacobian Type\n");
   }
 }
+
+void
+PeridigmNS::ElasticMaterial::computeAnalyticJacobian(const double dt,
+                                                     const int numOwnedPoints,
+                                                     const int* ownedIDs,
+                                                     const int* neighborhoodList,
+                                                     PeridigmNS::DataManager& dataManager,
+                                                     PeridigmNS::SerialMatrix& jacobian,
+                                                     PeridigmNS::Material::JacobianType jacobianType) const
+{
+  // Tangent of the forces computed by computeDilatation() and computeInternalForceLinearElastic(), evaluated
+  // on the block's own data one neighborhood at a time.  For the bond from point p to neighbor q, with
+  // M = (y_q - y_p)/|y_q - y_p|, the force density is f_pq = t_pq M and
+  //
+  //   d f_pq / d y_q = (1-d)^2 omega alpha M M^T + t_pq/|y_q - y_p| (I - M M^T) + h_q M (d theta / d y_q)^T,
+  //
+  // where h_q = (1-d) omega (3K/m - alpha/3) zeta; the last term couples every bond through the dilatation.
+
+  double *x, *y, *cellVolume, *weightedVolume, *bondDamage, *deltaTemperature;
+  dataManager.getData(m_modelCoordinatesFieldId, PeridigmField::STEP_NONE)->ExtractView(&x);
+  dataManager.getData(m_coordinatesFieldId, PeridigmField::STEP_NP1)->ExtractView(&y);
+  dataManager.getData(m_volumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&cellVolume);
+  dataManager.getData(m_weightedVolumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&weightedVolume);
+  dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondDamage);
+  deltaTemperature = NULL;
+  if(m_applyThermalStrains)
+    dataManager.getData(m_deltaTemperatureFieldId, PeridigmField::STEP_NP1)->ExtractView(&deltaTemperature);
+  double *bondReferenceLength(0), *bondInfluenceFunctionValue(0), *bondNeighborVolume(0);
+  if(m_cacheBondGeometry){
+    dataManager.getData(m_bondReferenceLengthFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondReferenceLength);
+    dataManager.getData(m_bondInfluenceFunctionValueFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondInfluenceFunctionValue);
+    dataManager.getData(m_bondNeighborVolumeFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondNeighborVolume);
+  }
+  const Epetra_BlockMap& ownedScalarPointMap = *dataManager.getOwnedScalarPointMap();
+  const Epetra_BlockMap& overlapScalarPointMap = *dataManager.getOverlapScalarPointMap();
+
+  // Per-bond quantities, reused across neighborhoods
+  vector<double> zeta, omega, V, dY, e, M, K, g, h;
+  vector<int> globalIndices;
+
+  int neighborhoodListIndex(0), bondIndex(0);
+  for(int iID=0 ; iID<numOwnedPoints ; ++iID){
+
+    int numNeighbors = neighborhoodList[neighborhoodListIndex++];
+    const int* neighbors = neighborhoodList + neighborhoodListIndex;
+    neighborhoodListIndex += numNeighbors;
+    const double* damage = bondDamage + bondIndex;
+    int numDof = 3*(numNeighbors+1);
+
+    // Rows and columns are ordered as the point itself, then its neighbors
+    globalIndices.resize(numDof);
+    int globalID = ownedScalarPointMap.GID(iID);
+    for(int j=0 ; j<3 ; ++j)
+      globalIndices[j] = 3*globalID+j;
+    for(int n=0 ; n<numNeighbors ; ++n){
+      globalID = overlapScalarPointMap.GID(neighbors[n]);
+      for(int j=0 ; j<3 ; ++j)
+        globalIndices[3*(n+1)+j] = 3*globalID+j;
+    }
+
+    double m = weightedVolume[iID];
+    double alpha = 15.0*m_shearModulus/m;
+    double beta = 3.0*m_bulkModulus/m - alpha/3.0;
+    double thermalStrain = deltaTemperature != NULL ? m_alpha*deltaTemperature[iID] : 0.0;
+    const double* Y = &y[3*iID];
+
+    // Bond directions, the dilatation, and its derivative (g M) with respect to the neighbor coordinates
+    zeta.resize(numNeighbors);
+    omega.resize(numNeighbors);
+    V.resize(numNeighbors);
+    dY.resize(numNeighbors);
+    e.resize(numNeighbors);
+    M.resize(3*numNeighbors);
+    K.resize(9*numNeighbors);
+    g.resize(numNeighbors);
+    h.resize(numNeighbors);
+    double theta = 0.0;
+    for(int n=0 ; n<numNeighbors ; ++n){
+      int q = neighbors[n];
+      if(m_cacheBondGeometry){
+        zeta[n] = bondReferenceLength[bondIndex+n];
+        omega[n] = bondInfluenceFunctionValue[bondIndex+n];
+        V[n] = bondNeighborVolume[bondIndex+n];
+      }
+      else{
+        zeta[n] = distance(x[3*iID], x[3*iID+1], x[3*iID+2], x[3*q], x[3*q+1], x[3*q+2]);
+        omega[n] = m_OMEGA(zeta[n], m_horizon);
+        V[n] = cellVolume[q];
+      }
+      dY[n] = distance(Y[0], Y[1], Y[2], y[3*q], y[3*q+1], y[3*q+2]);
+      for(int j=0 ; j<3 ; ++j)
+        M[3*n+j] = (y[3*q+j] - Y[j])/dY[n];
+      e[n] = dY[n] - zeta[n] - thermalStrain*zeta[n];
+      g[n] = 3.0*omega[n]*(1.0-damage[n])*zeta[n]*V[n]/m;
+      theta += g[n]*e[n];
+    }
+
+    // Direct bond stiffness K, coupling factor h, and the sums U = sum V h M and S = sum g M
+    double U[3] = {0.0, 0.0, 0.0}, S[3] = {0.0, 0.0, 0.0};
+    for(int n=0 ; n<numNeighbors ; ++n){
+      double oneMinusDamage = 1.0 - damage[n];
+      double t = oneMinusDamage*(omega[n]*theta*beta*zeta[n] + oneMinusDamage*omega[n]*alpha*e[n]);
+      double axial = oneMinusDamage*oneMinusDamage*omega[n]*alpha;
+      double transverse = t/dY[n];
+      const double* Mn = &M[3*n];
+      for(int i=0 ; i<3 ; ++i)
+        for(int j=0 ; j<3 ; ++j)
+          K[9*n+3*i+j] = (axial - transverse)*Mn[i]*Mn[j] + (i == j ? transverse : 0.0);
+      h[n] = oneMinusDamage*omega[n]*beta*zeta[n];
+      for(int j=0 ; j<3 ; ++j){
+        U[j] += V[n]*h[n]*Mn[j];
+        S[j] += g[n]*Mn[j];
+      }
+    }
+
+    if(scratchMatrix.Dimension() < numDof)
+      scratchMatrix.Resize(numDof);
+    for(int row=0 ; row<numDof ; ++row)
+      for(int col=0 ; col<numDof ; ++col)
+        scratchMatrix(row, col) = 0.0;
+
+    // Rows of the point itself:  V_p sum_q V_q f_pq
+    double selfVolume = cellVolume[iID];
+    for(int r=0 ; r<numNeighbors ; ++r){
+      const double* Mr = &M[3*r];
+      for(int i=0 ; i<3 ; ++i){
+        for(int j=0 ; j<3 ; ++j){
+          double value = selfVolume*(V[r]*K[9*r+3*i+j] + U[i]*g[r]*Mr[j]);
+          scratchMatrix(i, 3*(r+1)+j) += value;
+          scratchMatrix(i, j) -= value;
+        }
+      }
+    }
+
+    // Rows of the neighbors:  -V_p V_q f_pq
+    for(int q=0 ; q<numNeighbors ; ++q){
+      const double* Mq = &M[3*q];
+      double scale = selfVolume*V[q];
+      for(int i=0 ; i<3 ; ++i){
+        int row = 3*(q+1)+i;
+        for(int j=0 ; j<3 ; ++j){
+          scratchMatrix(row, 3*(q+1)+j) -= scale*K[9*q+3*i+j];
+          scratchMatrix(row, j) += scale*K[9*q+3*i+j];
+        }
+        for(int r=0 ; r<numNeighbors ; ++r){
+          const double* Mr = &M[3*r];
+          for(int j=0 ; j<3 ; ++j){
+            double value = scale*h[q]*Mq[i]*g[r]*Mr[j];
+            scratchMatrix(row, 3*(r+1)+j) -= value;
+            scratchMatrix(row, j) += value;
+          }
+        }
+      }
+    }
+
+    for(int row=0 ; row<numDof ; ++row)
+      for(int col=0 ; col<numDof ; ++col)
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(!std::isfinite(scratchMatrix(row, col)), "**** NaN detected in ElasticMaterial::computeAnalyticJacobian().\n");
+
+    if (jacobianType == PeridigmNS::Material::FULL_MATRIX)
+      jacobian.addValues(numDof, &globalIndices[0], scratchMatrix.Data());
+    else if (jacobianType == PeridigmNS::Material::BLOCK_DIAGONAL)
+      jacobian.addBlockDiagonalValues(numDof, &globalIndices[0], scratchMatrix.Data());
+    else // unknown jacobian type
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "**** Unknown Jacobian Type\n");
+
+    bondIndex += numNeighbors;
+  }
+}
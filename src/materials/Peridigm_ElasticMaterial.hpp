@@ -165,6 +165,16 @@ namespace PeridigmNS {
                                             PeridigmNS::SerialMatrix& jacobian,
                                             PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
 
+    //! Evaluate the jacobian from the closed-form tangent of the linear peridynamic solid.
+    virtual void
+    computeAnalyticJacobian(const double dt,
+                            const int numOwnedPoints,
+                            const int* ownedIDs,
+                            const int* neighborhoodList,
+                            PeridigmNS::DataManager& dataManager,
+                            PeridigmNS::SerialMatrix& jacobian,
+                            PeridigmNS::Material::JacobianType jacobianType = PeridigmNS::Material::FULL_MATRIX) const;
+
   protected:
 	
     //! Computes the distance between nodes (a1, a2, a3) and (b1, b2, b3).
@@ -181,9 +191,13 @@ namespace PeridigmNS {
     double m_alpha;
     double m_horizon;
     bool m_applyAutomaticDifferentiationJacobian;
+    bool m_applyAnalyticJacobian;
     bool m_applyThermalStrains;
     bool m_computePartialStress;
+    bool m_cacheBondGeometry;
     PeridigmNS::InfluenceFunction::functionPointer m_OMEGA;
+    //! m_OMEGA with its compile-time policy, resolved in initialize() and passed to the bond kernels
+    PeridigmNS::InfluenceFunction::Selection m_influenceFunctionSelection;
 
     // field spec ids for all relevant data
     std::vector<int> m_fieldIds;
@@ -198,6 +212,9 @@ namespace PeridigmNS {
     int m_bondDamageFieldId;
     int m_temperatureFieldId;
     int m_deltaTemperatureFieldId;
+    int m_bondReferenceLengthFieldId;
+    int m_bondInfluenceFunctionValueFieldId;
+    int m_bondNeighborVolumeFieldId;
   };
 }
 
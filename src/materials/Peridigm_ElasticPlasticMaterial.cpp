@@ -47,10 +47,10 @@
 
 #include "Peridigm_ElasticPlasticMaterial.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_Timer.hpp"
 #include "elastic_plastic.h"
 #include "material_utilities.h"
 #include <Teuchos_Assert.hpp>
-#include <Epetra_SerialComm.h>
 #include <Epetra_Vector.h>
 #include <Sacado.hpp>
 #include <limits>
@@ -82,6 +82,8 @@ PeridigmNS::ElasticPlasticMaterial::ElasticPlasticMaterial(const Teuchos::Parame
     m_thickness= params.get<double>("Thickness");
   }
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Thermal Expansion Coefficient"), "**** Error:  Thermal expansion is not currently supported for the Elastic Plastic material model.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(m_threadParallelForce && !PeridigmNS::InfluenceFunction::isThreadSafe(PeridigmNS::InfluenceFunction::self().getInfluenceFunction()),
+                              "**** Error:  Thread Parallel Force Evaluation is not supported for user-defined influence functions that require the run-time compiler.\n");
 
   if(m_disablePlasticity)
     m_yieldStress = std::numeric_limits<double>::max();
@@ -154,29 +156,64 @@ PeridigmNS::ElasticPlasticMaterial::computeForce(const double dt,
   // Zero out the force
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
-  MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,volume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon);
-  MATERIAL_EVALUATION::computeInternalForceIsotropicElasticPlastic
-     (
-       x,
-       y,
-       weightedVolume,
-       volume,
-       dilatation,
-       bondDamage,
-       edpN,
-       edpNP1,
-       lambdaN,
-       lambdaNP1,
-       force,
-       neighborhoodList,
-       numOwnedPoints,
-       m_bulkModulus,
-       m_shearModulus,
-       m_horizon,
-       m_yieldStress,
-       m_isPlanarProblem,
-       m_thickness
-    );
+  int timerId = forceKernelTimerId();
+  PeridigmNS::Timer::self().startTimer(timerId);
+  if(m_threadParallelForce){
+    int numOverlapPoints = dataManager.getOverlapScalarPointMap()->NumMyElements();
+    MATERIAL_EVALUATION::computeDilatationThreaded(x,y,weightedVolume,volume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon,
+                                                   PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),0.0,0,m_threadScratch);
+    MATERIAL_EVALUATION::computeInternalForceIsotropicElasticPlasticThreaded
+      (
+        x,
+        y,
+        weightedVolume,
+        volume,
+        dilatation,
+        bondDamage,
+        edpN,
+        edpNP1,
+        lambdaN,
+        lambdaNP1,
+        force,
+        neighborhoodList,
+        numOwnedPoints,
+        numOverlapPoints,
+        m_bulkModulus,
+        m_shearModulus,
+        m_horizon,
+        m_yieldStress,
+        m_isPlanarProblem,
+        m_thickness,
+        m_deterministicThreading,
+        m_threadScratch
+      );
+  }
+  else{
+    MATERIAL_EVALUATION::computeDilatation(x,y,weightedVolume,volume,bondDamage,dilatation,neighborhoodList,numOwnedPoints,m_horizon);
+    MATERIAL_EVALUATION::computeInternalForceIsotropicElasticPlastic
+      (
+        x,
+        y,
+        weightedVolume,
+        volume,
+        dilatation,
+        bondDamage,
+        edpN,
+        edpNP1,
+        lambdaN,
+        lambdaNP1,
+        force,
+        neighborhoodList,
+        numOwnedPoints,
+        m_bulkModulus,
+        m_shearModulus,
+        m_horizon,
+        m_yieldStress,
+        m_isPlanarProblem,
+        m_thickness
+      );
+  }
+  PeridigmNS::Timer::self().stopTimer(timerId);
 }
 
 void
@@ -213,47 +250,24 @@ PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobian(cons
   // current coordinates (independent variables).
   static vector<Sacado::Fad::DFad<double> > y_AD;
 
+  // The neighborhood workspace holds this material's fields; it is sized to the largest neighborhood once and refilled for each point.
+  jacobianWorkspace.allocate(numOwnedPoints, neighborhoodList, FieldIds());
+  PeridigmNS::DataManager& tempDataManager = jacobianWorkspace.getDataManager();
+
+  // There is only one owned ID, and it has local ID zero in the tempDataManager.
+  int tempNumOwnedPoints = 1;
+  const int* tempOwnedIDs = jacobianWorkspace.getOwnedIDs();
+  const int* tempNeighborhoodList = jacobianWorkspace.getNeighborhoodList();
+
   // Loop over all points.
   int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
-    // Create a temporary neighborhood consisting of a single point and its neighbors.
+    // Load the point and its neighbors into the workspace; the point itself has local ID zero.
     int numNeighbors = neighborhoodList[neighborhoodListIndex++];
     int numEntries = numNeighbors+1;
     int numDof = 3*numEntries;
-    vector<int> tempMyGlobalIDs(numEntries);
-    // Put the node at the center of the neighborhood at the beginning of the list.
-    tempMyGlobalIDs[0] = dataManager.getOwnedScalarPointMap()->GID(iID);
-    vector<int> tempNeighborhoodList(numEntries); 
-    tempNeighborhoodList[0] = numNeighbors;
-    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
-      int neighborID = neighborhoodList[neighborhoodListIndex++];
-      tempMyGlobalIDs[iNID+1] = dataManager.getOverlapScalarPointMap()->GID(neighborID);
-      tempNeighborhoodList[iNID+1] = iNID+1;
-    }
-
-    Epetra_SerialComm serialComm;
-    Teuchos::RCP<Epetra_BlockMap> tempOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numEntries, numEntries, &tempMyGlobalIDs[0], 1, 0, serialComm));
-    Teuchos::RCP<Epetra_BlockMap> tempThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numEntries, numEntries, &tempMyGlobalIDs[0], 3, 0, serialComm));
-    Teuchos::RCP<Epetra_BlockMap> tempBondMap = Teuchos::rcp(new Epetra_BlockMap(1, 1, &tempMyGlobalIDs[0], numNeighbors, 0, serialComm));
-
-    // Create a temporary DataManager containing data for this point and its neighborhood.
-    PeridigmNS::DataManager tempDataManager;
-    tempDataManager.setMaps(Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempOneDimensionalMap,
-                            Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempThreeDimensionalMap,
-                            tempBondMap);
-
-    // The temporary data manager will have the same fields and data as the real data manager.
-    vector<int> fieldIds = dataManager.getFieldIds();
-    tempDataManager.allocateData(fieldIds);
-    tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
-
-    // Set up numOwnedPoints and ownedIDs.
-    // There is only one owned ID, and it has local ID zero in the tempDataManager.
-    int tempNumOwnedPoints = 1;
-    vector<int> tempOwnedIDs(tempNumOwnedPoints);
-    tempOwnedIDs[0] = 0;
+    jacobianWorkspace.fill(dataManager, iID, numNeighbors, &neighborhoodList[neighborhoodListIndex]);
+    neighborhoodListIndex += numNeighbors;
 
     // Use the scratchMatrix as sub-matrix for storing tangent values prior to loading them into the global tangent matrix.
     // Resize scratchMatrix if necessary
@@ -263,7 +277,7 @@ PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobian(cons
     // Create a list of global indices for the rows/columns in the scratch matrix.
     vector<int> globalIndices(numDof);
     for(int i=0 ; i<numEntries ; ++i){
-      int globalID = tempOneDimensionalMap->GID(i);
+      int globalID = jacobianWorkspace.getGlobalIDs()[i];
       for(int j=0 ; j<3 ; ++j)
         globalIndices[3*i+j] = 3*globalID+j;
     }
@@ -290,12 +304,12 @@ PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobian(cons
     // Create vectors of empty AD types for the dependent variables
     vector<Sacado::Fad::DFad<double> > dilatation_AD(numEntries);
     vector<Sacado::Fad::DFad<double> > lambdaNP1_AD(numEntries);
-    int numBonds = tempDataManager.getData(m_deviatoricPlasticExtensionFieldId, PeridigmField::STEP_N)->MyLength();
+    int numBonds = numNeighbors;
     vector<Sacado::Fad::DFad<double> > edpNP1(numBonds);
     vector<Sacado::Fad::DFad<double> > force_AD(numDof);
 
     // Evaluate the constitutive model using the AD types
-    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],&tempNeighborhoodList[0],tempNumOwnedPoints,m_horizon);
+    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],tempNeighborhoodList,tempNumOwnedPoints,m_horizon);
     MATERIAL_EVALUATION::computeInternalForceIsotropicElasticPlastic
        (
          x,
@@ -309,7 +323,7 @@ PeridigmNS::ElasticPlasticMaterial::computeAutomaticDifferentiationJacobian(cons
          lambdaN,
          &lambdaNP1_AD[0],
          &force_AD[0],
-         &tempNeighborhoodList[0],
+         tempNeighborhoodList,
          tempNumOwnedPoints,
          m_bulkModulus,
          m_shearModulus,
@@ -128,7 +128,8 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::HypoelasticCorrespondenceMaterial
     m_bondLevelVelocityGradientZYFieldId(-1),
     m_bondLevelVelocityGradientZZFieldId(-1),
     m_nonhomogeneousIntegralFieldId(-1),
-    m_flyingPointFlagFieldId(-1)
+    m_flyingPointFlagFieldId(-1),
+    m_singlePrecisionBondLevelState(false)
 {
   //! \todo Add meaningful asserts on material properties.
   m_bulkModulus = calculateBulkModulus(params);
@@ -137,6 +138,9 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::HypoelasticCorrespondenceMaterial
 
   m_actualHorizon = params.get<double>("Actual Horizon");
 
+  if(params.isParameter("Single Precision Bond-Level State"))
+    m_singlePrecisionBondLevelState = params.get<bool>("Single Precision Bond-Level State");
+
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Apply Automatic Differentiation Jacobian"), "**** Error:  Automatic Differentiation is not supported for the ElasticHypoelasticCorrespondence material model.\n");
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Apply Shear Correction Factor"), "**** Error:  Shear Correction Factor is not supported for the ElasticHypoelasticCorrespondence material model.\n");
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Thermal Expansion Coefficient"), "**** Error:  Thermal expansion is not currently supported for the ElasticHypoelasticCorrespondence material model.\n");
@@ -192,15 +196,17 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::HypoelasticCorrespondenceMaterial
   m_bondLevelUnrotatedCauchyStressZXFieldId      = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Unrotated_Cauchy_Stress_ZX");
   m_bondLevelUnrotatedCauchyStressZYFieldId      = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Unrotated_Cauchy_Stress_ZY");
   m_bondLevelUnrotatedCauchyStressZZFieldId      = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Unrotated_Cauchy_Stress_ZZ");
-  m_bondLevelCauchyStressXXFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Cauchy_Stress_XX");
-  m_bondLevelCauchyStressXYFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Cauchy_Stress_XY");
-  m_bondLevelCauchyStressXZFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Cauchy_Stress_XZ");
-  m_bondLevelCauchyStressYXFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Cauchy_Stress_YX");
-  m_bondLevelCauchyStressYYFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Cauchy_Stress_YY");
-  m_bondLevelCauchyStressYZFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Cauchy_Stress_YZ");
-  m_bondLevelCauchyStressZXFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Cauchy_Stress_ZX");
-  m_bondLevelCauchyStressZYFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Cauchy_Stress_ZY");
-  m_bondLevelCauchyStressZZFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::TWO_STEP, "Cauchy_Stress_ZZ");
+  // The bond-level Cauchy stress is recomputed from the unrotated stress at
+  // every step and is never read at step N, so a single step is stored.
+  m_bondLevelCauchyStressXXFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Cauchy_Stress_XX");
+  m_bondLevelCauchyStressXYFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Cauchy_Stress_XY");
+  m_bondLevelCauchyStressXZFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Cauchy_Stress_XZ");
+  m_bondLevelCauchyStressYXFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Cauchy_Stress_YX");
+  m_bondLevelCauchyStressYYFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Cauchy_Stress_YY");
+  m_bondLevelCauchyStressYZFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Cauchy_Stress_YZ");
+  m_bondLevelCauchyStressZXFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Cauchy_Stress_ZX");
+  m_bondLevelCauchyStressZYFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Cauchy_Stress_ZY");
+  m_bondLevelCauchyStressZZFieldId               = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Cauchy_Stress_ZZ");
   m_bondLevelUnrotatedRateOfDeformationXXFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Unrotated_Rate_Of_Deformation_XX");
   m_bondLevelUnrotatedRateOfDeformationXYFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Unrotated_Rate_Of_Deformation_XY");
   m_bondLevelUnrotatedRateOfDeformationXZFieldId = fieldManager.getFieldId(PeridigmField::BOND, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Unrotated_Rate_Of_Deformation_XZ");
@@ -303,6 +309,33 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::~HypoelasticCorrespondenceMateria
 {
 }
 
+vector<int>
+PeridigmNS::HypoelasticCorrespondenceMaterial::SinglePrecisionFieldIds() const
+{
+  vector<int> singlePrecisionFieldIds;
+  if(!m_singlePrecisionBondLevelState)
+    return singlePrecisionFieldIds;
+  singlePrecisionFieldIds.push_back(m_bondLevelLeftStretchTensorXXFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelLeftStretchTensorXYFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelLeftStretchTensorXZFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelLeftStretchTensorYXFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelLeftStretchTensorYYFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelLeftStretchTensorYZFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelLeftStretchTensorZXFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelLeftStretchTensorZYFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelLeftStretchTensorZZFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelRotationTensorXXFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelRotationTensorXYFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelRotationTensorXZFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelRotationTensorYXFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelRotationTensorYYFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelRotationTensorYZFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelRotationTensorZXFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelRotationTensorZYFieldId);
+  singlePrecisionFieldIds.push_back(m_bondLevelRotationTensorZZFieldId);
+  return singlePrecisionFieldIds;
+}
+
 void
 PeridigmNS::HypoelasticCorrespondenceMaterial::initialize(const double dt,
                                                           const int numOwnedPoints,
@@ -363,15 +396,20 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::initialize(const double dt,
   dataManager.getData(m_bondLevelUnrotatedRateOfDeformationZYFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
   dataManager.getData(m_bondLevelUnrotatedRateOfDeformationZZFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
 
-  dataManager.getData(m_bondLevelLeftStretchTensorXXFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
-  dataManager.getData(m_bondLevelLeftStretchTensorXYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelLeftStretchTensorXZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelLeftStretchTensorYXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelLeftStretchTensorYYFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
-  dataManager.getData(m_bondLevelLeftStretchTensorYZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelLeftStretchTensorZXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelLeftStretchTensorZYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelLeftStretchTensorZZFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
+  // Single-precision step N values are not available through getData(), they are set below
+  bool singlePrecision = dataManager.hasSinglePrecisionData(m_bondLevelLeftStretchTensorXXFieldId);
+
+  if(!singlePrecision){
+    dataManager.getData(m_bondLevelLeftStretchTensorXXFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
+    dataManager.getData(m_bondLevelLeftStretchTensorXYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelLeftStretchTensorXZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelLeftStretchTensorYXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelLeftStretchTensorYYFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
+    dataManager.getData(m_bondLevelLeftStretchTensorYZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelLeftStretchTensorZXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelLeftStretchTensorZYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelLeftStretchTensorZZFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
+  }
 
   dataManager.getData(m_bondLevelLeftStretchTensorXXFieldId, PeridigmField::STEP_NP1)->PutScalar(1.0);
   dataManager.getData(m_bondLevelLeftStretchTensorXYFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
@@ -383,15 +421,17 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::initialize(const double dt,
   dataManager.getData(m_bondLevelLeftStretchTensorZYFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
   dataManager.getData(m_bondLevelLeftStretchTensorZZFieldId, PeridigmField::STEP_NP1)->PutScalar(1.0);
 
-  dataManager.getData(m_bondLevelRotationTensorXXFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
-  dataManager.getData(m_bondLevelRotationTensorXYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelRotationTensorXZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelRotationTensorYXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelRotationTensorYYFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
-  dataManager.getData(m_bondLevelRotationTensorYZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelRotationTensorZXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelRotationTensorZYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelRotationTensorZZFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
+  if(!singlePrecision){
+    dataManager.getData(m_bondLevelRotationTensorXXFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
+    dataManager.getData(m_bondLevelRotationTensorXYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelRotationTensorXZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelRotationTensorYXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelRotationTensorYYFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
+    dataManager.getData(m_bondLevelRotationTensorYZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelRotationTensorZXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelRotationTensorZYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
+    dataManager.getData(m_bondLevelRotationTensorZZFieldId, PeridigmField::STEP_N)->PutScalar(1.0);
+  }
 
   dataManager.getData(m_bondLevelRotationTensorXXFieldId, PeridigmField::STEP_NP1)->PutScalar(1.0);
   dataManager.getData(m_bondLevelRotationTensorXYFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
@@ -423,25 +463,15 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::initialize(const double dt,
   dataManager.getData(m_bondLevelUnrotatedCauchyStressZYFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
   dataManager.getData(m_bondLevelUnrotatedCauchyStressZZFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
-  dataManager.getData(m_bondLevelCauchyStressXXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressXYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressXZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressYXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressYYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressYZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressZXFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressZYFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressZZFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
-
-  dataManager.getData(m_bondLevelCauchyStressXXFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressXYFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressXZFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressYXFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressYYFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressYZFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressZXFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressZYFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
-  dataManager.getData(m_bondLevelCauchyStressZZFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+  dataManager.getData(m_bondLevelCauchyStressXXFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
+  dataManager.getData(m_bondLevelCauchyStressXYFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
+  dataManager.getData(m_bondLevelCauchyStressXZFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
+  dataManager.getData(m_bondLevelCauchyStressYXFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
+  dataManager.getData(m_bondLevelCauchyStressYYFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
+  dataManager.getData(m_bondLevelCauchyStressYZFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
+  dataManager.getData(m_bondLevelCauchyStressZXFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
+  dataManager.getData(m_bondLevelCauchyStressZYFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
+  dataManager.getData(m_bondLevelCauchyStressZZFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
 
   dataManager.getData(m_nonhomogeneousIntegralFieldId, PeridigmField::STEP_NONE)->PutScalar(0.0);
 
@@ -454,6 +484,13 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::initialize(const double dt,
   dataManager.getData(m_flyingPointFlagFieldId, PeridigmField::STEP_NP1)->PutScalar(-1.0);
   dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_N)->PutScalar(0.0);
   dataManager.getData(m_bondDamageFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
+
+  // The single-precision step N values of the bond-level left stretch and rotation are set from the step NP1 values
+  if(singlePrecision){
+    vector<int> singlePrecisionFieldIds = SinglePrecisionFieldIds();
+    for(unsigned int i=0 ; i<singlePrecisionFieldIds.size() ; ++i)
+      dataManager.copyFieldToSinglePrecisionData(singlePrecisionFieldIds[i]);
+  }
 }
 
 void
@@ -533,24 +570,6 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::computeForce(const double dt,
   double *bondLevelLeftStretchTensorZXN, *bondLevelLeftStretchTensorZXNP1, *bondLevelRotationTensorZXN, *bondLevelRotationTensorZXNP1, *bondLevelUnrotatedRateOfDeformationZX;
   double *bondLevelLeftStretchTensorZYN, *bondLevelLeftStretchTensorZYNP1, *bondLevelRotationTensorZYN, *bondLevelRotationTensorZYNP1, *bondLevelUnrotatedRateOfDeformationZY;
   double *bondLevelLeftStretchTensorZZN, *bondLevelLeftStretchTensorZZNP1, *bondLevelRotationTensorZZN, *bondLevelRotationTensorZZNP1, *bondLevelUnrotatedRateOfDeformationZZ;
-  dataManager.getData(m_bondLevelLeftStretchTensorXXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorXXN);
-  dataManager.getData(m_bondLevelLeftStretchTensorXYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorXYN);
-  dataManager.getData(m_bondLevelLeftStretchTensorXZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorXZN);
-  dataManager.getData(m_bondLevelLeftStretchTensorYXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorYXN);
-  dataManager.getData(m_bondLevelLeftStretchTensorYYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorYYN);
-  dataManager.getData(m_bondLevelLeftStretchTensorYZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorYZN);
-  dataManager.getData(m_bondLevelLeftStretchTensorZXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorZXN);
-  dataManager.getData(m_bondLevelLeftStretchTensorZYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorZYN);
-  dataManager.getData(m_bondLevelLeftStretchTensorZZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorZZN);
-  dataManager.getData(m_bondLevelRotationTensorXXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorXXN);
-  dataManager.getData(m_bondLevelRotationTensorXYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorXYN);
-  dataManager.getData(m_bondLevelRotationTensorXZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorXZN);
-  dataManager.getData(m_bondLevelRotationTensorYXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorYXN);
-  dataManager.getData(m_bondLevelRotationTensorYYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorYYN);
-  dataManager.getData(m_bondLevelRotationTensorYZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorYZN);
-  dataManager.getData(m_bondLevelRotationTensorZXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorZXN);
-  dataManager.getData(m_bondLevelRotationTensorZYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorZYN);
-  dataManager.getData(m_bondLevelRotationTensorZZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorZZN);
   dataManager.getData(m_bondLevelLeftStretchTensorXXFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelLeftStretchTensorXXNP1);
   dataManager.getData(m_bondLevelLeftStretchTensorXYFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelLeftStretchTensorXYNP1);
   dataManager.getData(m_bondLevelLeftStretchTensorXZFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelLeftStretchTensorXZNP1);
@@ -569,6 +588,55 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::computeForce(const double dt,
   dataManager.getData(m_bondLevelRotationTensorZXFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelRotationTensorZXNP1);
   dataManager.getData(m_bondLevelRotationTensorZYFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelRotationTensorZYNP1);
   dataManager.getData(m_bondLevelRotationTensorZZFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelRotationTensorZZNP1);
+
+  // With single-precision step N values, the step N values are copied into the step NP1 arrays,
+  // which the Flanagan-Taylor update below overwrites in place.  The finite-difference Jacobian
+  // evaluates the force on a double-precision copy of the neighborhood, so this is decided by
+  // the DataManager rather than by the material option.
+  bool singlePrecision = dataManager.hasSinglePrecisionData(m_bondLevelLeftStretchTensorXXFieldId);
+  if(singlePrecision){
+    vector<int> singlePrecisionFieldIds = SinglePrecisionFieldIds();
+    for(unsigned int i=0 ; i<singlePrecisionFieldIds.size() ; ++i)
+      dataManager.copySinglePrecisionDataToField(singlePrecisionFieldIds[i]);
+    bondLevelLeftStretchTensorXXN = bondLevelLeftStretchTensorXXNP1;
+    bondLevelLeftStretchTensorXYN = bondLevelLeftStretchTensorXYNP1;
+    bondLevelLeftStretchTensorXZN = bondLevelLeftStretchTensorXZNP1;
+    bondLevelLeftStretchTensorYXN = bondLevelLeftStretchTensorYXNP1;
+    bondLevelLeftStretchTensorYYN = bondLevelLeftStretchTensorYYNP1;
+    bondLevelLeftStretchTensorYZN = bondLevelLeftStretchTensorYZNP1;
+    bondLevelLeftStretchTensorZXN = bondLevelLeftStretchTensorZXNP1;
+    bondLevelLeftStretchTensorZYN = bondLevelLeftStretchTensorZYNP1;
+    bondLevelLeftStretchTensorZZN = bondLevelLeftStretchTensorZZNP1;
+    bondLevelRotationTensorXXN = bondLevelRotationTensorXXNP1;
+    bondLevelRotationTensorXYN = bondLevelRotationTensorXYNP1;
+    bondLevelRotationTensorXZN = bondLevelRotationTensorXZNP1;
+    bondLevelRotationTensorYXN = bondLevelRotationTensorYXNP1;
+    bondLevelRotationTensorYYN = bondLevelRotationTensorYYNP1;
+    bondLevelRotationTensorYZN = bondLevelRotationTensorYZNP1;
+    bondLevelRotationTensorZXN = bondLevelRotationTensorZXNP1;
+    bondLevelRotationTensorZYN = bondLevelRotationTensorZYNP1;
+    bondLevelRotationTensorZZN = bondLevelRotationTensorZZNP1;
+  }
+  else{
+    dataManager.getData(m_bondLevelLeftStretchTensorXXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorXXN);
+    dataManager.getData(m_bondLevelLeftStretchTensorXYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorXYN);
+    dataManager.getData(m_bondLevelLeftStretchTensorXZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorXZN);
+    dataManager.getData(m_bondLevelLeftStretchTensorYXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorYXN);
+    dataManager.getData(m_bondLevelLeftStretchTensorYYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorYYN);
+    dataManager.getData(m_bondLevelLeftStretchTensorYZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorYZN);
+    dataManager.getData(m_bondLevelLeftStretchTensorZXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorZXN);
+    dataManager.getData(m_bondLevelLeftStretchTensorZYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorZYN);
+    dataManager.getData(m_bondLevelLeftStretchTensorZZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelLeftStretchTensorZZN);
+    dataManager.getData(m_bondLevelRotationTensorXXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorXXN);
+    dataManager.getData(m_bondLevelRotationTensorXYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorXYN);
+    dataManager.getData(m_bondLevelRotationTensorXZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorXZN);
+    dataManager.getData(m_bondLevelRotationTensorYXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorYXN);
+    dataManager.getData(m_bondLevelRotationTensorYYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorYYN);
+    dataManager.getData(m_bondLevelRotationTensorYZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorYZN);
+    dataManager.getData(m_bondLevelRotationTensorZXFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorZXN);
+    dataManager.getData(m_bondLevelRotationTensorZYFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorZYN);
+    dataManager.getData(m_bondLevelRotationTensorZZFieldId, PeridigmField::STEP_N)->ExtractView(&bondLevelRotationTensorZZN);
+  }
   dataManager.getData(m_bondLevelUnrotatedRateOfDeformationXXFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelUnrotatedRateOfDeformationXX);
   dataManager.getData(m_bondLevelUnrotatedRateOfDeformationXYFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelUnrotatedRateOfDeformationXY);
   dataManager.getData(m_bondLevelUnrotatedRateOfDeformationXZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelUnrotatedRateOfDeformationXZ);
@@ -709,15 +777,15 @@ PeridigmNS::HypoelasticCorrespondenceMaterial::computeForce(const double dt,
   dataManager.getData(m_bondLevelUnrotatedCauchyStressZXFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelUnrotatedCauchyStressZXNP1);
   dataManager.getData(m_bondLevelUnrotatedCauchyStressZYFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelUnrotatedCauchyStressZYNP1);
   dataManager.getData(m_bondLevelUnrotatedCauchyStressZZFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelUnrotatedCauchyStressZZNP1);
-  dataManager.getData(m_bondLevelCauchyStressXXFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelCauchyStressXXNP1);
-  dataManager.getData(m_bondLevelCauchyStressXYFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelCauchyStressXYNP1);
-  dataManager.getData(m_bondLevelCauchyStressXZFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelCauchyStressXZNP1);
-  dataManager.getData(m_bondLevelCauchyStressYXFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelCauchyStressYXNP1);
-  dataManager.getData(m_bondLevelCauchyStressYYFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelCauchyStressYYNP1);
-  dataManager.getData(m_bondLevelCauchyStressYZFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelCauchyStressYZNP1);
-  dataManager.getData(m_bondLevelCauchyStressZXFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelCauchyStressZXNP1);
-  dataManager.getData(m_bondLevelCauchyStressZYFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelCauchyStressZYNP1);
-  dataManager.getData(m_bondLevelCauchyStressZZFieldId, PeridigmField::STEP_NP1)->ExtractView(&bondLevelCauchyStressZZNP1);
+  dataManager.getData(m_bondLevelCauchyStressXXFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelCauchyStressXXNP1);
+  dataManager.getData(m_bondLevelCauchyStressXYFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelCauchyStressXYNP1);
+  dataManager.getData(m_bondLevelCauchyStressXZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelCauchyStressXZNP1);
+  dataManager.getData(m_bondLevelCauchyStressYXFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelCauchyStressYXNP1);
+  dataManager.getData(m_bondLevelCauchyStressYYFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelCauchyStressYYNP1);
+  dataManager.getData(m_bondLevelCauchyStressYZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelCauchyStressYZNP1);
+  dataManager.getData(m_bondLevelCauchyStressZXFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelCauchyStressZXNP1);
+  dataManager.getData(m_bondLevelCauchyStressZYFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelCauchyStressZYNP1);
+  dataManager.getData(m_bondLevelCauchyStressZZFieldId, PeridigmField::STEP_NONE)->ExtractView(&bondLevelCauchyStressZZNP1);
 
   CORRESPONDENCE::rotateBondLevelCauchyStress(bondLevelRotationTensorXXNP1,
                                               bondLevelRotationTensorXYNP1,
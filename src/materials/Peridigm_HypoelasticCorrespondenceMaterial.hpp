@@ -77,6 +77,9 @@ namespace PeridigmNS {
     //! Returns a vector of field IDs corresponding to the variables associated with the material.
     virtual std::vector<int> FieldIds() const { return m_fieldIds; }
 
+    //! Returns the bond-level left stretch and rotation tensor field IDs if the "Single Precision Bond-Level State" option is set.
+    virtual std::vector<int> SinglePrecisionFieldIds() const;
+
     //! Initialize the material model.
     virtual void initialize(const double dt,
                             const int numOwnedPoints,
@@ -200,6 +203,9 @@ namespace PeridigmNS {
     int m_bondLevelVelocityGradientZZFieldId;
     int m_nonhomogeneousIntegralFieldId;
     int m_flyingPointFlagFieldId;
+
+    // store the step N values of the bond-level left stretch and rotation tensors in single precision
+    bool m_singlePrecisionBondLevelState;
   };
 }
 
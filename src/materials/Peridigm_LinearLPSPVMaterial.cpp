@@ -47,6 +47,7 @@
 
 #include "Peridigm_LinearLPSPVMaterial.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_Timer.hpp"
 #include "elastic_pv.h"     // for weighted volume
 #include "linear_lps_pv.h"  // for internal force
 #include "material_utilities.h"
@@ -324,6 +325,9 @@ PeridigmNS::LinearLPSPVMaterial::computeForce(const double dt,
   double u[3], uNeighbor[3], dotProduct, zeta[3], neighborWeight, volSelf, matVec[3], dyadicProduct[3][3];
   int numNeighbors, neighborId, neighborhoodListIndex(0), bondIndex(0);
 
+  int timerId = forceKernelTimerId();
+  PeridigmNS::Timer::self().startTimer(timerId);
+
   for(int i_pt=0; i_pt<numOwnedPoints; i_pt++){
     numNeighbors = neighborhoodList[neighborhoodListIndex++];
     xSelf = &x[3*i_pt];
@@ -391,4 +395,5 @@ PeridigmNS::LinearLPSPVMaterial::computeForce(const double dt,
       bondIndex += 1;
     }
   }
+  PeridigmNS::Timer::self().stopTimer(timerId);
 }
@@ -49,7 +49,6 @@
 #include "Peridigm_Field.hpp"
 #include "Peridigm_DegreesOfFreedomManager.hpp"
 #include <Teuchos_Assert.hpp>
-#include <Epetra_SerialComm.h>
 #include <cmath>
 #include <correspondence.h> // For the semi-Lagrangian (Hypoelastic) models
 
@@ -125,82 +124,68 @@ void PeridigmNS::Material::computeFiniteDifferenceJacobian(const double dt,
     fluxDivergenceFId = fieldManager.getFieldId("Flux_Divergence");
   }
 
+  // The neighborhood workspace holds the fields of the material plus the degrees of freedom and their residuals.
+  // It is sized to the largest neighborhood once and refilled for each point.
+  vector<int> workspaceFieldIds = FieldIds();
+  workspaceFieldIds.push_back(volumeFId);
+  if (solveForDisplacement) {
+    workspaceFieldIds.push_back(coordinatesFId);
+    workspaceFieldIds.push_back(velocityFId);
+    workspaceFieldIds.push_back(forceDensityFId);
+  }
+  if (solveForTemperature) {
+    workspaceFieldIds.push_back(temperatureFId);
+    workspaceFieldIds.push_back(fluxDivergenceFId);
+  }
+  jacobianWorkspace.allocate(numOwnedPoints, neighborhoodList, workspaceFieldIds);
+  PeridigmNS::DataManager& tempDataManager = jacobianWorkspace.getDataManager();
+
+  // There is only one owned ID, and it has local ID zero in the tempDataManager.
+  int tempNumOwnedPoints = 1;
+  const int* tempOwnedIDs = jacobianWorkspace.getOwnedIDs();
+  const int* tempNeighborhoodList = jacobianWorkspace.getNeighborhoodList();
+
+  // Extract pointers to the underlying data, these do not change from point to point.
+  double *volume, *y, *v, *force, *temperature, *fluxDivergence;
+  int forceLength(0), fluxDivergenceLength(0);
+  tempDataManager.getData(volumeFId, PeridigmField::STEP_NONE)->ExtractView(&volume);
+  if (solveForDisplacement) {
+    tempDataManager.getData(coordinatesFId, PeridigmField::STEP_NP1)->ExtractView(&y);
+    tempDataManager.getData(velocityFId, PeridigmField::STEP_NP1)->ExtractView(&v);
+    tempDataManager.getData(forceDensityFId, PeridigmField::STEP_NP1)->ExtractView(&force);
+    forceLength = tempDataManager.getData(forceDensityFId, PeridigmField::STEP_NP1)->MyLength();
+  }
+  if (solveForTemperature) {
+    tempDataManager.getData(temperatureFId, PeridigmField::STEP_NP1)->ExtractView(&temperature);
+    tempDataManager.getData(fluxDivergenceFId, PeridigmField::STEP_NP1)->ExtractView(&fluxDivergence);
+    fluxDivergenceLength = tempDataManager.getData(fluxDivergenceFId, PeridigmField::STEP_NP1)->MyLength();
+  }
+
+  // Storage for the unperturbed (forward difference) or negatively perturbed (central difference) force and/or flux divergence.
+  vector<double> tempForceVector(forceLength), tempFluxDivergenceVector(fluxDivergenceLength);
+  double* tempForce = forceLength > 0 ? &tempForceVector[0] : 0;
+  double* tempFluxDivergence = fluxDivergenceLength > 0 ? &tempFluxDivergenceVector[0] : 0;
+  vector<int> globalIndices;
+
   int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
 
-    // Create a temporary neighborhood consisting of a single point and its neighbors.
+    // Load the point and its neighbors into the workspace; the point itself has local ID zero.
     int numNeighbors = neighborhoodList[neighborhoodListIndex++];
-    vector<int> tempMyGlobalIDs(numNeighbors+1);
-    // Put the node at the center of the neighborhood at the beginning of the list.
-    tempMyGlobalIDs[0] = dataManager.getOwnedScalarPointMap()->GID(iID);
-    vector<int> tempNeighborhoodList(numNeighbors+1);
-    tempNeighborhoodList[0] = numNeighbors;
-    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
-      int neighborID = neighborhoodList[neighborhoodListIndex++];
-      tempMyGlobalIDs[iNID+1] = dataManager.getOverlapScalarPointMap()->GID(neighborID);
-      tempNeighborhoodList[iNID+1] = iNID+1;
-    }
-
-    Epetra_SerialComm serialComm;
-    Teuchos::RCP<Epetra_BlockMap> tempOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numNeighbors+1, numNeighbors+1, &tempMyGlobalIDs[0], 1, 0, serialComm));
-    Teuchos::RCP<Epetra_BlockMap> tempThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numNeighbors+1, numNeighbors+1, &tempMyGlobalIDs[0], 3, 0, serialComm));
-    Teuchos::RCP<Epetra_BlockMap> tempBondMap = Teuchos::rcp(new Epetra_BlockMap(1, 1, &tempMyGlobalIDs[0], numNeighbors, 0, serialComm));
-
-    // Create a temporary DataManager containing data for this point and its neighborhood.
-    PeridigmNS::DataManager tempDataManager;
-    tempDataManager.setMaps(Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempOneDimensionalMap,
-                            Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempThreeDimensionalMap,
-                            tempBondMap);
-
-    // The temporary data manager will have the same fields and data as the real data manager.
-    vector<int> fieldIds = dataManager.getFieldIds();
-    tempDataManager.allocateData(fieldIds);
-    tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
-
-    // Set up numOwnedPoints and ownedIDs.
-    // There is only one owned ID, and it has local ID zero in the tempDataManager.
-    int tempNumOwnedPoints = 1;
-    vector<int> tempOwnedIDs(1);
-    tempOwnedIDs[0] = 0;
-
-    // Extract pointers to the underlying data.
-    double *volume, *y, *v, *force, *temperature, *fluxDivergence;
-    tempDataManager.getData(volumeFId, PeridigmField::STEP_NONE)->ExtractView(&volume);
-    if (solveForDisplacement) {
-      tempDataManager.getData(coordinatesFId, PeridigmField::STEP_NP1)->ExtractView(&y);
-      tempDataManager.getData(velocityFId, PeridigmField::STEP_NP1)->ExtractView(&v);
-      tempDataManager.getData(forceDensityFId, PeridigmField::STEP_NP1)->ExtractView(&force);
-    }
-    if (solveForTemperature) {
-      tempDataManager.getData(temperatureFId, PeridigmField::STEP_NP1)->ExtractView(&temperature);
-      tempDataManager.getData(fluxDivergenceFId, PeridigmField::STEP_NP1)->ExtractView(&fluxDivergence);
-    }
-
-    // Create a temporary vector for storing force and/or flux divergence.
-    Teuchos::RCP<Epetra_Vector> forceVector, tempForceVector, fluxDivergenceVector, tempFluxDivergenceVector;
-    double *tempForce, *tempFluxDivergence;
-    if (solveForDisplacement) {
-      forceVector = tempDataManager.getData(forceDensityFId, PeridigmField::STEP_NP1);
-      tempForceVector = Teuchos::rcp(new Epetra_Vector(*forceVector));
-      tempForceVector->ExtractView(&tempForce);
-    }
-    if (solveForTemperature) {
-      fluxDivergenceVector = tempDataManager.getData(fluxDivergenceFId, PeridigmField::STEP_NP1);
-      tempFluxDivergenceVector = Teuchos::rcp(new Epetra_Vector(*fluxDivergenceVector));
-      tempFluxDivergenceVector->ExtractView(&tempFluxDivergence);
-    }
+    jacobianWorkspace.fill(dataManager, iID, numNeighbors, &neighborhoodList[neighborhoodListIndex]);
+    neighborhoodListIndex += numNeighbors;
+    int numPoints = numNeighbors+1;
 
     // Use the scratchMatrix as sub-matrix for storing tangent values prior to loading them into the global tangent matrix.
     // Resize scratchMatrix if necessary
-    if(scratchMatrix.Dimension() < numDof*(numNeighbors+1))
-      scratchMatrix.Resize(numDof*(numNeighbors+1));
+    if(scratchMatrix.Dimension() < numDof*numPoints)
+      scratchMatrix.Resize(numDof*numPoints);
 
     // Create a list of global indices for the rows/columns in the scratch matrix.
-    vector<int> globalIndices(numDof*(numNeighbors+1));
-    for(int i=0 ; i<numNeighbors+1 ; ++i){
-      int globalID = tempOneDimensionalMap->GID(i);
+    globalIndices.resize(numDof*numPoints);
+    const int* tempMyGlobalIDs = jacobianWorkspace.getGlobalIDs();
+    for(int i=0 ; i<numPoints ; ++i){
+      int globalID = tempMyGlobalIDs[i];
       for(int j=0 ; j<numDof ; ++j){
         globalIndices[numDof*i+j] = numDof*globalID+j;
       }
@@ -209,14 +194,14 @@ void PeridigmNS::Material::computeFiniteDifferenceJacobian(const double dt,
     if(finiteDifferenceScheme == FORWARD_DIFFERENCE){
       if (solveForDisplacement) {
         // Compute and store the unperturbed force.
-        computeForce(dt, tempNumOwnedPoints, &tempOwnedIDs[0], &tempNeighborhoodList[0], tempDataManager);
-        for(int i=0 ; i<forceVector->MyLength() ; ++i)
+        computeForce(dt, tempNumOwnedPoints, tempOwnedIDs, tempNeighborhoodList, tempDataManager);
+        for(int i=0 ; i<forceLength ; ++i)
           tempForce[i] = force[i];
       }
       if (solveForTemperature) {
         // Compute and store the unperturbed flux divergence.
-        computeFluxDivergence(dt, tempNumOwnedPoints, &tempOwnedIDs[0], &tempNeighborhoodList[0], tempDataManager);
-        for(int i=0 ; i<fluxDivergenceVector->MyLength() ; ++i)
+        computeFluxDivergence(dt, tempNumOwnedPoints, tempOwnedIDs, tempNeighborhoodList, tempDataManager);
+        for(int i=0 ; i<fluxDivergenceLength ; ++i)
           tempFluxDivergence[i] = fluxDivergence[i];
       }
     }
@@ -242,17 +227,17 @@ void PeridigmNS::Material::computeFiniteDifferenceJacobian(const double dt,
           // Compute and store the negatively perturbed force.
           y[numDof*perturbID+dof] -= epsilon;
           v[numDof*perturbID+dof] -= epsilon/dt;
-          computeForce(dt, tempNumOwnedPoints, &tempOwnedIDs[0], &tempNeighborhoodList[0], tempDataManager);
+          computeForce(dt, tempNumOwnedPoints, tempOwnedIDs, tempNeighborhoodList, tempDataManager);
           y[numDof*perturbID+dof] = oldY;
           v[numDof*perturbID+dof] = oldV;
-          for(int i=0 ; i<forceVector->MyLength() ; ++i)
+          for(int i=0 ; i<forceLength ; ++i)
             tempForce[i] = force[i];
         }
 
         // Compute the purturbed force.
         y[numDof*perturbID+dof] += epsilon;
         v[numDof*perturbID+dof] += epsilon/dt;
-        computeForce(dt, tempNumOwnedPoints, &tempOwnedIDs[0], &tempNeighborhoodList[0], tempDataManager);
+        computeForce(dt, tempNumOwnedPoints, tempOwnedIDs, tempNeighborhoodList, tempDataManager);
         y[numDof*perturbID+dof] = oldY;
         v[numDof*perturbID+dof] = oldV;
 
@@ -281,15 +266,15 @@ void PeridigmNS::Material::computeFiniteDifferenceJacobian(const double dt,
         if(finiteDifferenceScheme == CENTRAL_DIFFERENCE){
           // Compute and store the negatively perturbed flux divergence.
           temperature[perturbID] -= epsilon;
-          computeFluxDivergence(dt, tempNumOwnedPoints, &tempOwnedIDs[0], &tempNeighborhoodList[0], tempDataManager);
+          computeFluxDivergence(dt, tempNumOwnedPoints, tempOwnedIDs, tempNeighborhoodList, tempDataManager);
           temperature[perturbID] = oldTemperature;
-          for(int i=0 ; i<fluxDivergenceVector->MyLength() ; ++i)
+          for(int i=0 ; i<fluxDivergenceLength ; ++i)
             tempFluxDivergence[i] = fluxDivergence[i];
         }
 
         // Compute the purturbed flux divergence.
         temperature[perturbID] += epsilon;
-        computeFluxDivergence(dt, tempNumOwnedPoints, &tempOwnedIDs[0], &tempNeighborhoodList[0], tempDataManager);
+        computeFluxDivergence(dt, tempNumOwnedPoints, tempOwnedIDs, tempNeighborhoodList, tempDataManager);
         temperature[perturbID] = oldTemperature;
 
         for(int i=0 ; i<numNeighbors+1 ; ++i){
@@ -54,11 +54,15 @@
 #include <Epetra_Map.h>
 #include <vector>
 #include <string>
+#include <sstream>
 #include <float.h>
 #include "Peridigm_DataManager.hpp"
 #include "Peridigm_SerialMatrix.hpp"
 #include "Peridigm_ScratchMatrix.hpp"
+#include "Peridigm_NeighborhoodWorkspace.hpp"
 #include "Peridigm_BoundaryAndInitialConditionManager.hpp"
+#include "Peridigm_Timer.hpp"
+#include "thread_parallel.h"
 
 namespace PeridigmNS {
 
@@ -68,9 +72,13 @@ namespace PeridigmNS {
   public:
 
     //! Standard constructor.
-    Material(const Teuchos::ParameterList & params) : m_finiteDifferenceProbeLength(DBL_MAX) {
+    Material(const Teuchos::ParameterList & params) : m_finiteDifferenceProbeLength(DBL_MAX), m_threadParallelForce(false), m_deterministicThreading(true), m_forceKernelTimerId(-1) {
       if(params.isParameter("Finite Difference Probe Length"))
       m_finiteDifferenceProbeLength = params.get<double>("Finite Difference Probe Length");
+      if(params.isParameter("Thread Parallel Force Evaluation"))
+        m_threadParallelForce = params.get<bool>("Thread Parallel Force Evaluation");
+      if(params.isParameter("Deterministic Threading"))
+        m_deterministicThreading = params.get<bool>("Deterministic Threading");
     }
 
     //! Destructor.
@@ -104,6 +112,12 @@ namespace PeridigmNS {
     //! Returns a vector of field IDs corresponding to the variables associated with the material.
     virtual std::vector<int> FieldIds() const = 0;
 
+    //! Returns a vector of two-step bond field IDs whose step N values are stored in single precision, see DataManager::setSinglePrecisionFieldIds().
+    virtual std::vector<int> SinglePrecisionFieldIds() const {
+      std::vector<int> empty;
+      return empty;
+    }
+
     //! Returns a vector of field IDs that need to be synchronized across block boundaries and MPI boundaries after initialize().
     virtual std::vector<int> FieldIdsForSynchronizationAfterInitialize() const {
       std::vector<int> empty;
@@ -140,6 +154,12 @@ namespace PeridigmNS {
                  const int* neighborhoodList,
                  PeridigmNS::DataManager& dataManager) const {};
 
+    //! Provides the CSR row offsets (NeighborhoodData::RowOffsets()) of the neighborhood list passed to computeForce(), so that the thread-parallel kernels do not recompute them; pass null to clear.
+    void setNeighborhoodRowOffsets(const int* neighborhoodList, const int* rowOffsets) const {
+      m_threadScratch.rowOffsetsList = neighborhoodList;
+      m_threadScratch.rowOffsets = rowOffsets;
+    }
+
     //! Compute the divergence of the flux (for diffusion models).
     virtual void
     computeFluxDivergence(const double dt,
@@ -227,11 +247,37 @@ namespace PeridigmNS {
     //! Scratch matrix.
     mutable ScratchMatrix scratchMatrix;
 
+    //! Single-neighborhood copy of the block data used by the Jacobian evaluations, allocated once per block and refilled for each point.
+    mutable NeighborhoodWorkspace jacobianWorkspace;
+
     //! Finite-difference probe length
     double m_finiteDifferenceProbeLength;
 
+    //! Flag for evaluating the internal force with the thread-parallel kernels (materials that provide them).
+    bool m_threadParallelForce;
+
+    //! Flag for one statically scheduled partition per thread; if false, four dynamically scheduled partitions per thread are used.
+    bool m_deterministicThreading;
+
+    //! Scratch storage for the thread-parallel kernels.
+    mutable MATERIAL_EVALUATION::ThreadScratch m_threadScratch;
+
+    //! Timer id for the force kernel; the label includes the thread count so that runs can be compared.
+    int forceKernelTimerId() const {
+      if(m_forceKernelTimerId < 0){
+        int numThreads = m_threadParallelForce ? MATERIAL_EVALUATION::getNumKernelThreads() : 1;
+        std::stringstream ss;
+        ss << "Force Kernel: " << Name() << " (" << numThreads << (numThreads == 1 ? " thread)" : " threads)");
+        m_forceKernelTimerId = PeridigmNS::Timer::self().timerId(ss.str());
+      }
+      return m_forceKernelTimerId;
+    }
+
   private:
 
+    //! Timer id for the force kernel, set on the first call to forceKernelTimerId().
+    mutable int m_forceKernelTimerId;
+
     //! Default constructor with no arguments, private to prevent use.
     Material(){}
   };
@@ -51,7 +51,6 @@
 #include "nonlocal_diffusion.h"
 #include "material_utilities.h"
 #include <Teuchos_Assert.hpp>
-#include <Epetra_SerialComm.h>
 #include <Sacado.hpp>
 #include <cmath>
 
@@ -365,50 +364,26 @@ PeridigmNS::MultiphysicsElasticMaterial::computeAutomaticDifferentiationJacobian
   static vector<Sacado::Fad::DFad<double> > y_AD;
 	static vector<Sacado::Fad::DFad<double> > fPY_AD;
 
+  // The neighborhood workspace holds this material's fields; it is sized to the largest neighborhood once and refilled for each point.
+  jacobianWorkspace.allocate(numOwnedPoints, neighborhoodList, FieldIds());
+  PeridigmNS::DataManager& tempDataManager = jacobianWorkspace.getDataManager();
+
+  // There is only one owned ID, and it has local ID zero in the tempDataManager.
+  int tempNumOwnedPoints = 1;
+  const int* tempOwnedIDs = jacobianWorkspace.getOwnedIDs();
+  const int* tempNeighborhoodList = jacobianWorkspace.getNeighborhoodList();
+
   // Loop over all points.
   int neighborhoodListIndex = 0;
   for(int iID=0 ; iID<numOwnedPoints ; ++iID){
 
-    // Create a temporary neighborhood consisting of a single point and its neighbors.
+    // Load the point and its neighbors into the workspace; the point itself has local ID zero.
     int numNeighbors = neighborhoodList[neighborhoodListIndex++];
     int numEntries = numNeighbors+1;
 		int dofPerNode = 4;
     int numTotalNeighborhoodDof = dofPerNode*numEntries;
-    vector<int> tempMyGlobalIDs(numEntries);
-    // Put the node at the center of the neighborhood at the beginning of the list.
-    tempMyGlobalIDs[0] = dataManager.getOwnedScalarPointMap()->GID(iID);
-    vector<int> tempNeighborhoodList(numEntries);
-    tempNeighborhoodList[0] = numNeighbors;
-    for(int iNID=0 ; iNID<numNeighbors ; ++iNID){
-      int neighborID = neighborhoodList[neighborhoodListIndex++];
-      tempMyGlobalIDs[iNID+1] = dataManager.getOverlapScalarPointMap()->GID(neighborID);
-      tempNeighborhoodList[iNID+1] = iNID+1;
-    }
-
-    Epetra_SerialComm serialComm;
-    Teuchos::RCP<Epetra_BlockMap> tempOneDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numEntries, numEntries, &tempMyGlobalIDs[0], 1, 0, serialComm));
-		// This is not a mistake, the material is indeed defined in terms of one dimensional and three dimensional variables.
-    Teuchos::RCP<Epetra_BlockMap> tempThreeDimensionalMap = Teuchos::rcp(new Epetra_BlockMap(numEntries, numEntries, &tempMyGlobalIDs[0], 3, 0, serialComm));
-    Teuchos::RCP<Epetra_BlockMap> tempBondMap = Teuchos::rcp(new Epetra_BlockMap(1, 1, &tempMyGlobalIDs[0], numNeighbors, 0, serialComm));
-
-    // Create a temporary DataManager containing data for this point and its neighborhood.
-    PeridigmNS::DataManager tempDataManager;
-    tempDataManager.setMaps(Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempOneDimensionalMap,
-                            Teuchos::RCP<const Epetra_BlockMap>(),
-                            tempThreeDimensionalMap,
-                            tempBondMap);
-
-    // The temporary data manager will have the same field specs and data as the real data manager.
-    vector<int> fieldIds = dataManager.getFieldIds();
-    tempDataManager.allocateData(fieldIds);
-    tempDataManager.copyLocallyOwnedDataFromDataManager(dataManager);
-
-    // Set up numOwnedPoints and ownedIDs.
-    // There is only one owned ID, and it has local ID zero in the tempDataManager.
-    int tempNumOwnedPoints = 1;
-    vector<int> tempOwnedIDs(tempNumOwnedPoints);
-    tempOwnedIDs[0] = 0;
+    jacobianWorkspace.fill(dataManager, iID, numNeighbors, &neighborhoodList[neighborhoodListIndex]);
+    neighborhoodListIndex += numNeighbors;
 
     // Use the scratchMatrix as sub-matrix for storing tangent values prior to loading them into the global tangent matrix.
     // Resize scratchMatrix if necessary
@@ -418,7 +393,7 @@ PeridigmNS::MultiphysicsElasticMaterial::computeAutomaticDifferentiationJacobian
     // Create a list of global indices for the rows/columns in the scratch matrix.
     vector<int> globalIndices(numTotalNeighborhoodDof);
     for(int i=0 ; i<numEntries ; ++i){
-      int globalID = tempOneDimensionalMap->GID(i);
+      int globalID = jacobianWorkspace.getGlobalIDs()[i];
       for(int j=0 ; j<dofPerNode ; ++j)
         globalIndices[dofPerNode*i+j] = dofPerNode*globalID+j;
     }
@@ -467,10 +442,10 @@ PeridigmNS::MultiphysicsElasticMaterial::computeAutomaticDifferentiationJacobian
 
 		// Compute derivatives with respect to y alone
     // Evaluate the constitutive model using the AD types
-    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],&tempNeighborhoodList[0],tempNumOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
-    MATERIAL_EVALUATION::computeInternalForceLinearElasticCoupled(x,&y_AD[0],&fPY_AD[0],weightedVolume,cellVolume,&dilatation_AD[0],bondDamage,scf,&force_AD[0],&tempNeighborhoodList[0],tempNumOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
+    MATERIAL_EVALUATION::computeDilatation(x,&y_AD[0],weightedVolume,cellVolume,bondDamage,&dilatation_AD[0],tempNeighborhoodList,tempNumOwnedPoints,m_horizon,m_OMEGA,m_alpha,deltaTemperature);
+    MATERIAL_EVALUATION::computeInternalForceLinearElasticCoupled(x,&y_AD[0],&fPY_AD[0],weightedVolume,cellVolume,&dilatation_AD[0],bondDamage,scf,&force_AD[0],tempNeighborhoodList,tempNumOwnedPoints,m_bulkModulus,m_shearModulus,m_horizon,m_alpha,deltaTemperature);
 
-		MATERIAL_EVALUATION::computeInternalFluidFlow(x,&y_AD[0],&fPY_AD[0],cellVolume,bondDamage,&fluidFlow_AD[0],&tempNeighborhoodList[0],tempNumOwnedPoints,
+		MATERIAL_EVALUATION::computeInternalFluidFlow(x,&y_AD[0],&fPY_AD[0],cellVolume,bondDamage,&fluidFlow_AD[0],tempNeighborhoodList,tempNumOwnedPoints,
 m_fluidPermeabilityScalar, m_fluidPermeabilityScalar,
 m_fluidDensity,m_fluidDynamicViscosity,
 m_permeabilityCurveInflectionDamage, m_permeabilityAlpha,
@@ -47,6 +47,7 @@
 
 #include "Peridigm_ViscoelasticMaterial.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_Timer.hpp"
 #include "viscoelastic.h"
 #include "material_utilities.h"
 #include <Teuchos_Assert.hpp>
@@ -71,6 +72,8 @@ PeridigmNS::ViscoelasticMaterial::ViscoelasticMaterial(const Teuchos::ParameterL
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Apply Automatic Differentiation Jacobian"), "**** Error:  Automatic Differentiation is not supported for the Viscoelastic material model.\n");
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Apply Shear Correction Factor"), "**** Error:  Shear Correction Factor is not supported for the Viscoelastic material model.\n");
   TEUCHOS_TEST_FOR_EXCEPT_MSG(params.isParameter("Thermal Expansion Coefficient"), "**** Error:  Thermal expansion is not currently supported for the Viscoelastic material model.\n");
+  TEUCHOS_TEST_FOR_EXCEPT_MSG(m_threadParallelForce && !PeridigmNS::InfluenceFunction::isThreadSafe(PeridigmNS::InfluenceFunction::self().getInfluenceFunction()),
+                              "**** Error:  Thread Parallel Force Evaluation is not supported for user-defined influence functions that require the run-time compiler.\n");
 
   PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
   m_volumeFieldId                      = fieldManager.getFieldId(PeridigmField::ELEMENT, PeridigmField::SCALAR, PeridigmField::CONSTANT, "Volume");
@@ -134,24 +137,55 @@ PeridigmNS::ViscoelasticMaterial::computeForce(const double dt,
 
   dataManager.getData(m_forceDensityFieldId, PeridigmField::STEP_NP1)->PutScalar(0.0);
 
-  MATERIAL_EVALUATION::computeDilatation(x,yNP1,weightedVolume,volume,bondDamage,dilatationNp1,neighborhoodList,numOwnedPoints,m_horizon);
-  MATERIAL_EVALUATION::computeInternalForceViscoelasticStandardLinearSolid(dt,
-                                                                           x,
-                                                                           yN,
-                                                                           yNP1,
-                                                                           weightedVolume,
-                                                                           volume,
-                                                                           dilatationN,
-                                                                           dilatationNp1,
-                                                                           bondDamage,
-                                                                           edbN,
-                                                                           edbNP1,
-                                                                           force,
-                                                                           neighborhoodList,
-                                                                           numOwnedPoints,
-                                                                           m_bulkModulus,
-                                                                           m_shearModulus,
-                                                                           m_lambda_i,
-                                                                           m_tau_b);
+  int timerId = forceKernelTimerId();
+  PeridigmNS::Timer::self().startTimer(timerId);
+  if(m_threadParallelForce){
+    int numOverlapPoints = dataManager.getOverlapScalarPointMap()->NumMyElements();
+    MATERIAL_EVALUATION::computeDilatationThreaded(x,yNP1,weightedVolume,volume,bondDamage,dilatationNp1,neighborhoodList,numOwnedPoints,m_horizon,
+                                                   PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),0.0,0,m_threadScratch);
+    MATERIAL_EVALUATION::computeInternalForceViscoelasticStandardLinearSolidThreaded(dt,
+                                                                                     x,
+                                                                                     yN,
+                                                                                     yNP1,
+                                                                                     weightedVolume,
+                                                                                     volume,
+                                                                                     dilatationN,
+                                                                                     dilatationNp1,
+                                                                                     bondDamage,
+                                                                                     edbN,
+                                                                                     edbNP1,
+                                                                                     force,
+                                                                                     neighborhoodList,
+                                                                                     numOwnedPoints,
+                                                                                     numOverlapPoints,
+                                                                                     m_bulkModulus,
+                                                                                     m_shearModulus,
+                                                                                     m_lambda_i,
+                                                                                     m_tau_b,
+                                                                                     m_deterministicThreading,
+                                                                                     m_threadScratch);
+  }
+  else{
+    MATERIAL_EVALUATION::computeDilatation(x,yNP1,weightedVolume,volume,bondDamage,dilatationNp1,neighborhoodList,numOwnedPoints,m_horizon);
+    MATERIAL_EVALUATION::computeInternalForceViscoelasticStandardLinearSolid(dt,
+                                                                             x,
+                                                                             yN,
+                                                                             yNP1,
+                                                                             weightedVolume,
+                                                                             volume,
+                                                                             dilatationN,
+                                                                             dilatationNp1,
+                                                                             bondDamage,
+                                                                             edbN,
+                                                                             edbNP1,
+                                                                             force,
+                                                                             neighborhoodList,
+                                                                             numOwnedPoints,
+                                                                             m_bulkModulus,
+                                                                             m_shearModulus,
+                                                                             m_lambda_i,
+                                                                             m_tau_b);
+  }
+  PeridigmNS::Timer::self().stopTimer(timerId);
 }
 
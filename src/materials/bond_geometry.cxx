@@ -0,0 +1,92 @@
+//! \file bond_geometry.cxx
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "bond_geometry.h"
+#include <cmath>
+
+namespace MATERIAL_EVALUATION {
+
+void computeBondGeometry
+(
+		const double* xOverlap,
+		const double* volumeOverlap,
+		const int* localNeighborList,
+		int numOwnedPoints,
+		double horizon,
+		const PeridigmNS::InfluenceFunction::functionPointer OMEGA,
+		double* referenceLength,
+		double* inverseReferenceLength,
+		double* influenceFunctionValue,
+		double* neighborVolume
+)
+{
+	const int *neighPtr = localNeighborList;
+	const double *xOwned = xOverlap;
+	int bondIndex = 0;
+	for(int p=0;p<numOwnedPoints;p++, xOwned+=3){
+		int numNeigh = *neighPtr; neighPtr++;
+		const double *X = xOwned;
+		for(int n=0;n<numNeigh;n++,neighPtr++,bondIndex++){
+			int localId = *neighPtr;
+			const double *XP = &xOverlap[3*localId];
+			double dx = XP[0]-X[0];
+			double dy = XP[1]-X[1];
+			double dz = XP[2]-X[2];
+			double zeta = sqrt(dx*dx+dy*dy+dz*dz);
+			if(referenceLength)
+				referenceLength[bondIndex] = zeta;
+			if(inverseReferenceLength)
+				inverseReferenceLength[bondIndex] = 1.0/zeta;
+			if(influenceFunctionValue)
+				influenceFunctionValue[bondIndex] = OMEGA(zeta,horizon);
+			if(neighborVolume)
+				neighborVolume[bondIndex] = volumeOverlap[localId];
+		}
+	}
+}
+
+}
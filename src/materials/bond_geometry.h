@@ -0,0 +1,108 @@
+//! \file bond_geometry.h
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+#ifndef BOND_GEOMETRY_H
+#define BOND_GEOMETRY_H
+
+#include "Peridigm_InfluenceFunction.hpp"
+
+namespace MATERIAL_EVALUATION {
+
+/**
+ * Reference-configuration bond geometry, one entry per bond in neighbor list order
+ * (the same layout as Bond_Damage).  The reference configuration does not change, so
+ * these values are computed once by computeBondGeometry() and read by the kernels in
+ * place of recomputing |X_j - X_i|, the influence function and the neighbor volume
+ * gather for every bond on every step.
+ */
+struct BondGeometry {
+
+	BondGeometry() : referenceLength(0), inverseReferenceLength(0), influenceFunctionValue(0), neighborVolume(0) {}
+
+	//! Returns the geometry starting at the given bond; quantities that are not cached stay null.
+	BondGeometry offset(int bondOffset) const {
+		BondGeometry g;
+		g.referenceLength = offset(referenceLength, bondOffset);
+		g.inverseReferenceLength = offset(inverseReferenceLength, bondOffset);
+		g.influenceFunctionValue = offset(influenceFunctionValue, bondOffset);
+		g.neighborVolume = offset(neighborVolume, bondOffset);
+		return g;
+	}
+
+	const double* referenceLength;
+	const double* inverseReferenceLength;
+	const double* influenceFunctionValue;
+	const double* neighborVolume;
+
+private:
+
+	//! Pointer arithmetic on a null pointer is undefined, so an absent array is passed through as null.
+	static const double* offset(const double* values, int bondOffset) {
+		return values == 0 ? 0 : values + bondOffset;
+	}
+};
+
+/**
+ * Fills the bond geometry for the owned points.  Any of the output arrays may be null,
+ * in which case that quantity is not computed.
+ */
+void computeBondGeometry
+(
+		const double* xOverlap,
+		const double* volumeOverlap,
+		const int* localNeighborList,
+		int numOwnedPoints,
+		double horizon,
+		const PeridigmNS::InfluenceFunction::functionPointer OMEGA,
+		double* referenceLength,
+		double* inverseReferenceLength,
+		double* influenceFunctionValue,
+		double* neighborVolume
+);
+
+}
+
+#endif // BOND_GEOMETRY_H
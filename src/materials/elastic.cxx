@@ -49,12 +49,24 @@
 #include <Sacado.hpp>
 #include "elastic.h"
 #include "material_utilities.h"
+#include "thread_parallel.h"
 
 namespace MATERIAL_EVALUATION {
 
-template<typename ScalarT>
-void computeInternalForceLinearElastic
+/**
+ * Evaluates the owned points pBegin <= p < pEnd.  neighPtr and bondDamage point at
+ * the neighborhood list entry and first bond of point pBegin.  Forces on owned
+ * points and reactions on their neighbors are both accumulated into fInternalOverlap.
+ * If bondGeometry is given (offset to the first bond of pBegin), the cached reference
+ * length, influence function value and neighbor volume are used; otherwise the
+ * influence function policy OMEGA is evaluated inline for each bond.
+ */
+template<typename ScalarT, class InfluenceFunctionPolicy>
+static void computeInternalForceLinearElasticRangeWithPolicy
 (
+		int pBegin,
+		int pEnd,
+		const int* neighPtr,
 		const double* xOverlap,
 		const ScalarT* yOverlap,
 		const double* mOwned,
@@ -63,50 +75,56 @@ void computeInternalForceLinearElastic
 		const double* bondDamage,
 		ScalarT* fInternalOverlap,
 		ScalarT* partialStressOverlap,
-		const int*  localNeighborList,
-		int numOwnedPoints,
 		double BULK_MODULUS,
 		double SHEAR_MODULUS,
         double horizon,
+        const InfluenceFunctionPolicy& OMEGA,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
 )
 {
-
-	/*
-	 * Compute processor local contribution to internal force
-	 */
 	double K = BULK_MODULUS;
 	double MU = SHEAR_MODULUS;
 
-	const double *xOwned = xOverlap;
-	const ScalarT *yOwned = yOverlap;
-    const double *deltaT = deltaTemperature;
-	const double *m = mOwned;
+	const double *xOwned = xOverlap + 3*pBegin;
+	const ScalarT *yOwned = yOverlap + 3*pBegin;
+    const double *deltaT = deltaTemperature != 0 ? deltaTemperature + pBegin : 0;
+	const double *m = mOwned + pBegin;
 	const double *v = volumeOverlap;
-	const ScalarT *theta = dilatationOwned;
-	ScalarT *fOwned = fInternalOverlap;
-	ScalarT *psOwned = partialStressOverlap;
+	const ScalarT *theta = dilatationOwned + pBegin;
+	ScalarT *fOwned = fInternalOverlap + 3*pBegin;
+	ScalarT *psOwned = partialStressOverlap != 0 ? partialStressOverlap + 9*pBegin : 0;
 
-	const int *neighPtr = localNeighborList;
-	double cellVolume, alpha, X_dx, X_dy, X_dz, zeta, omega;
+	double cellVolume, alpha, X_dx(0.0), X_dy(0.0), X_dz(0.0), zeta, omega;
+	int bond = 0;
 	ScalarT Y_dx, Y_dy, Y_dz, dY, t, fx, fy, fz, e, c1;
-	for(int p=0;p<numOwnedPoints;p++, xOwned +=3, yOwned +=3, fOwned+=3, psOwned+=9, deltaT++, m++, theta++){
+	for(int p=pBegin;p<pEnd;p++, xOwned +=3, yOwned +=3, fOwned+=3, psOwned+=9, deltaT++, m++, theta++){
 
 		int numNeigh = *neighPtr; neighPtr++;
 		const double *X = xOwned;
 		const ScalarT *Y = yOwned;
 		alpha = 15.0*MU/(*m);
 		double selfCellVolume = v[p];
-		for(int n=0;n<numNeigh;n++,neighPtr++,bondDamage++){
+		for(int n=0;n<numNeigh;n++,neighPtr++,bondDamage++,bond++){
 			int localId = *neighPtr;
-			cellVolume = v[localId];
-			const double *XP = &xOverlap[3*localId];
 			const ScalarT *YP = &yOverlap[3*localId];
-			X_dx = XP[0]-X[0];
-			X_dy = XP[1]-X[1];
-			X_dz = XP[2]-X[2];
-			zeta = sqrt(X_dx*X_dx+X_dy*X_dy+X_dz*X_dz);
+			if(bondGeometry == 0 || partialStressOverlap != 0){
+				const double *XP = &xOverlap[3*localId];
+				X_dx = XP[0]-X[0];
+				X_dy = XP[1]-X[1];
+				X_dz = XP[2]-X[2];
+			}
+			if(bondGeometry){
+				cellVolume = bondGeometry->neighborVolume[bond];
+				zeta = bondGeometry->referenceLength[bond];
+				omega = bondGeometry->influenceFunctionValue[bond];
+			}
+			else{
+				cellVolume = v[localId];
+				zeta = sqrt(X_dx*X_dx+X_dy*X_dy+X_dz*X_dz);
+				omega = OMEGA(zeta,horizon);
+			}
 			Y_dx = YP[0]-Y[0];
 			Y_dy = YP[1]-Y[1];
 			Y_dz = YP[2]-Y[2];
@@ -114,7 +132,6 @@ void computeInternalForceLinearElastic
             e = dY - zeta;
             if(deltaTemperature)
               e -= thermalExpansionCoefficient*(*deltaT)*zeta;
-			omega = scalarInfluenceFunction(zeta,horizon);
 			// c1 = omega*(*theta)*(9.0*K-15.0*MU)/(3.0*(*m));
 			c1 = omega*(*theta)*(3.0*K/(*m)-alpha/3.0);
 			t = (1.0-*bondDamage)*(c1 * zeta + (1.0-*bondDamage) * omega * alpha * e);
@@ -145,6 +162,291 @@ void computeInternalForceLinearElastic
 	}
 }
 
+//! Binds the arguments of computeInternalForceLinearElasticRangeWithPolicy() for InfluenceFunction::dispatch().
+template<typename ScalarT>
+struct ForceRangeKernel {
+	int pBegin;
+	int pEnd;
+	const int* neighPtr;
+	const double* xOverlap;
+	const ScalarT* yOverlap;
+	const double* mOwned;
+	const double* volumeOverlap;
+	const ScalarT* dilatationOwned;
+	const double* bondDamage;
+	ScalarT* fInternalOverlap;
+	ScalarT* partialStressOverlap;
+	double BULK_MODULUS;
+	double SHEAR_MODULUS;
+	double horizon;
+	double thermalExpansionCoefficient;
+	const double* deltaTemperature;
+	const BondGeometry* bondGeometry;
+	template<class InfluenceFunctionPolicy>
+	void operator()(const InfluenceFunctionPolicy& OMEGA) const {
+		computeInternalForceLinearElasticRangeWithPolicy(pBegin,pEnd,neighPtr,xOverlap,yOverlap,mOwned,volumeOverlap,dilatationOwned,bondDamage,
+		                                                 fInternalOverlap,partialStressOverlap,BULK_MODULUS,SHEAR_MODULUS,horizon,
+		                                                 OMEGA,thermalExpansionCoefficient,deltaTemperature,bondGeometry);
+	}
+};
+
+/**
+ * Evaluates the owned points pBegin <= p < pEnd with the policy selected by OMEGA.
+ * Arguments are as for computeInternalForceLinearElasticRangeWithPolicy().
+ */
+template<typename ScalarT>
+static void computeInternalForceLinearElasticRange
+(
+		int pBegin,
+		int pEnd,
+		const int* neighPtr,
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const ScalarT* dilatationOwned,
+		const double* bondDamage,
+		ScalarT* fInternalOverlap,
+		ScalarT* partialStressOverlap,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
+)
+{
+	ForceRangeKernel<ScalarT> kernel = {pBegin,pEnd,neighPtr,xOverlap,yOverlap,mOwned,volumeOverlap,dilatationOwned,bondDamage,
+	                                    fInternalOverlap,partialStressOverlap,BULK_MODULUS,SHEAR_MODULUS,horizon,
+	                                    thermalExpansionCoefficient,deltaTemperature,bondGeometry};
+	// The cached geometry already holds the influence function values
+	PeridigmNS::InfluenceFunction::dispatch(bondGeometry ? InfluenceFunctionSelection(0, PeridigmNS::InfluenceFunction::ONE) : OMEGA, kernel);
+}
+
+template<typename ScalarT>
+void computeInternalForceLinearElastic
+(
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const ScalarT* dilatationOwned,
+		const double* bondDamage,
+		ScalarT* fInternalOverlap,
+		ScalarT* partialStressOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
+)
+{
+	/*
+	 * Compute processor local contribution to internal force
+	 */
+	computeInternalForceLinearElasticRange(0,numOwnedPoints,localNeighborList,
+	                                       xOverlap,yOverlap,mOwned,volumeOverlap,dilatationOwned,bondDamage,
+	                                       fInternalOverlap,partialStressOverlap,
+	                                       BULK_MODULUS,SHEAR_MODULUS,horizon,OMEGA,thermalExpansionCoefficient,deltaTemperature,bondGeometry);
+}
+
+void computeInternalForceLinearElasticThreaded
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* dilatationOwned,
+		const double* bondDamage,
+		double* fInternalOverlap,
+		double* partialStressOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		int numOverlapPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        bool deterministic,
+        ThreadScratch& scratch,
+        const BondGeometry* bondGeometry
+)
+{
+	// The partial stress is written only at owned points, so it is accumulated directly;
+	// the force (which is scattered to neighbors) goes through the per-partition buffers.
+	evaluateThreadParallel(localNeighborList, numOwnedPoints, 3*numOverlapPoints, fInternalOverlap, deterministic, scratch,
+	                       [&](int pBegin, int pEnd, const int* neighPtr, int bondOffset, double* fTarget){
+	                         BondGeometry rangeGeometry;
+	                         if(bondGeometry)
+	                           rangeGeometry = bondGeometry->offset(bondOffset);
+	                         computeInternalForceLinearElasticRange(pBegin,pEnd,neighPtr,
+	                                                                xOverlap,yOverlap,mOwned,volumeOverlap,dilatationOwned,bondDamage+bondOffset,
+	                                                                fTarget,partialStressOverlap,
+	                                                                BULK_MODULUS,SHEAR_MODULUS,horizon,OMEGA,thermalExpansionCoefficient,deltaTemperature,
+	                                                                bondGeometry ? &rangeGeometry : 0);
+	                       });
+}
+
+/**
+ * Bond loops of computeInternalForceLinearElasticSoA().  The neighbors of a point are distinct,
+ * so the reactions scattered to them do not conflict and the bond loop is marked for vectorization.
+ */
+template<class InfluenceFunctionPolicy>
+static void computeInternalForceLinearElasticSoAWithPolicy
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		int numOverlapPoints,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* dilatationOwned,
+		const double* bondDamage,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        const InfluenceFunctionPolicy& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
+)
+{
+	double K = BULK_MODULUS;
+	double MU = SHEAR_MODULUS;
+
+	const double *x0 = xOverlap, *x1 = xOverlap + numOverlapPoints, *x2 = xOverlap + 2*numOverlapPoints;
+	const double *y0 = yOverlap, *y1 = yOverlap + numOverlapPoints, *y2 = yOverlap + 2*numOverlapPoints;
+	double *f0 = fInternalOverlap, *f1 = fInternalOverlap + numOverlapPoints, *f2 = fInternalOverlap + 2*numOverlapPoints;
+	const int *neighPtr = localNeighborList;
+	int bond = 0;
+	for(int p=0 ; p<numOwnedPoints ; p++){
+		int numNeigh = *neighPtr; neighPtr++;
+		const double *damage = bondDamage + bond;
+		double alpha = 15.0*MU/mOwned[p];
+		double c = dilatationOwned[p]*(3.0*K/mOwned[p]-alpha/3.0);
+		double thermalStrain = deltaTemperature != 0 ? thermalExpansionCoefficient*deltaTemperature[p] : 0.0;
+		double selfCellVolume = volumeOverlap[p];
+		double fx(0.0), fy(0.0), fz(0.0);
+		if(bondGeometry){
+			const double *zeta = bondGeometry->referenceLength + bond;
+			const double *omega = bondGeometry->influenceFunctionValue + bond;
+			const double *cellVolume = bondGeometry->neighborVolume + bond;
+#ifdef _OPENMP
+#pragma omp simd reduction(+:fx,fy,fz)
+#endif
+			for(int n=0 ; n<numNeigh ; n++){
+				int localId = neighPtr[n];
+				double Y_dx = y0[localId]-y0[p];
+				double Y_dy = y1[localId]-y1[p];
+				double Y_dz = y2[localId]-y2[p];
+				double dY = sqrt(Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz);
+				double e = dY - zeta[n] - thermalStrain*zeta[n];
+				double t = (1.0-damage[n])*omega[n]*(c*zeta[n] + (1.0-damage[n])*alpha*e)/dY;
+				fx += t*Y_dx*cellVolume[n];
+				fy += t*Y_dy*cellVolume[n];
+				fz += t*Y_dz*cellVolume[n];
+				f0[localId] -= t*Y_dx*selfCellVolume;
+				f1[localId] -= t*Y_dy*selfCellVolume;
+				f2[localId] -= t*Y_dz*selfCellVolume;
+			}
+		}
+		else{
+#ifdef _OPENMP
+#pragma omp simd reduction(+:fx,fy,fz)
+#endif
+			for(int n=0 ; n<numNeigh ; n++){
+				int localId = neighPtr[n];
+				double X_dx = x0[localId]-x0[p];
+				double X_dy = x1[localId]-x1[p];
+				double X_dz = x2[localId]-x2[p];
+				double zeta = sqrt(X_dx*X_dx+X_dy*X_dy+X_dz*X_dz);
+				double omega = OMEGA(zeta,horizon);
+				double cellVolume = volumeOverlap[localId];
+				double Y_dx = y0[localId]-y0[p];
+				double Y_dy = y1[localId]-y1[p];
+				double Y_dz = y2[localId]-y2[p];
+				double dY = sqrt(Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz);
+				double e = dY - zeta - thermalStrain*zeta;
+				double t = (1.0-damage[n])*omega*(c*zeta + (1.0-damage[n])*alpha*e)/dY;
+				fx += t*Y_dx*cellVolume;
+				fy += t*Y_dy*cellVolume;
+				fz += t*Y_dz*cellVolume;
+				f0[localId] -= t*Y_dx*selfCellVolume;
+				f1[localId] -= t*Y_dy*selfCellVolume;
+				f2[localId] -= t*Y_dz*selfCellVolume;
+			}
+		}
+		f0[p] += fx;
+		f1[p] += fy;
+		f2[p] += fz;
+		neighPtr += numNeigh;
+		bond += numNeigh;
+	}
+}
+
+//! Binds the arguments of computeInternalForceLinearElasticSoAWithPolicy() for InfluenceFunction::dispatch().
+struct ForceSoAKernel {
+	const double* xOverlap;
+	const double* yOverlap;
+	int numOverlapPoints;
+	const double* mOwned;
+	const double* volumeOverlap;
+	const double* dilatationOwned;
+	const double* bondDamage;
+	double* fInternalOverlap;
+	const int* localNeighborList;
+	int numOwnedPoints;
+	double BULK_MODULUS;
+	double SHEAR_MODULUS;
+	double horizon;
+	double thermalExpansionCoefficient;
+	const double* deltaTemperature;
+	const BondGeometry* bondGeometry;
+	template<class InfluenceFunctionPolicy>
+	void operator()(const InfluenceFunctionPolicy& OMEGA) const {
+		computeInternalForceLinearElasticSoAWithPolicy(xOverlap,yOverlap,numOverlapPoints,mOwned,volumeOverlap,dilatationOwned,bondDamage,fInternalOverlap,
+		                                               localNeighborList,numOwnedPoints,BULK_MODULUS,SHEAR_MODULUS,horizon,
+		                                               OMEGA,thermalExpansionCoefficient,deltaTemperature,bondGeometry);
+	}
+};
+
+void computeInternalForceLinearElasticSoA
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		int numOverlapPoints,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* dilatationOwned,
+		const double* bondDamage,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
+)
+{
+	ForceSoAKernel kernel = {xOverlap,yOverlap,numOverlapPoints,mOwned,volumeOverlap,dilatationOwned,bondDamage,fInternalOverlap,
+	                         localNeighborList,numOwnedPoints,BULK_MODULUS,SHEAR_MODULUS,horizon,
+	                         thermalExpansionCoefficient,deltaTemperature,bondGeometry};
+	// The cached geometry already holds the influence function values
+	PeridigmNS::InfluenceFunction::dispatch(bondGeometry ? InfluenceFunctionSelection(0, PeridigmNS::InfluenceFunction::ONE) : OMEGA, kernel);
+}
+
 /** Explicit template instantiation for double. */
 template void computeInternalForceLinearElastic<double>
 (
@@ -161,8 +463,10 @@ template void computeInternalForceLinearElastic<double>
 		double BULK_MODULUS,
 		double SHEAR_MODULUS,
         double horizon,
+        const InfluenceFunctionSelection& OMEGA,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
  );
 
 /** Explicit template instantiation for Sacado::Fad::DFad<double>. */
@@ -181,8 +485,10 @@ template void computeInternalForceLinearElastic<Sacado::Fad::DFad<double> >
 		double BULK_MODULUS,
 		double SHEAR_MODULUS,
         double horizon,
+        const InfluenceFunctionSelection& OMEGA,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
 );
 
 }
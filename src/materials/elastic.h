@@ -47,6 +47,10 @@
 #ifndef ELASTIC_H
 #define ELASTIC_H
 
+#include "material_utilities.h"
+#include "thread_parallel.h"
+#include "bond_geometry.h"
+
 namespace MATERIAL_EVALUATION {
 
 //! Computes contributions to the internal force resulting from owned points.
@@ -66,9 +70,61 @@ void computeInternalForceLinearElastic
 		double BULK_MODULUS,
 		double SHEAR_MODULUS,
         double horizon,
+        const InfluenceFunctionSelection& OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),
         double thermalExpansionCoefficient = 0,
-        const double* deltaTemperature = 0
+        const double* deltaTemperature = 0,
+        const BondGeometry* bondGeometry = 0
+);
+
+//! Thread-parallel variant of computeInternalForceLinearElastic(); see evaluateThreadParallel().
+void computeInternalForceLinearElasticThreaded
+(
+		const double* xOverlapPtr,
+		const double* yOverlapPtr,
+		const double* mOwned,
+		const double* volumeOverlapPtr,
+		const double* dilatationOwned,
+		const double* bondDamage,
+		double* fInternalOverlapPtr,
+		double* partialStressOverlapPtr,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		int numOverlapPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        bool deterministic,
+        ThreadScratch& scratch,
+        const BondGeometry* bondGeometry = 0
+);
 
+/**
+ * Variant of computeInternalForceLinearElastic() for coordinates and forces in structure-of-arrays
+ * layout; the x, y, and z components of overlap point i are at [i], [numOverlapPoints+i], and
+ * [2*numOverlapPoints+i].  Partial stress is not computed.
+ */
+void computeInternalForceLinearElasticSoA
+(
+		const double* xOverlapPtr,
+		const double* yOverlapPtr,
+		int numOverlapPoints,
+		const double* mOwned,
+		const double* volumeOverlapPtr,
+		const double* dilatationOwned,
+		const double* bondDamage,
+		double* fInternalOverlapPtr,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+        double horizon,
+        const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry = 0
 );
 
 }
@@ -48,6 +48,7 @@
 #include <Sacado.hpp>
 #include "elastic_plastic.h"
 #include "Peridigm_Constants.hpp"
+#include "thread_parallel.h"
 
 namespace MATERIAL_EVALUATION {
 
@@ -113,9 +114,17 @@ ScalarT computeDeviatoricForceStateNorm
 	return sqrt(norm);
 }
 
+/**
+ * Evaluates the owned points pBegin <= p < pEnd.  neighPtr and the bond-level arrays
+ * point at the neighborhood list entry and first bond of point pBegin.  Forces on owned
+ * points and reactions on their neighbors are both accumulated into fInternalOverlap.
+ */
 template<typename ScalarT>
-void computeInternalForceIsotropicElasticPlastic
+static void computeInternalForceIsotropicElasticPlasticRange
 (
+		int pBegin,
+		int pEnd,
+		const int* neighPtr,
 		const double* xOverlap,
 		const ScalarT* yNP1Overlap,
 		const double* mOwned,
@@ -127,8 +136,6 @@ void computeInternalForceIsotropicElasticPlastic
 		const double* lambdaN,
 		ScalarT* lambdaNP1,
 		ScalarT* fInternalOverlap,
-		const int*  localNeighborList,
-		int numOwnedPoints,
 		double BULK_MODULUS,
 		double SHEAR_MODULUS,
 		double HORIZON,
@@ -152,17 +159,18 @@ void computeInternalForceIsotropicElasticPlastic
 	if(isPlanarProblem)
     	yieldValue = 225.0 / 3. * yieldStress * yieldStress / 8 / PeridigmNS::value_of_pi() / THICKNESS / pow(DELTA,4);
 
-	const double *xOwned = xOverlap;
-	const ScalarT *yOwned = yNP1Overlap;
-	const double *m = mOwned;
+	const double *xOwned = xOverlap + 3*pBegin;
+	const ScalarT *yOwned = yNP1Overlap + 3*pBegin;
+	const double *m = mOwned + pBegin;
 	const double *v = volumeOverlap;
-	const ScalarT *theta = dilatationOwned;
-	ScalarT *fOwned = fInternalOverlap;
+	const ScalarT *theta = dilatationOwned + pBegin;
+	ScalarT *fOwned = fInternalOverlap + 3*pBegin;
+	lambdaN += pBegin;
+	lambdaNP1 += pBegin;
 
-	const int *neighPtr = localNeighborList;
 	double cellVolume, alpha, dx_X, dy_X, dz_X, zeta, edpN;
     ScalarT dx_Y, dy_Y, dz_Y, dY, ed, tdTrial, t, ti, td;
-	for(int p=0;p<numOwnedPoints;p++, xOwned +=3, yOwned +=3, fOwned+=3, m++, theta++, lambdaN++, lambdaNP1++){
+	for(int p=pBegin;p<pEnd;p++, xOwned +=3, yOwned +=3, fOwned+=3, m++, theta++, lambdaN++, lambdaNP1++){
 
 		int numNeigh = *neighPtr; neighPtr++;
 		const double *X = xOwned;
@@ -279,6 +287,75 @@ void computeInternalForceIsotropicElasticPlastic
 	}
 }
 
+template<typename ScalarT>
+void computeInternalForceIsotropicElasticPlastic
+(
+		const double* xOverlap,
+		const ScalarT* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const ScalarT* dilatationOwned,
+		const double* bondDamage,
+		const double* deviatoricPlasticExtensionStateN,
+		ScalarT* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		ScalarT* lambdaNP1,
+		ScalarT* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness
+)
+{
+	computeInternalForceIsotropicElasticPlasticRange(0,numOwnedPoints,localNeighborList,
+	                                                 xOverlap,yNP1Overlap,mOwned,volumeOverlap,dilatationOwned,bondDamage,
+	                                                 deviatoricPlasticExtensionStateN,deviatoricPlasticExtensionStateNp1,
+	                                                 lambdaN,lambdaNP1,fInternalOverlap,
+	                                                 BULK_MODULUS,SHEAR_MODULUS,HORIZON,yieldStress,isPlanarProblem,thickness);
+}
+
+void computeInternalForceIsotropicElasticPlasticThreaded
+(
+		const double* xOverlap,
+		const double* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* dilatationOwned,
+		const double* bondDamage,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		double* lambdaNP1,
+		double* fInternalOverlap,
+		const int*  localNeighborList,
+		int numOwnedPoints,
+		int numOverlapPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness,
+		bool deterministic,
+		ThreadScratch& scratch
+)
+{
+	// The plastic state variables are written only for owned points and their own bonds,
+	// so they are updated in place; only the force goes through the per-partition buffers.
+	evaluateThreadParallel(localNeighborList, numOwnedPoints, 3*numOverlapPoints, fInternalOverlap, deterministic, scratch,
+	                       [&](int pBegin, int pEnd, const int* neighPtr, int bondOffset, double* fTarget){
+	                         computeInternalForceIsotropicElasticPlasticRange(pBegin,pEnd,neighPtr,
+	                                                                          xOverlap,yNP1Overlap,mOwned,volumeOverlap,dilatationOwned,bondDamage+bondOffset,
+	                                                                          deviatoricPlasticExtensionStateN+bondOffset,deviatoricPlasticExtensionStateNp1+bondOffset,
+	                                                                          lambdaN,lambdaNP1,fTarget,
+	                                                                          BULK_MODULUS,SHEAR_MODULUS,HORIZON,yieldStress,isPlanarProblem,thickness);
+	                       });
+}
+
 /** Explicit template instantiation for double. */
 template double computeDeviatoricForceStateNorm<double>
 (
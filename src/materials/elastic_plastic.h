@@ -48,6 +48,8 @@
 #ifndef ELASTIC_PLASTIC_H
 #define ELASTIC_PLASTIC_H
 
+#include "thread_parallel.h"
+
 namespace MATERIAL_EVALUATION {
 
 /**
@@ -105,6 +107,33 @@ void computeInternalForceIsotropicElasticPlastic
 		double thickness
 );
 
+//! Thread-parallel variant of computeInternalForceIsotropicElasticPlastic(); see evaluateThreadParallel().
+void computeInternalForceIsotropicElasticPlasticThreaded
+(
+		const double* xOverlap,
+		const double* yNP1Overlap,
+		const double* mOwned,
+		const double* volumeOverlap,
+		const double* dilatationOwned,
+		const double* bondDamage,
+		const double* deviatoricPlasticExtensionStateN,
+		double* deviatoricPlasticExtensionStateNp1,
+		const double* lambdaN,
+		double* lambdaNP1,
+		double* fInternalOverlap,
+		const int* localNeighborList,
+		int numOwnedPoints,
+		int numOverlapPoints,
+		double BULK_MODULUS,
+		double SHEAR_MODULUS,
+		double HORIZON,
+		double yieldStress,
+		bool isPlanarProblem,
+		double thickness,
+		bool deterministic,
+		ThreadScratch& scratch
+);
+
 }
 
 #endif // ELASTIC_PLASTIC_H
@@ -48,6 +48,7 @@
 #include "material_utilities.h"
 #include <cmath>
 #include <vector>
+#include <algorithm>
 #include <Sacado.hpp>
 
 namespace MATERIAL_EVALUATION {
@@ -158,14 +159,19 @@ double scalarInfluenceFunction
   return influenceFunction(zeta, horizon);
 }
 
-double computeWeightedVolume
+/**
+ * Weighted volume at a single point 'X', with the influence function given by the
+ * policy OMEGA so that it is inlined into the bond loop.
+ */
+template<class InfluenceFunctionPolicy>
+static double computeWeightedVolumeAtPoint
 (
 		const double *X,
 		const double *xOverlap,
 		const double* volumeOverlap,
 		const int* localNeighborList,
         double horizon,
-		const FunctionPointer omega
+		const InfluenceFunctionPolicy& OMEGA
 ){
 
 	double m=0.0;
@@ -181,12 +187,75 @@ double computeWeightedVolume
 		double dz = XP[2]-X[2];
 		double zetaSquared = dx*dx+dy*dy+dz*dz;
 		double d = sqrt(zetaSquared);
-		m+=omega(d,horizon)*(zetaSquared)*cellVolume;
+		m+=OMEGA(d,horizon)*(zetaSquared)*cellVolume;
 	}
 
 	return m;
 }
 
+template<class InfluenceFunctionPolicy>
+static void computeWeightedVolumeRange
+(
+		const double* xOverlap,
+		const double* volumeOverlap,
+		double *mOwned,
+		int myNumPoints,
+		const int* localNeighborList,
+        double horizon,
+		const InfluenceFunctionPolicy& OMEGA
+){
+	double *m = mOwned;
+	const double *xOwned = xOverlap;
+	const int *neighPtr = localNeighborList;
+	for(int p=0;p<myNumPoints;p++, xOwned+=3, m++){
+		int numNeigh = *neighPtr;
+		*m=computeWeightedVolumeAtPoint(xOwned,xOverlap,volumeOverlap,neighPtr,horizon,OMEGA);
+		neighPtr+=(numNeigh+1);
+	}
+}
+
+//! Binds the arguments of computeWeightedVolumeAtPoint() for InfluenceFunction::dispatch().
+struct WeightedVolumeAtPointKernel {
+	const double *X;
+	const double *xOverlap;
+	const double* volumeOverlap;
+	const int* localNeighborList;
+	double horizon;
+	double m;
+	template<class InfluenceFunctionPolicy>
+	void operator()(const InfluenceFunctionPolicy& OMEGA){
+		m = computeWeightedVolumeAtPoint(X,xOverlap,volumeOverlap,localNeighborList,horizon,OMEGA);
+	}
+};
+
+//! Binds the arguments of computeWeightedVolumeRange() for InfluenceFunction::dispatch().
+struct WeightedVolumeRangeKernel {
+	const double* xOverlap;
+	const double* volumeOverlap;
+	double *mOwned;
+	int myNumPoints;
+	const int* localNeighborList;
+	double horizon;
+	template<class InfluenceFunctionPolicy>
+	void operator()(const InfluenceFunctionPolicy& OMEGA) const {
+		computeWeightedVolumeRange(xOverlap,volumeOverlap,mOwned,myNumPoints,localNeighborList,horizon,OMEGA);
+	}
+};
+
+double computeWeightedVolume
+(
+		const double *X,
+		const double *xOverlap,
+		const double* volumeOverlap,
+		const int* localNeighborList,
+        double horizon,
+		const InfluenceFunctionSelection& omega
+){
+	WeightedVolumeAtPointKernel kernel = {X,xOverlap,volumeOverlap,localNeighborList,horizon,0.0};
+	PeridigmNS::InfluenceFunction::dispatch(omega, kernel);
+	return kernel.m;
+}
+
 void computeDeviatoricDilatation
 (
 		const double* xOverlap,
@@ -232,61 +301,308 @@ void computeDeviatoricDilatation
 	}
 }
 
-template<typename ScalarT>
-void computeDilatation
+/**
+ * Evaluates the dilatation at owned points pBegin <= p < pEnd.  neighPtr and bondDamage
+ * point at the neighborhood list entry and first bond of point pBegin.  If bondGeometry
+ * is given (offset to the first bond of pBegin), the cached reference geometry is used;
+ * otherwise the influence function policy OMEGA is evaluated inline for each bond.
+ */
+template<typename ScalarT, class InfluenceFunctionPolicy>
+static void computeDilatationRangeWithPolicy
 (
+		int pBegin,
+		int pEnd,
+		const int* neighPtr,
 		const double* xOverlap,
 		const ScalarT* yOverlap,
 		const double *mOwned,
 		const double* volumeOverlap,
 		const double* bondDamage,
 		ScalarT* dilatationOwned,
-		const int* localNeighborList,
-		int numOwnedPoints,
         double horizon,
-		const FunctionPointer OMEGA,
+		const InfluenceFunctionPolicy& OMEGA,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
 )
 {
-	const double *xOwned = xOverlap;
-	const ScalarT *yOwned = yOverlap;
-	const double *deltaT = deltaTemperature;
-	const double *m = mOwned;
+	const double *xOwned = xOverlap + 3*pBegin;
+	const ScalarT *yOwned = yOverlap + 3*pBegin;
+	const double *deltaT = deltaTemperature != 0 ? deltaTemperature + pBegin : 0;
+	const double *m = mOwned + pBegin;
 	const double *v = volumeOverlap;
-	ScalarT *theta = dilatationOwned;
+	ScalarT *theta = dilatationOwned + pBegin;
 	double cellVolume;
-	const int *neighPtr = localNeighborList;
-	for(int p=0; p<numOwnedPoints;p++, xOwned+=3, yOwned+=3, deltaT++, m++, theta++){
+	int bond = 0;
+	for(int p=pBegin; p<pEnd;p++, xOwned+=3, yOwned+=3, deltaT++, m++, theta++){
 		int numNeigh = *neighPtr; neighPtr++;
 		const double *X = xOwned;
 		const ScalarT *Y = yOwned;
 		*theta = ScalarT(0.0);
-		for(int n=0;n<numNeigh;n++,neighPtr++,bondDamage++){
+		for(int n=0;n<numNeigh;n++,neighPtr++,bondDamage++,bond++){
 			int localId = *neighPtr;
-			cellVolume = v[localId];
-			const double *XP = &xOverlap[3*localId];
 			const ScalarT *YP = &yOverlap[3*localId];
-			double X_dx = XP[0]-X[0];
-			double X_dy = XP[1]-X[1];
-			double X_dz = XP[2]-X[2];
-			double zetaSquared = X_dx*X_dx+X_dy*X_dy+X_dz*X_dz;
+			double d, omega;
+			if(bondGeometry){
+				cellVolume = bondGeometry->neighborVolume[bond];
+				d = bondGeometry->referenceLength[bond];
+				omega = bondGeometry->influenceFunctionValue[bond];
+			}
+			else{
+				cellVolume = v[localId];
+				const double *XP = &xOverlap[3*localId];
+				double X_dx = XP[0]-X[0];
+				double X_dy = XP[1]-X[1];
+				double X_dz = XP[2]-X[2];
+				d = sqrt(X_dx*X_dx+X_dy*X_dy+X_dz*X_dz);
+				omega = OMEGA(d,horizon);
+			}
 			ScalarT Y_dx = YP[0]-Y[0];
 			ScalarT Y_dy = YP[1]-Y[1];
 			ScalarT Y_dz = YP[2]-Y[2];
 			ScalarT dY = Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz;
-			double d = sqrt(zetaSquared);
 			ScalarT e = sqrt(dY);
 			e -= d;
 			if(deltaTemperature)
 			  e -= thermalExpansionCoefficient*(*deltaT)*d;
-			double omega = OMEGA(d,horizon);
 			*theta += 3.0*omega*(1.0-*bondDamage)*d*e*cellVolume/(*m);
 		}
 
 	}
 }
 
+//! Binds the arguments of computeDilatationRangeWithPolicy() for InfluenceFunction::dispatch().
+template<typename ScalarT>
+struct DilatationRangeKernel {
+	int pBegin;
+	int pEnd;
+	const int* neighPtr;
+	const double* xOverlap;
+	const ScalarT* yOverlap;
+	const double *mOwned;
+	const double* volumeOverlap;
+	const double* bondDamage;
+	ScalarT* dilatationOwned;
+	double horizon;
+	double thermalExpansionCoefficient;
+	const double* deltaTemperature;
+	const BondGeometry* bondGeometry;
+	template<class InfluenceFunctionPolicy>
+	void operator()(const InfluenceFunctionPolicy& OMEGA) const {
+		computeDilatationRangeWithPolicy(pBegin,pEnd,neighPtr,xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,
+		                                 horizon,OMEGA,thermalExpansionCoefficient,deltaTemperature,bondGeometry);
+	}
+};
+
+/**
+ * Evaluates the dilatation at owned points pBegin <= p < pEnd with the policy selected by OMEGA.
+ * Arguments are as for computeDilatationRangeWithPolicy().
+ */
+template<typename ScalarT>
+static void computeDilatationRange
+(
+		int pBegin,
+		int pEnd,
+		const int* neighPtr,
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		ScalarT* dilatationOwned,
+        double horizon,
+		const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
+)
+{
+	DilatationRangeKernel<ScalarT> kernel = {pBegin,pEnd,neighPtr,xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,dilatationOwned,
+	                                         horizon,thermalExpansionCoefficient,deltaTemperature,bondGeometry};
+	// The cached geometry already holds the influence function values
+	PeridigmNS::InfluenceFunction::dispatch(bondGeometry ? InfluenceFunctionSelection(0, PeridigmNS::InfluenceFunction::ONE) : OMEGA, kernel);
+}
+
+template<typename ScalarT>
+void computeDilatation
+(
+		const double* xOverlap,
+		const ScalarT* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		ScalarT* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
+)
+{
+	computeDilatationRange(0,numOwnedPoints,localNeighborList,xOverlap,yOverlap,mOwned,volumeOverlap,bondDamage,
+	                       dilatationOwned,horizon,OMEGA,thermalExpansionCoefficient,deltaTemperature,bondGeometry);
+}
+
+void computeDilatationThreaded
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        ThreadScratch& scratch,
+        const BondGeometry* bondGeometry
+)
+{
+	// Each point writes only its own dilatation, so no private buffers are needed and
+	// the result does not depend on the number of threads.
+	int numPartitions = std::max(std::min(4*getNumKernelThreads(), numOwnedPoints), 1);
+	const int* bondOffsets = getBondOffsets(localNeighborList, numOwnedPoints, scratch);
+	partitionByBondCount(bondOffsets, numOwnedPoints, numPartitions, scratch.partitionStart);
+	const int* partitionStart = &scratch.partitionStart[0];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+	for(int part=0 ; part<numPartitions ; ++part){
+		int pBegin = partitionStart[part];
+		int pEnd = partitionStart[part+1];
+		if(pBegin < pEnd){
+			BondGeometry rangeGeometry;
+			if(bondGeometry)
+				rangeGeometry = bondGeometry->offset(bondOffsets[pBegin]);
+			computeDilatationRange(pBegin,pEnd,localNeighborList+bondOffsets[pBegin]+pBegin,xOverlap,yOverlap,mOwned,volumeOverlap,
+			                       bondDamage+bondOffsets[pBegin],dilatationOwned,horizon,OMEGA,thermalExpansionCoefficient,deltaTemperature,
+			                       bondGeometry ? &rangeGeometry : 0);
+		}
+	}
+}
+
+/**
+ * Bond loops of computeDilatationSoA().  The neighbors of a point are distinct, so the bond
+ * loop carries no dependence other than the sum and is marked for vectorization.
+ */
+template<class InfluenceFunctionPolicy>
+static void computeDilatationSoAWithPolicy
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		int numOverlapPoints,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const InfluenceFunctionPolicy& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
+)
+{
+	const double *x0 = xOverlap, *x1 = xOverlap + numOverlapPoints, *x2 = xOverlap + 2*numOverlapPoints;
+	const double *y0 = yOverlap, *y1 = yOverlap + numOverlapPoints, *y2 = yOverlap + 2*numOverlapPoints;
+	const int *neighPtr = localNeighborList;
+	int bond = 0;
+	for(int p=0 ; p<numOwnedPoints ; p++){
+		int numNeigh = *neighPtr; neighPtr++;
+		const double *damage = bondDamage + bond;
+		double thermalStrain = deltaTemperature != 0 ? thermalExpansionCoefficient*deltaTemperature[p] : 0.0;
+		double theta = 0.0;
+		if(bondGeometry){
+			const double *d = bondGeometry->referenceLength + bond;
+			const double *omega = bondGeometry->influenceFunctionValue + bond;
+			const double *cellVolume = bondGeometry->neighborVolume + bond;
+#ifdef _OPENMP
+#pragma omp simd reduction(+:theta)
+#endif
+			for(int n=0 ; n<numNeigh ; n++){
+				int localId = neighPtr[n];
+				double Y_dx = y0[localId]-y0[p];
+				double Y_dy = y1[localId]-y1[p];
+				double Y_dz = y2[localId]-y2[p];
+				double e = sqrt(Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz) - d[n] - thermalStrain*d[n];
+				theta += omega[n]*(1.0-damage[n])*d[n]*e*cellVolume[n];
+			}
+		}
+		else{
+#ifdef _OPENMP
+#pragma omp simd reduction(+:theta)
+#endif
+			for(int n=0 ; n<numNeigh ; n++){
+				int localId = neighPtr[n];
+				double X_dx = x0[localId]-x0[p];
+				double X_dy = x1[localId]-x1[p];
+				double X_dz = x2[localId]-x2[p];
+				double d = sqrt(X_dx*X_dx+X_dy*X_dy+X_dz*X_dz);
+				double Y_dx = y0[localId]-y0[p];
+				double Y_dy = y1[localId]-y1[p];
+				double Y_dz = y2[localId]-y2[p];
+				double e = sqrt(Y_dx*Y_dx+Y_dy*Y_dy+Y_dz*Y_dz) - d - thermalStrain*d;
+				theta += OMEGA(d,horizon)*(1.0-damage[n])*d*e*volumeOverlap[localId];
+			}
+		}
+		dilatationOwned[p] = 3.0*theta/mOwned[p];
+		neighPtr += numNeigh;
+		bond += numNeigh;
+	}
+}
+
+//! Binds the arguments of computeDilatationSoAWithPolicy() for InfluenceFunction::dispatch().
+struct DilatationSoAKernel {
+	const double* xOverlap;
+	const double* yOverlap;
+	int numOverlapPoints;
+	const double *mOwned;
+	const double* volumeOverlap;
+	const double* bondDamage;
+	double* dilatationOwned;
+	const int* localNeighborList;
+	int numOwnedPoints;
+	double horizon;
+	double thermalExpansionCoefficient;
+	const double* deltaTemperature;
+	const BondGeometry* bondGeometry;
+	template<class InfluenceFunctionPolicy>
+	void operator()(const InfluenceFunctionPolicy& OMEGA) const {
+		computeDilatationSoAWithPolicy(xOverlap,yOverlap,numOverlapPoints,mOwned,volumeOverlap,bondDamage,dilatationOwned,localNeighborList,
+		                               numOwnedPoints,horizon,OMEGA,thermalExpansionCoefficient,deltaTemperature,bondGeometry);
+	}
+};
+
+void computeDilatationSoA
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		int numOverlapPoints,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+		const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
+)
+{
+	DilatationSoAKernel kernel = {xOverlap,yOverlap,numOverlapPoints,mOwned,volumeOverlap,bondDamage,dilatationOwned,localNeighborList,
+	                              numOwnedPoints,horizon,thermalExpansionCoefficient,deltaTemperature,bondGeometry};
+	// The cached geometry already holds the influence function values
+	PeridigmNS::InfluenceFunction::dispatch(bondGeometry ? InfluenceFunctionSelection(0, PeridigmNS::InfluenceFunction::ONE) : OMEGA, kernel);
+}
+
 /** Explicit template instantiation for double. */
 template
 void computeDilatation<double>
@@ -300,9 +616,10 @@ void computeDilatation<double>
 		const int* localNeighborList,
 		int numOwnedPoints,
         double horizon,
-		const FunctionPointer OMEGA,
+		const InfluenceFunctionSelection& OMEGA,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
  );
 
 
@@ -319,9 +636,10 @@ void computeDilatation<Sacado::Fad::DFad<double> >
 		const int* localNeighborList,
 		int numOwnedPoints,
         double horizon,
-		const FunctionPointer OMEGA,
+		const InfluenceFunctionSelection& OMEGA,
         double thermalExpansionCoefficient,
-        const double* deltaTemperature
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry
  );
 
 /**
@@ -506,17 +824,10 @@ void computeWeightedVolume
 		int myNumPoints,
 		const int* localNeighborList,
         double horizon,
-        const FunctionPointer OMEGA
+        const InfluenceFunctionSelection& OMEGA
 ){
-	double *m = mOwned;
-	const double *xOwned = xOverlap;
-	const int *neighPtr = localNeighborList;
-	for(int p=0;p<myNumPoints;p++, xOwned+=3, m++){
-		int numNeigh = *neighPtr;
-		const double *X = xOwned;
-		*m=MATERIAL_EVALUATION::computeWeightedVolume(X,xOverlap,volumeOverlap,neighPtr,horizon);
-		neighPtr+=(numNeigh+1);
-	}
+	WeightedVolumeRangeKernel kernel = {xOverlap,volumeOverlap,mOwned,myNumPoints,localNeighborList,horizon};
+	PeridigmNS::InfluenceFunction::dispatch(OMEGA, kernel);
 }
 
 
@@ -52,6 +52,8 @@
 
 #include "Peridigm_Constants.hpp"
 #include "Peridigm_InfluenceFunction.hpp"
+#include "thread_parallel.h"
+#include "bond_geometry.h"
 
 class Bond_Volume_Calculator;
 
@@ -62,6 +64,7 @@ using std::size_t;
 enum PURE_SHEAR { XY=0, YZ, ZX };
 
 typedef PeridigmNS::InfluenceFunction::functionPointer FunctionPointer;
+typedef PeridigmNS::InfluenceFunction::Selection InfluenceFunctionSelection;
 
 //! Compute and store the influence function value for each set of bonded material points.
 void computeAndStoreInfluenceFunctionValues
@@ -101,7 +104,7 @@ void computeWeightedVolume
 		int myNumPoints,
 		const int* localNeighborList,
         double horizon,
-        const FunctionPointer OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction()
+        const InfluenceFunctionSelection& OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction()
 );
 
 
@@ -170,7 +173,7 @@ double computeWeightedVolume
 		const double* volumeOverlap,
 		const int* localNeighborList,
         double horizon,
-        const FunctionPointer OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction()
+        const InfluenceFunctionSelection& OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction()
 );
 
 double scalarInfluenceFunction(
@@ -205,9 +208,51 @@ void computeDilatation
 		const int* localNeighborList,
 		int numOwnedPoints,
         double horizon,
-        const FunctionPointer OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),
+        const InfluenceFunctionSelection& OMEGA=PeridigmNS::InfluenceFunction::self().getInfluenceFunction(),
         double thermalExpansionCoefficient = 0,
-        const double* deltaTemperature = 0
+        const double* deltaTemperature = 0,
+        const BondGeometry* bondGeometry = 0
+ );
+
+//! Thread-parallel variant of computeDilatation(); the result is independent of the thread count.
+void computeDilatationThreaded
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+        const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        ThreadScratch& scratch,
+        const BondGeometry* bondGeometry = 0
+ );
+
+/**
+ * Variant of computeDilatation() for coordinates in structure-of-arrays layout; the x, y, and z
+ * components of overlap point i are at [i], [numOverlapPoints+i], and [2*numOverlapPoints+i].
+ */
+void computeDilatationSoA
+(
+		const double* xOverlap,
+		const double* yOverlap,
+		int numOverlapPoints,
+		const double *mOwned,
+		const double* volumeOverlap,
+		const double* bondDamage,
+		double* dilatationOwned,
+		const int* localNeighborList,
+		int numOwnedPoints,
+        double horizon,
+        const InfluenceFunctionSelection& OMEGA,
+        double thermalExpansionCoefficient,
+        const double* deltaTemperature,
+        const BondGeometry* bondGeometry = 0
  );
 
 namespace WITH_BOND_VOLUME {
@@ -0,0 +1,109 @@
+//! \file thread_parallel.cxx
+
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include "thread_parallel.h"
+
+namespace MATERIAL_EVALUATION {
+
+int getNumKernelThreads()
+{
+#ifdef _OPENMP
+	return omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+const int* getBondOffsets
+(
+		const int* localNeighborList,
+		int numOwnedPoints,
+		ThreadScratch& scratch
+)
+{
+	if(scratch.rowOffsets != 0 && scratch.rowOffsetsList == localNeighborList)
+		return scratch.rowOffsets;
+
+	// No row offsets were provided for this list (e.g., a Jacobian workspace), so they are computed here
+	std::vector<int>& bondOffsets = scratch.bondOffsets;
+	bondOffsets.resize(numOwnedPoints+1);
+	int neighborhoodListIndex(0), bondIndex(0);
+	for(int p=0 ; p<numOwnedPoints ; p++){
+		int numNeigh = localNeighborList[neighborhoodListIndex];
+		bondOffsets[p] = bondIndex;
+		neighborhoodListIndex += numNeigh + 1;
+		bondIndex += numNeigh;
+	}
+	bondOffsets[numOwnedPoints] = bondIndex;
+	return &bondOffsets[0];
+}
+
+void partitionByBondCount
+(
+		const int* bondOffsets,
+		int numOwnedPoints,
+		int numPartitions,
+		std::vector<int>& partitionStart
+)
+{
+	partitionStart.resize(numPartitions+1);
+	int totalBonds = bondOffsets[numOwnedPoints];
+	// Weight each point by its bond count plus one, so that points without bonds still carry cost.
+	double totalWork = static_cast<double>(totalBonds + numOwnedPoints);
+	int p = 0;
+	partitionStart[0] = 0;
+	for(int part=1 ; part<numPartitions ; ++part){
+		double target = totalWork*part/numPartitions;
+		while(p < numOwnedPoints && static_cast<double>(bondOffsets[p] + p) < target)
+			p++;
+		partitionStart[part] = p;
+	}
+	partitionStart[numPartitions] = numOwnedPoints;
+}
+
+}
@@ -0,0 +1,196 @@
+//! \file thread_parallel.h
+
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+#ifndef THREAD_PARALLEL_H
+#define THREAD_PARALLEL_H
+
+#include <vector>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace MATERIAL_EVALUATION {
+
+/**
+ * Scratch storage for the thread-parallel force kernels.
+ *
+ * Each partition of the owned points accumulates its forces (including the
+ * reactions scattered to neighbors) into a private buffer of the full overlap
+ * length; the buffers are then summed into the overlap force vector.  The
+ * storage is retained between calls so that the hot loop does not allocate.
+ *
+ * The caller that owns the neighborhood list may provide its CSR row offsets
+ * (NeighborhoodData::RowOffsets()) through rowOffsetsList and rowOffsets; they
+ * are used whenever a kernel is called with that list, and are otherwise
+ * recomputed into bondOffsets.
+ */
+struct ThreadScratch {
+  ThreadScratch() : numPartitions(0), overlapLength(0), rowOffsetsList(0), rowOffsets(0) {}
+  int numPartitions;
+  int overlapLength;
+  const int* rowOffsetsList;
+  const int* rowOffsets;
+  std::vector<int> bondOffsets;
+  std::vector<int> partitionStart;
+  std::vector<double> buffers;
+};
+
+//! Returns the number of threads available to the thread-parallel kernels (1 if OpenMP is not enabled).
+int getNumKernelThreads();
+
+/**
+ * Returns, for each owned point and one past the last, the offset of its first bond in
+ * bond-level data.  The neighborhood list entry of point p (pointing at numNeighbors) is
+ * at offset bondOffsets[p] + p.  The CSR row offsets in scratch are returned if they
+ * belong to localNeighborList; otherwise the offsets are computed into scratch.bondOffsets.
+ */
+const int* getBondOffsets
+(
+		const int* localNeighborList,
+		int numOwnedPoints,
+		ThreadScratch& scratch
+);
+
+/**
+ * Splits the owned points into numPartitions contiguous ranges holding roughly
+ * equal numbers of bonds; partitionStart has numPartitions+1 entries.
+ */
+void partitionByBondCount
+(
+		const int* bondOffsets,
+		int numOwnedPoints,
+		int numPartitions,
+		std::vector<int>& partitionStart
+);
+
+/**
+ * Evaluates a force kernel over the owned points using all available threads.
+ *
+ * The kernel is called as kernel(pBegin, pEnd, neighPtr, bondOffset, fTarget), where
+ * neighPtr points at the neighborhood list entry of point pBegin, bondOffset is the
+ * index of its first bond, and fTarget is the overlap-length force array that the
+ * kernel must accumulate into (both for owned points and for neighbor reactions).
+ *
+ * The owned points are split into partitions balanced by bond count.  Each partition
+ * is evaluated by a single thread into its own buffer and the buffers are summed in
+ * partition order, so the result is bitwise reproducible from run to run for a given
+ * thread count in both modes.  With deterministic=true there is one statically
+ * scheduled partition per thread.  With deterministic=false there are four dynamically
+ * scheduled partitions per thread, which balances uneven neighborhoods better but
+ * holds four times as many overlap-length buffers.
+ */
+template<class RangeKernel>
+void evaluateThreadParallel
+(
+		const int* localNeighborList,
+		int numOwnedPoints,
+		int overlapLength,
+		double* fInternalOverlap,
+		bool deterministic,
+		ThreadScratch& scratch,
+		RangeKernel kernel
+)
+{
+	int numThreads = getNumKernelThreads();
+	int numPartitions = deterministic ? numThreads : 4*numThreads;
+	if(numOwnedPoints < numPartitions)
+		numPartitions = std::max(numOwnedPoints, 1);
+
+	const int* bondOffsets = getBondOffsets(localNeighborList, numOwnedPoints, scratch);
+	partitionByBondCount(bondOffsets, numOwnedPoints, numPartitions, scratch.partitionStart);
+	if(scratch.numPartitions != numPartitions || scratch.overlapLength != overlapLength){
+		scratch.buffers.resize((size_t)numPartitions*overlapLength);
+		scratch.numPartitions = numPartitions;
+		scratch.overlapLength = overlapLength;
+	}
+
+	const int* partitionStart = &scratch.partitionStart[0];
+	double* buffers = scratch.buffers.empty() ? 0 : &scratch.buffers[0];
+
+	if(deterministic){
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static,1)
+#endif
+		for(int part=0 ; part<numPartitions ; ++part){
+			double* fTarget = buffers + (size_t)part*overlapLength;
+			std::fill(fTarget, fTarget + overlapLength, 0.0);
+			int pBegin = partitionStart[part];
+			int pEnd = partitionStart[part+1];
+			if(pBegin < pEnd)
+				kernel(pBegin, pEnd, localNeighborList + bondOffsets[pBegin] + pBegin, bondOffsets[pBegin], fTarget);
+		}
+	}
+	else{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic,1)
+#endif
+		for(int part=0 ; part<numPartitions ; ++part){
+			double* fTarget = buffers + (size_t)part*overlapLength;
+			std::fill(fTarget, fTarget + overlapLength, 0.0);
+			int pBegin = partitionStart[part];
+			int pEnd = partitionStart[part+1];
+			if(pBegin < pEnd)
+				kernel(pBegin, pEnd, localNeighborList + bondOffsets[pBegin] + pBegin, bondOffsets[pBegin], fTarget);
+		}
+	}
+
+	// Sum the partition buffers; each entry is summed in partition order regardless of the thread that owns it.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+	for(int i=0 ; i<overlapLength ; ++i){
+		double sum = fInternalOverlap[i];
+		for(int part=0 ; part<numPartitions ; ++part)
+			sum += buffers[(size_t)part*overlapLength + i];
+		fInternalOverlap[i] = sum;
+	}
+}
+
+}
+
+#endif // THREAD_PARALLEL_H
@@ -0,0 +1,181 @@
+/*! \file utPeridigm_ElasticBondBasedMaterial.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_ElasticBondBasedMaterial.hpp"
+#include "Peridigm_SerialMatrix.hpp"
+#include "Peridigm_Field.hpp"
+#include "Peridigm_DegreesOfFreedomManager.hpp"
+#include <Epetra_SerialComm.h>
+#include <Epetra_FECrsMatrix.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Tests that the closed-form bond stiffness reproduces the finite-difference tangent on a deformed 27-cell block with damaged bonds.
+TEUCHOS_UNIT_TEST(ElasticBondBasedMaterial, analyticJacobianMatchesFiniteDifference) {
+
+  ParameterList analyticParams;
+  analyticParams.set("Density", 7800.0);
+  analyticParams.set("Bulk Modulus", 130.0e9);
+  analyticParams.set("Horizon", 10.0);
+  analyticParams.set("Finite Difference Probe Length", 1.0e-6);
+  ParameterList finiteDifferenceParams(analyticParams);
+  analyticParams.set("Apply Analytic Jacobian", true);
+  ElasticBondBasedMaterial analyticMat(analyticParams);
+  ElasticBondBasedMaterial finiteDifferenceMat(finiteDifferenceParams);
+
+  // The finite-difference Jacobian probes the displacement degrees of freedom
+  ParameterList solverParams;
+  PeridigmNS::DegreesOfFreedomManager::self().initialize(solverParams);
+
+  // 3x3x3 block, all cells are neighbors of each other; the bond data of a cell is a single block element
+  int numOwnedPoints = 27;
+  int numNeighbors = numOwnedPoints-1;
+  int numDof = 3*numOwnedPoints;
+  Epetra_SerialComm comm;
+  Epetra_Map nodeMap(numOwnedPoints, 0, comm);
+  Epetra_Map unknownMap(numDof, 0, comm);
+  Epetra_BlockMap bondMap(numOwnedPoints, numNeighbors, 0, comm);
+  double dt = 1.0;
+  vector<int> ownedIDs(numOwnedPoints);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    ownedIDs[i] = i;
+    neighborhoodList.push_back(numNeighbors);
+    for(int j=0 ; j<numOwnedPoints ; ++j){
+      if(i != j)
+        neighborhoodList.push_back(j);
+    }
+  }
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
+  int coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+  int volumeFieldId = fieldManager.getFieldId("Volume");
+  int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+  int velocityFieldId = fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Velocity");
+
+  vector<double> zeros(numDof);
+  vector<int> indices(numDof);
+  for(int i=0 ; i<numDof ; ++i)
+    indices[i] = i;
+
+  PeridigmNS::DataManager dataManagers[2];
+  ElasticBondBasedMaterial* materials[2] = { &analyticMat, &finiteDifferenceMat };
+  Teuchos::RCP<Epetra_FECrsMatrix> tangents[2];
+  for(int iMat=0 ; iMat<2 ; ++iMat){
+    PeridigmNS::DataManager& dataManager = dataManagers[iMat];
+    dataManager.setMaps(Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&bondMap, false));
+    vector<int> fieldIds = materials[iMat]->FieldIds();
+    fieldIds.push_back(velocityFieldId);
+    dataManager.allocateData(fieldIds);
+    Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& cellVolume = *dataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& bondDamage = *dataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      x[3*i]   = i%3;
+      x[3*i+1] = (i/3)%3;
+      x[3*i+2] = i/9;
+      // non-uniform deformation
+      y[3*i]   = 1.01*x[3*i] + 0.002*x[3*i+1]*x[3*i+2];
+      y[3*i+1] = 0.99*x[3*i+1];
+      y[3*i+2] = x[3*i+2] + 0.003*x[3*i]*x[3*i];
+      cellVolume[i] = 1.0 + 0.01*i;
+    }
+    // partially damaged and broken bonds
+    for(int i=0 ; i<bondDamage.MyLength() ; ++i)
+      bondDamage[i] = (i%7 == 0) ? 1.0 : ((i%5 == 0) ? 0.5 : 0.0);
+
+    // dense tangent, every cell interacts with every other cell
+    tangents[iMat] = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, unknownMap, 0, false));
+    for(int i=0 ; i<numDof ; ++i){
+      int err = tangents[iMat]->InsertGlobalValues(i, numDof, (const double*)&zeros[0], (const int*)&indices[0]);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** InsertGlobalValues() returned negative error code.\n");
+    }
+    int err = tangents[iMat]->GlobalAssemble();
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** GlobalAssemble() returned nonzero error code.\n");
+    PeridigmNS::SerialMatrix tangentSerialMatrix(tangents[iMat]);
+
+    materials[iMat]->initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+    materials[iMat]->computeJacobian(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager, tangentSerialMatrix);
+  }
+
+  vector<double> analyticRow(numDof), finiteDifferenceRow(numDof);
+  vector<int> analyticIndices(numDof), finiteDifferenceIndices(numDof);
+  double maxEntry(0.0), maxDifference(0.0);
+  for(int i=0 ; i<numDof ; ++i){
+    int numAnalytic, numFiniteDifference;
+    tangents[0]->ExtractGlobalRowCopy(i, numDof, numAnalytic, &analyticRow[0], &analyticIndices[0]);
+    tangents[1]->ExtractGlobalRowCopy(i, numDof, numFiniteDifference, &finiteDifferenceRow[0], &finiteDifferenceIndices[0]);
+    TEST_EQUALITY(numAnalytic, numFiniteDifference);
+    for(int j=0 ; j<numAnalytic ; ++j){
+      TEST_EQUALITY(analyticIndices[j], finiteDifferenceIndices[j]);
+      maxEntry = std::max(maxEntry, std::fabs(finiteDifferenceRow[j]));
+      maxDifference = std::max(maxDifference, std::fabs(analyticRow[j] - finiteDifferenceRow[j]));
+    }
+  }
+  TEST_COMPARE(maxEntry, >, 0.0);
+  TEST_COMPARE(maxDifference, <=, 1.0e-6*maxEntry);
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
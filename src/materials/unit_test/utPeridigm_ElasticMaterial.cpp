@@ -51,8 +51,13 @@
 #include "Peridigm_ElasticMaterial.hpp"
 #include "Peridigm_SerialMatrix.hpp"
 #include "Peridigm_Field.hpp"
+#include "Peridigm_DegreesOfFreedomManager.hpp"
+#include "bond_geometry.h"
 #include <Epetra_SerialComm.h>
 #include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 
 using namespace std;
@@ -841,6 +846,536 @@ TEUCHOS_UNIT_TEST(ElasticMaterial, twoPointTangentStiffnessMatrixJAM) {
 //   jacobian.print(cout);
 }
 
+//! Tests that the thread-parallel force evaluation reproduces the serial result on a 27-cell block.
+
+TEUCHOS_UNIT_TEST(ElasticMaterial, threadParallelForce) {
+
+  ParameterList serialParams;
+  serialParams.set("Density", 7800.0);
+  serialParams.set("Bulk Modulus", 130.0e9);
+  serialParams.set("Shear Modulus", 78.0e9);
+  serialParams.set("Horizon", 10.0);
+  ParameterList threadedParams(serialParams);
+  threadedParams.set("Thread Parallel Force Evaluation", true);
+  threadedParams.set("Deterministic Threading", true);
+  ElasticMaterial serialMat(serialParams);
+  ElasticMaterial threadedMat(threadedParams);
+
+  // 3x3x3 block, all cells are neighbors of each other
+  int numOwnedPoints = 27;
+  Epetra_SerialComm comm;
+  Epetra_Map nodeMap(numOwnedPoints, 0, comm);
+  Epetra_Map unknownMap(3*numOwnedPoints, 0, comm);
+  Epetra_Map bondMap(numOwnedPoints*(numOwnedPoints-1), 0, comm);
+  double dt = 1.0;
+  vector<int> ownedIDs(numOwnedPoints);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    ownedIDs[i] = i;
+    neighborhoodList.push_back(numOwnedPoints-1);
+    for(int j=0 ; j<numOwnedPoints ; ++j){
+      if(i != j)
+        neighborhoodList.push_back(j);
+    }
+  }
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
+  int coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+  int volumeFieldId = fieldManager.getFieldId("Volume");
+  int forceDensityFieldId = fieldManager.getFieldId("Force_Density");
+
+  PeridigmNS::DataManager serialDataManager, threadedDataManager;
+  PeridigmNS::DataManager* dataManagers[2] = { &serialDataManager, &threadedDataManager };
+  ElasticMaterial* materials[2] = { &serialMat, &threadedMat };
+  for(int iMat=0 ; iMat<2 ; ++iMat){
+    PeridigmNS::DataManager& dataManager = *dataManagers[iMat];
+    dataManager.setMaps(Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&bondMap, false));
+    dataManager.allocateData(materials[iMat]->FieldIds());
+    Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& cellVolume = *dataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      x[3*i]   = i%3;
+      x[3*i+1] = (i/3)%3;
+      x[3*i+2] = i/9;
+      // non-uniform deformation
+      y[3*i]   = 1.01*x[3*i] + 0.002*x[3*i+1]*x[3*i+2];
+      y[3*i+1] = 0.99*x[3*i+1];
+      y[3*i+2] = x[3*i+2] + 0.003*x[3*i]*x[3*i];
+      cellVolume[i] = 1.0;
+    }
+    materials[iMat]->initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+    materials[iMat]->computeForce(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+  }
+
+  Epetra_Vector& serialForce = *serialDataManager.getData(forceDensityFieldId, PeridigmField::STEP_NP1);
+  Epetra_Vector& threadedForce = *threadedDataManager.getData(forceDensityFieldId, PeridigmField::STEP_NP1);
+  double maxForce(0.0), maxDifference(0.0);
+  for(int i=0 ; i<serialForce.MyLength() ; ++i){
+    maxForce = std::max(maxForce, std::fabs(serialForce[i]));
+    maxDifference = std::max(maxDifference, std::fabs(serialForce[i] - threadedForce[i]));
+  }
+  TEST_COMPARE(maxForce, >, 0.0);
+  TEST_COMPARE(maxDifference, <=, 1.0e-12*maxForce);
+
+  // Row offsets provided for the neighbor list, as ModelEvaluator does with the block's CSR layout, give the same result
+  vector<int> rowOffsets(numOwnedPoints+1);
+  for(int i=0 ; i<=numOwnedPoints ; ++i)
+    rowOffsets[i] = i*(numOwnedPoints-1);
+  Epetra_Vector threadedForceWithoutRowOffsets(threadedForce);
+  threadedMat.setNeighborhoodRowOffsets(&neighborhoodList[0], &rowOffsets[0]);
+  threadedMat.computeForce(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], threadedDataManager);
+  threadedMat.setNeighborhoodRowOffsets(0, 0);
+  for(int i=0 ; i<threadedForce.MyLength() ; ++i)
+    TEST_EQUALITY(threadedForce[i], threadedForceWithoutRowOffsets[i]);
+}
+
+//! Tests that the force evaluation on structure-of-arrays coordinates reproduces the interleaved result on a 27-cell block.
+
+TEUCHOS_UNIT_TEST(ElasticMaterial, structureOfArraysForce) {
+
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 10.0);
+  ParameterList uncachedParams(params);
+  uncachedParams.set("Cache Bond Geometry", false);
+  ElasticMaterial interleavedMat(params);
+  ElasticMaterial soaMat(params);
+  ElasticMaterial soaUncachedMat(uncachedParams);
+
+  // 3x3x3 block, all cells are neighbors of each other
+  int numOwnedPoints = 27;
+  Epetra_SerialComm comm;
+  Epetra_Map nodeMap(numOwnedPoints, 0, comm);
+  Epetra_Map unknownMap(3*numOwnedPoints, 0, comm);
+  Epetra_Map bondMap(numOwnedPoints*(numOwnedPoints-1), 0, comm);
+  double dt = 1.0;
+  vector<int> ownedIDs(numOwnedPoints);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    ownedIDs[i] = i;
+    neighborhoodList.push_back(numOwnedPoints-1);
+    for(int j=0 ; j<numOwnedPoints ; ++j){
+      if(i != j)
+        neighborhoodList.push_back(j);
+    }
+  }
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
+  int coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+  int volumeFieldId = fieldManager.getFieldId("Volume");
+  int forceDensityFieldId = fieldManager.getFieldId("Force_Density");
+  vector<int> soaFieldIds;
+  soaFieldIds.push_back(modelCoordinatesFieldId);
+  soaFieldIds.push_back(coordinatesFieldId);
+  soaFieldIds.push_back(forceDensityFieldId);
+
+  PeridigmNS::DataManager dataManagers[3];
+  ElasticMaterial* materials[3] = { &interleavedMat, &soaMat, &soaUncachedMat };
+  for(int iMat=0 ; iMat<3 ; ++iMat){
+    PeridigmNS::DataManager& dataManager = dataManagers[iMat];
+    dataManager.setMaps(Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&bondMap, false));
+    dataManager.allocateData(materials[iMat]->FieldIds());
+    Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& cellVolume = *dataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      x[3*i]   = i%3;
+      x[3*i+1] = (i/3)%3;
+      x[3*i+2] = i/9;
+      // non-uniform deformation
+      y[3*i]   = 1.01*x[3*i] + 0.002*x[3*i+1]*x[3*i+2];
+      y[3*i+1] = 0.99*x[3*i+1];
+      y[3*i+2] = x[3*i+2] + 0.003*x[3*i]*x[3*i];
+      cellVolume[i] = 1.0;
+    }
+    if(iMat > 0){
+      dataManager.setStructureOfArraysFieldIds(soaFieldIds);
+      TEST_ASSERT(dataManager.hasStructureOfArraysData(coordinatesFieldId, PeridigmField::STEP_NP1));
+      TEST_FLOATING_EQUALITY(dataManager.getStructureOfArraysData(coordinatesFieldId, PeridigmField::STEP_NP1)[numOwnedPoints+5], y[3*5+1], 1.0e-15);
+    }
+    materials[iMat]->initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+    materials[iMat]->computeForce(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+  }
+
+  Epetra_Vector& interleavedForce = *dataManagers[0].getData(forceDensityFieldId, PeridigmField::STEP_NP1);
+  for(int iMat=1 ; iMat<3 ; ++iMat){
+    Epetra_Vector& soaForce = *dataManagers[iMat].getData(forceDensityFieldId, PeridigmField::STEP_NP1);
+    double maxForce(0.0), maxDifference(0.0);
+    for(int i=0 ; i<interleavedForce.MyLength() ; ++i){
+      maxForce = std::max(maxForce, std::fabs(interleavedForce[i]));
+      maxDifference = std::max(maxDifference, std::fabs(interleavedForce[i] - soaForce[i]));
+    }
+    TEST_COMPARE(maxForce, >, 0.0);
+    TEST_COMPARE(maxDifference, <=, 1.0e-12*maxForce);
+  }
+}
+
+//! Tests that the closed-form tangent reproduces the automatic-differentiation tangent on a deformed 27-cell block.
+TEUCHOS_UNIT_TEST(ElasticMaterial, analyticJacobianMatchesAutomaticDifferentiation) {
+
+  ParameterList analyticParams;
+  analyticParams.set("Density", 7800.0);
+  analyticParams.set("Bulk Modulus", 130.0e9);
+  analyticParams.set("Shear Modulus", 78.0e9);
+  analyticParams.set("Horizon", 10.0);
+  ParameterList automaticDifferentiationParams(analyticParams);
+  analyticParams.set("Apply Analytic Jacobian", true);
+  ElasticMaterial analyticMat(analyticParams);
+  ElasticMaterial automaticDifferentiationMat(automaticDifferentiationParams);
+
+  // 3x3x3 block, all cells are neighbors of each other; the bond data of a cell is a single block element
+  int numOwnedPoints = 27;
+  int numNeighbors = numOwnedPoints-1;
+  int numDof = 3*numOwnedPoints;
+  Epetra_SerialComm comm;
+  Epetra_Map nodeMap(numOwnedPoints, 0, comm);
+  Epetra_Map unknownMap(numDof, 0, comm);
+  Epetra_BlockMap bondMap(numOwnedPoints, numNeighbors, 0, comm);
+  double dt = 1.0;
+  vector<int> ownedIDs(numOwnedPoints);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    ownedIDs[i] = i;
+    neighborhoodList.push_back(numNeighbors);
+    for(int j=0 ; j<numOwnedPoints ; ++j){
+      if(i != j)
+        neighborhoodList.push_back(j);
+    }
+  }
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
+  int coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+  int volumeFieldId = fieldManager.getFieldId("Volume");
+
+  vector<double> zeros(numDof);
+  vector<int> indices(numDof);
+  for(int i=0 ; i<numDof ; ++i)
+    indices[i] = i;
+
+  PeridigmNS::DataManager dataManagers[2];
+  ElasticMaterial* materials[2] = { &analyticMat, &automaticDifferentiationMat };
+  Teuchos::RCP<Epetra_FECrsMatrix> tangents[2];
+  for(int iMat=0 ; iMat<2 ; ++iMat){
+    PeridigmNS::DataManager& dataManager = dataManagers[iMat];
+    dataManager.setMaps(Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&bondMap, false));
+    dataManager.allocateData(materials[iMat]->FieldIds());
+    Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& cellVolume = *dataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      x[3*i]   = i%3;
+      x[3*i+1] = (i/3)%3;
+      x[3*i+2] = i/9;
+      // non-uniform deformation
+      y[3*i]   = 1.01*x[3*i] + 0.002*x[3*i+1]*x[3*i+2];
+      y[3*i+1] = 0.99*x[3*i+1];
+      y[3*i+2] = x[3*i+2] + 0.003*x[3*i]*x[3*i];
+      cellVolume[i] = 1.0;
+    }
+
+    // dense tangent, every cell interacts with every other cell
+    tangents[iMat] = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, unknownMap, 0, false));
+    for(int i=0 ; i<numDof ; ++i){
+      int err = tangents[iMat]->InsertGlobalValues(i, numDof, (const double*)&zeros[0], (const int*)&indices[0]);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** InsertGlobalValues() returned negative error code.\n");
+    }
+    int err = tangents[iMat]->GlobalAssemble();
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** GlobalAssemble() returned nonzero error code.\n");
+    PeridigmNS::SerialMatrix tangentSerialMatrix(tangents[iMat]);
+
+    materials[iMat]->initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+    materials[iMat]->computeJacobian(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager, tangentSerialMatrix);
+  }
+
+  vector<double> analyticRow(numDof), automaticDifferentiationRow(numDof);
+  vector<int> analyticIndices(numDof), automaticDifferentiationIndices(numDof);
+  double maxEntry(0.0), maxDifference(0.0);
+  for(int i=0 ; i<numDof ; ++i){
+    int numAnalytic, numAutomaticDifferentiation;
+    tangents[0]->ExtractGlobalRowCopy(i, numDof, numAnalytic, &analyticRow[0], &analyticIndices[0]);
+    tangents[1]->ExtractGlobalRowCopy(i, numDof, numAutomaticDifferentiation, &automaticDifferentiationRow[0], &automaticDifferentiationIndices[0]);
+    TEST_EQUALITY(numAnalytic, numAutomaticDifferentiation);
+    for(int j=0 ; j<numAnalytic ; ++j){
+      TEST_EQUALITY(analyticIndices[j], automaticDifferentiationIndices[j]);
+      maxEntry = std::max(maxEntry, std::fabs(automaticDifferentiationRow[j]));
+      maxDifference = std::max(maxDifference, std::fabs(analyticRow[j] - automaticDifferentiationRow[j]));
+    }
+  }
+  TEST_COMPARE(maxEntry, >, 0.0);
+  TEST_COMPARE(maxDifference, <=, 1.0e-8*maxEntry);
+}
+
+//! Tests that the closed-form tangent reproduces the finite-difference tangent with damaged bonds and thermal strain.
+TEUCHOS_UNIT_TEST(ElasticMaterial, analyticJacobianMatchesFiniteDifference) {
+
+  ParameterList analyticParams;
+  analyticParams.set("Density", 7800.0);
+  analyticParams.set("Bulk Modulus", 130.0e9);
+  analyticParams.set("Shear Modulus", 78.0e9);
+  analyticParams.set("Horizon", 10.0);
+  analyticParams.set("Thermal Expansion Coefficient", 1.0e-5);
+  analyticParams.set("Finite Difference Probe Length", 1.0e-6);
+  ParameterList finiteDifferenceParams(analyticParams);
+  finiteDifferenceParams.set("Apply Automatic Differentiation Jacobian", false);
+  analyticParams.set("Apply Analytic Jacobian", true);
+  ElasticMaterial analyticMat(analyticParams);
+  ElasticMaterial finiteDifferenceMat(finiteDifferenceParams);
+
+  // The finite-difference Jacobian probes the displacement degrees of freedom
+  PeridigmNS::DegreesOfFreedomManager& dofManager = PeridigmNS::DegreesOfFreedomManager::self();
+  if(dofManager.totalNumberOfDegreesOfFreedom() == 0){
+    ParameterList solverParams;
+    dofManager.initialize(solverParams);
+  }
+
+  // 3x3x3 block, all cells are neighbors of each other; the bond data of a cell is a single block element
+  int numOwnedPoints = 27;
+  int numNeighbors = numOwnedPoints-1;
+  int numDof = 3*numOwnedPoints;
+  Epetra_SerialComm comm;
+  Epetra_Map nodeMap(numOwnedPoints, 0, comm);
+  Epetra_Map unknownMap(numDof, 0, comm);
+  Epetra_BlockMap bondMap(numOwnedPoints, numNeighbors, 0, comm);
+  double dt = 1.0;
+  vector<int> ownedIDs(numOwnedPoints);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    ownedIDs[i] = i;
+    neighborhoodList.push_back(numNeighbors);
+    for(int j=0 ; j<numOwnedPoints ; ++j){
+      if(i != j)
+        neighborhoodList.push_back(j);
+    }
+  }
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
+  int coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+  int volumeFieldId = fieldManager.getFieldId("Volume");
+  int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+  int deltaTemperatureFieldId = fieldManager.getFieldId("Temperature_Change");
+  int velocityFieldId = fieldManager.getFieldId(PeridigmField::NODE, PeridigmField::VECTOR, PeridigmField::TWO_STEP, "Velocity");
+
+  vector<double> zeros(numDof);
+  vector<int> indices(numDof);
+  for(int i=0 ; i<numDof ; ++i)
+    indices[i] = i;
+
+  PeridigmNS::DataManager dataManagers[2];
+  ElasticMaterial* materials[2] = { &analyticMat, &finiteDifferenceMat };
+  Teuchos::RCP<Epetra_FECrsMatrix> tangents[2];
+  for(int iMat=0 ; iMat<2 ; ++iMat){
+    PeridigmNS::DataManager& dataManager = dataManagers[iMat];
+    dataManager.setMaps(Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&bondMap, false));
+    vector<int> fieldIds = materials[iMat]->FieldIds();
+    fieldIds.push_back(velocityFieldId);
+    dataManager.allocateData(fieldIds);
+    Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& cellVolume = *dataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& bondDamage = *dataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& deltaTemperature = *dataManager.getData(deltaTemperatureFieldId, PeridigmField::STEP_NP1);
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      x[3*i]   = i%3;
+      x[3*i+1] = (i/3)%3;
+      x[3*i+2] = i/9;
+      // non-uniform deformation
+      y[3*i]   = 1.01*x[3*i] + 0.002*x[3*i+1]*x[3*i+2];
+      y[3*i+1] = 0.99*x[3*i+1];
+      y[3*i+2] = x[3*i+2] + 0.003*x[3*i]*x[3*i];
+      cellVolume[i] = 1.0;
+      deltaTemperature[i] = 20.0 + 5.0*i;
+    }
+    // partially damaged and broken bonds
+    for(int i=0 ; i<bondDamage.MyLength() ; ++i)
+      bondDamage[i] = (i%7 == 0) ? 1.0 : ((i%5 == 0) ? 0.5 : 0.0);
+
+    // dense tangent, every cell interacts with every other cell
+    tangents[iMat] = Teuchos::rcp(new Epetra_FECrsMatrix(Copy, unknownMap, 0, false));
+    for(int i=0 ; i<numDof ; ++i){
+      int err = tangents[iMat]->InsertGlobalValues(i, numDof, (const double*)&zeros[0], (const int*)&indices[0]);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(err < 0, "**** InsertGlobalValues() returned negative error code.\n");
+    }
+    int err = tangents[iMat]->GlobalAssemble();
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "**** GlobalAssemble() returned nonzero error code.\n");
+    PeridigmNS::SerialMatrix tangentSerialMatrix(tangents[iMat]);
+
+    materials[iMat]->initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+    materials[iMat]->computeJacobian(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager, tangentSerialMatrix);
+  }
+
+  vector<double> analyticRow(numDof), finiteDifferenceRow(numDof);
+  vector<int> analyticIndices(numDof), finiteDifferenceIndices(numDof);
+  double maxEntry(0.0), maxDifference(0.0);
+  for(int i=0 ; i<numDof ; ++i){
+    int numAnalytic, numFiniteDifference;
+    tangents[0]->ExtractGlobalRowCopy(i, numDof, numAnalytic, &analyticRow[0], &analyticIndices[0]);
+    tangents[1]->ExtractGlobalRowCopy(i, numDof, numFiniteDifference, &finiteDifferenceRow[0], &finiteDifferenceIndices[0]);
+    TEST_EQUALITY(numAnalytic, numFiniteDifference);
+    for(int j=0 ; j<numAnalytic ; ++j){
+      TEST_EQUALITY(analyticIndices[j], finiteDifferenceIndices[j]);
+      maxEntry = std::max(maxEntry, std::fabs(finiteDifferenceRow[j]));
+      maxDifference = std::max(maxDifference, std::fabs(analyticRow[j] - finiteDifferenceRow[j]));
+    }
+  }
+  TEST_COMPARE(maxEntry, >, 0.0);
+  TEST_COMPARE(maxDifference, <=, 1.0e-6*maxEntry);
+}
+
+//! Tests that "Apply Analytic Jacobian" and "Apply Automatic Differentiation Jacobian" cannot both be requested.
+TEUCHOS_UNIT_TEST(ElasticMaterial, jacobianSelection) {
+
+  ParameterList params;
+  params.set("Density", 7800.0);
+  params.set("Bulk Modulus", 130.0e9);
+  params.set("Shear Modulus", 78.0e9);
+  params.set("Horizon", 10.0);
+
+  ParameterList automaticDifferentiationParams(params);
+  automaticDifferentiationParams.set("Apply Automatic Differentiation Jacobian", true);
+  TEST_NOTHROW(ElasticMaterial mat(automaticDifferentiationParams));
+
+  ParameterList analyticParams(params);
+  analyticParams.set("Apply Analytic Jacobian", true);
+  TEST_NOTHROW(ElasticMaterial mat(analyticParams));
+
+  ParameterList conflictingParams(automaticDifferentiationParams);
+  conflictingParams.set("Apply Analytic Jacobian", true);
+  TEST_THROW(ElasticMaterial mat(conflictingParams), std::logic_error);
+}
+
+//! Tests that the cached bond geometry reproduces the uncached kernels, serial and threaded, with damage, thermal strain, and neighbors beyond the horizon.
+TEUCHOS_UNIT_TEST(ElasticMaterial, cachedBondGeometry) {
+
+  ParameterList cachedParams;
+  cachedParams.set("Density", 7800.0);
+  cachedParams.set("Bulk Modulus", 130.0e9);
+  cachedParams.set("Shear Modulus", 78.0e9);
+  cachedParams.set("Horizon", 1.5);
+  cachedParams.set("Thermal Expansion Coefficient", 1.0e-5);
+  cachedParams.set("Cache Bond Geometry", true);
+  ParameterList uncachedParams(cachedParams);
+  uncachedParams.set("Cache Bond Geometry", false);
+  ParameterList cachedThreadedParams(cachedParams);
+  cachedThreadedParams.set("Thread Parallel Force Evaluation", true);
+  cachedThreadedParams.set("Deterministic Threading", true);
+  ParameterList uncachedThreadedParams(cachedThreadedParams);
+  uncachedThreadedParams.set("Cache Bond Geometry", false);
+  ElasticMaterial uncachedMat(uncachedParams);
+  ElasticMaterial cachedMat(cachedParams);
+  ElasticMaterial uncachedThreadedMat(uncachedThreadedParams);
+  ElasticMaterial cachedThreadedMat(cachedThreadedParams);
+
+  // 3x3x3 block, every cell is in the neighbor list of every other one, but only the nearest lie within the horizon
+  int numOwnedPoints = 27;
+  Epetra_SerialComm comm;
+  Epetra_Map nodeMap(numOwnedPoints, 0, comm);
+  Epetra_Map unknownMap(3*numOwnedPoints, 0, comm);
+  Epetra_Map bondMap(numOwnedPoints*(numOwnedPoints-1), 0, comm);
+  double dt = 1.0;
+  vector<int> ownedIDs(numOwnedPoints);
+  vector<int> neighborhoodList;
+  for(int i=0 ; i<numOwnedPoints ; ++i){
+    ownedIDs[i] = i;
+    neighborhoodList.push_back(numOwnedPoints-1);
+    for(int j=0 ; j<numOwnedPoints ; ++j){
+      if(i != j)
+        neighborhoodList.push_back(j);
+    }
+  }
+
+  PeridigmNS::FieldManager& fieldManager = PeridigmNS::FieldManager::self();
+  int modelCoordinatesFieldId = fieldManager.getFieldId("Model_Coordinates");
+  int coordinatesFieldId = fieldManager.getFieldId("Coordinates");
+  int volumeFieldId = fieldManager.getFieldId("Volume");
+  int weightedVolumeFieldId = fieldManager.getFieldId("Weighted_Volume");
+  int dilatationFieldId = fieldManager.getFieldId("Dilatation");
+  int bondDamageFieldId = fieldManager.getFieldId("Bond_Damage");
+  int deltaTemperatureFieldId = fieldManager.getFieldId("Temperature_Change");
+  int forceDensityFieldId = fieldManager.getFieldId("Force_Density");
+
+  PeridigmNS::DataManager dataManagers[4];
+  ElasticMaterial* materials[4] = { &uncachedMat, &cachedMat, &uncachedThreadedMat, &cachedThreadedMat };
+  for(int iMat=0 ; iMat<4 ; ++iMat){
+    PeridigmNS::DataManager& dataManager = dataManagers[iMat];
+    dataManager.setMaps(Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&nodeMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&unknownMap, false),
+                        Teuchos::rcp(&bondMap, false));
+    dataManager.allocateData(materials[iMat]->FieldIds());
+    Epetra_Vector& x = *dataManager.getData(modelCoordinatesFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& y = *dataManager.getData(coordinatesFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& cellVolume = *dataManager.getData(volumeFieldId, PeridigmField::STEP_NONE);
+    Epetra_Vector& bondDamage = *dataManager.getData(bondDamageFieldId, PeridigmField::STEP_NP1);
+    Epetra_Vector& deltaTemperature = *dataManager.getData(deltaTemperatureFieldId, PeridigmField::STEP_NP1);
+    for(int i=0 ; i<numOwnedPoints ; ++i){
+      x[3*i]   = i%3;
+      x[3*i+1] = (i/3)%3;
+      x[3*i+2] = i/9;
+      // non-uniform deformation
+      y[3*i]   = 1.01*x[3*i] + 0.002*x[3*i+1]*x[3*i+2];
+      y[3*i+1] = 0.99*x[3*i+1];
+      y[3*i+2] = x[3*i+2] + 0.003*x[3*i]*x[3*i];
+      cellVolume[i] = 1.0 + 0.01*i;
+      deltaTemperature[i] = 20.0 + 5.0*i;
+    }
+    // partially damaged and broken bonds
+    for(int i=0 ; i<bondDamage.MyLength() ; ++i)
+      bondDamage[i] = (i%7 == 0) ? 1.0 : ((i%5 == 0) ? 0.5 : 0.0);
+    materials[iMat]->initialize(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+    materials[iMat]->computeForce(dt, numOwnedPoints, &ownedIDs[0], &neighborhoodList[0], dataManager);
+  }
+
+  int fieldIds[3] = { weightedVolumeFieldId, dilatationFieldId, forceDensityFieldId };
+  PeridigmField::Step steps[3] = { PeridigmField::STEP_NONE, PeridigmField::STEP_NP1, PeridigmField::STEP_NP1 };
+  for(int iField=0 ; iField<3 ; ++iField){
+    Epetra_Vector& reference = *dataManagers[0].getData(fieldIds[iField], steps[iField]);
+    for(int iMat=1 ; iMat<4 ; ++iMat){
+      Epetra_Vector& values = *dataManagers[iMat].getData(fieldIds[iField], steps[iField]);
+      double maxValue(0.0), maxDifference(0.0);
+      for(int i=0 ; i<reference.MyLength() ; ++i){
+        maxValue = std::max(maxValue, std::fabs(reference[i]));
+        maxDifference = std::max(maxDifference, std::fabs(reference[i] - values[i]));
+      }
+      TEST_COMPARE(maxValue, >, 0.0);
+      TEST_COMPARE(maxDifference, <=, 1.0e-12*maxValue);
+    }
+  }
+
+  // Offsetting a geometry leaves the quantities that are not cached null
+  vector<double> referenceLength(4, 1.0);
+  MATERIAL_EVALUATION::BondGeometry bondGeometry;
+  bondGeometry.referenceLength = &referenceLength[0];
+  MATERIAL_EVALUATION::BondGeometry rangeGeometry = bondGeometry.offset(3);
+  TEST_ASSERT(rangeGeometry.referenceLength == &referenceLength[3]);
+  TEST_ASSERT(rangeGeometry.inverseReferenceLength == 0);
+  TEST_ASSERT(rangeGeometry.influenceFunctionValue == 0);
+  TEST_ASSERT(rangeGeometry.neighborVolume == 0);
+}
+
 int main
 (int argc, char* argv[])
 {
@@ -0,0 +1,193 @@
+/*! \file utPeridigm_InfluenceFunctionPolicies.cpp */
+
+//@HEADER
+// ************************************************************************
+//
+//                             Peridigm
+//                 Copyright (2011) Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions?
+// David J. Littlewood   djlittl@sandia.gov
+// John A. Mitchell      jamitch@sandia.gov
+// Michael L. Parks      mlparks@sandia.gov
+// Stewart A. Silling    sasilli@sandia.gov
+//
+// ************************************************************************
+//@HEADER
+
+#include <Teuchos_UnitTestHarness.hpp>
+#include "Teuchos_UnitTestRepository.hpp"
+#include "Peridigm_InfluenceFunction.hpp"
+#include "material_utilities.h"
+#include "elastic.h"
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace PeridigmNS;
+using namespace Teuchos;
+
+//! Small irregular point cloud in which every point is bonded to every other point.
+struct PointCloud {
+  PointCloud() : numPoints(6), horizon(1.6) {
+    double coordinates[] = { 0.0,  0.0,  0.0,
+                             0.5,  0.1, -0.2,
+                            -0.3,  0.6,  0.1,
+                             0.2, -0.4,  0.7,
+                             0.9,  0.5,  0.3,
+                            -0.6, -0.2, -0.5 };
+    x.assign(coordinates, coordinates + 3*numPoints);
+    y.resize(3*numPoints);
+    for(int i=0 ; i<3*numPoints ; ++i)
+      y[i] = 1.01*x[i] + 0.002*(i%5);
+    volume.resize(numPoints);
+    for(int i=0 ; i<numPoints ; ++i)
+      volume[i] = 0.1 + 0.01*i;
+    for(int i=0 ; i<numPoints ; ++i){
+      neighborhoodList.push_back(numPoints-1);
+      for(int j=0 ; j<numPoints ; ++j)
+        if(j != i)
+          neighborhoodList.push_back(j);
+    }
+    numBonds = numPoints*(numPoints-1);
+    bondDamage.assign(numBonds, 0.0);
+    bondDamage[3] = 0.5;
+    bondDamage[7] = 1.0;
+    deltaTemperature.resize(numPoints);
+    for(int i=0 ; i<numPoints ; ++i)
+      deltaTemperature[i] = 10.0*i;
+  }
+
+  //! Copies an interleaved vector into structure-of-arrays layout.
+  vector<double> toSoA(const vector<double>& v) const {
+    vector<double> soa(v.size());
+    for(int i=0 ; i<numPoints ; ++i)
+      for(int d=0 ; d<3 ; ++d)
+        soa[d*numPoints+i] = v[3*i+d];
+    return soa;
+  }
+
+  int numPoints;
+  int numBonds;
+  double horizon;
+  vector<double> x, y, volume, bondDamage, deltaTemperature;
+  vector<int> neighborhoodList;
+};
+
+//! The weighted volume, dilatation and force computed with the compile-time policy of each
+//! built-in influence function must match the same kernels called through the function pointer.
+TEUCHOS_UNIT_TEST(InfluenceFunction, PoliciesMatchFunctionPointer) {
+
+  const double relTolerance = 1.0e-13;
+  const double alpha = 1.0e-5;
+  const double bulkModulus = 130.0e9;
+  const double shearModulus = 78.0e9;
+  PointCloud cloud;
+  int N = cloud.numPoints;
+  const int* neighborhoodList = &cloud.neighborhoodList[0];
+  vector<double> xSoA = cloud.toSoA(cloud.x), ySoA = cloud.toSoA(cloud.y);
+
+  const char* names[] = { "One", "Parabolic Decay", "Gaussian" };
+  const InfluenceFunction::Type types[] = { InfluenceFunction::ONE, InfluenceFunction::PARABOLIC_DECAY, InfluenceFunction::GAUSSIAN };
+
+  for(int f=0 ; f<3 ; ++f){
+
+    InfluenceFunction::self().setInfluenceFunction(names[f]);
+    InfluenceFunction::functionPointer omega = InfluenceFunction::self().getInfluenceFunction();
+    InfluenceFunction::Selection policySelection(omega);
+    TEST_EQUALITY(policySelection.type, types[f]);
+    // Forcing USER_DEFINED selects FunctionPointerPolicy for the same function
+    InfluenceFunction::Selection pointerSelection(omega, InfluenceFunction::USER_DEFINED);
+
+    vector<InfluenceFunction::Selection> selections;
+    selections.push_back(policySelection);
+    selections.push_back(pointerSelection);
+
+    vector< vector<double> > m(2), mPoint(2), theta(2), thetaSoA(2), force(2), forceSoA(2);
+    for(int s=0 ; s<2 ; ++s){
+      m[s].resize(N);
+      MATERIAL_EVALUATION::computeWeightedVolume(&cloud.x[0],&cloud.volume[0],&m[s][0],N,neighborhoodList,cloud.horizon,selections[s]);
+
+      mPoint[s].resize(N);
+      const int* neighPtr = neighborhoodList;
+      for(int i=0 ; i<N ; ++i){
+        mPoint[s][i] = MATERIAL_EVALUATION::computeWeightedVolume(&cloud.x[3*i],&cloud.x[0],&cloud.volume[0],neighPtr,cloud.horizon,selections[s]);
+        neighPtr += *neighPtr + 1;
+      }
+
+      theta[s].resize(N);
+      MATERIAL_EVALUATION::computeDilatation(&cloud.x[0],&cloud.y[0],&m[s][0],&cloud.volume[0],&cloud.bondDamage[0],&theta[s][0],
+                                             neighborhoodList,N,cloud.horizon,selections[s],alpha,&cloud.deltaTemperature[0]);
+      thetaSoA[s].resize(N);
+      MATERIAL_EVALUATION::computeDilatationSoA(&xSoA[0],&ySoA[0],N,&m[s][0],&cloud.volume[0],&cloud.bondDamage[0],&thetaSoA[s][0],
+                                                neighborhoodList,N,cloud.horizon,selections[s],alpha,&cloud.deltaTemperature[0]);
+
+      force[s].assign(3*N, 0.0);
+      MATERIAL_EVALUATION::computeInternalForceLinearElastic(&cloud.x[0],&cloud.y[0],&m[s][0],&cloud.volume[0],&theta[s][0],&cloud.bondDamage[0],
+                                                             &force[s][0],(double*)0,neighborhoodList,N,bulkModulus,shearModulus,
+                                                             cloud.horizon,selections[s],alpha,&cloud.deltaTemperature[0]);
+      forceSoA[s].assign(3*N, 0.0);
+      MATERIAL_EVALUATION::computeInternalForceLinearElasticSoA(&xSoA[0],&ySoA[0],N,&m[s][0],&cloud.volume[0],&thetaSoA[s][0],&cloud.bondDamage[0],
+                                                                &forceSoA[s][0],neighborhoodList,N,bulkModulus,shearModulus,
+                                                                cloud.horizon,selections[s],alpha,&cloud.deltaTemperature[0]);
+    }
+
+    for(int i=0 ; i<N ; ++i){
+      TEST_FLOATING_EQUALITY(m[0][i], m[1][i], relTolerance);
+      TEST_FLOATING_EQUALITY(mPoint[0][i], m[1][i], relTolerance);
+      TEST_FLOATING_EQUALITY(mPoint[1][i], m[1][i], relTolerance);
+      TEST_FLOATING_EQUALITY(theta[0][i], theta[1][i], relTolerance);
+      TEST_FLOATING_EQUALITY(thetaSoA[0][i], theta[1][i], relTolerance);
+      TEST_FLOATING_EQUALITY(thetaSoA[1][i], theta[1][i], relTolerance);
+    }
+    for(int i=0 ; i<3*N ; ++i){
+      TEST_FLOATING_EQUALITY(force[0][i], force[1][i], relTolerance);
+      TEST_FLOATING_EQUALITY(forceSoA[0][i], forceSoA[1][i], relTolerance);
+    }
+    // The SoA force is stored component-wise
+    vector<double> forceFromSoA(3*N);
+    for(int i=0 ; i<N ; ++i)
+      for(int d=0 ; d<3 ; ++d)
+        forceFromSoA[3*i+d] = forceSoA[1][d*N+i];
+    for(int i=0 ; i<3*N ; ++i)
+      TEST_FLOATING_EQUALITY(forceFromSoA[i], force[1][i], 1.0e-12);
+  }
+
+  InfluenceFunction::self().setInfluenceFunction("One");
+}
+
+int main
+(int argc, char* argv[])
+{
+  return Teuchos::UnitTestRepository::runUnitTestsFromMain(argc, argv);
+}
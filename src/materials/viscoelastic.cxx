@@ -48,12 +48,21 @@
 #include <cmath>
 #include <iostream>
 #include "viscoelastic.h"
+#include "thread_parallel.h"
 using std::cout;
 using std::endl;
 namespace MATERIAL_EVALUATION {
 
-void computeInternalForceViscoelasticStandardLinearSolid
+/**
+ * Evaluates the owned points pBegin <= p < pEnd.  neighPtr and the bond-level arrays
+ * point at the neighborhood list entry and first bond of point pBegin.  Forces on owned
+ * points and reactions on their neighbors are both accumulated into fInternalOverlap.
+ */
+static void computeInternalForceViscoelasticStandardLinearSolidRange
   (
+   int pBegin,
+   int pEnd,
+   const int* neighPtr,
    double delta_t,
    const double *xOverlap,
    const double *yNOverlap,
@@ -66,8 +75,6 @@ void computeInternalForceViscoelasticStandardLinearSolid
    const double *edbN,
    double *edbNP1,
    double *fInternalOverlap,
-   const int*  localNeighborList,
-   int numOwnedPoints,
    double BULK_MODULUS,
    double SHEAR_MODULUS,
    double m_lambda_i,
@@ -86,18 +93,17 @@ void computeInternalForceViscoelasticStandardLinearSolid
 	double MU = SHEAR_MODULUS;
 	double OMEGA=1.0;
 
-	const double *xOwned = xOverlap;
-	const double *yNOwned = yNOverlap;
-	const double *yNP1Owned = yNP1Overlap;
-	const double *m = mOwned;
+	const double *xOwned = xOverlap + 3*pBegin;
+	const double *yNOwned = yNOverlap + 3*pBegin;
+	const double *yNP1Owned = yNP1Overlap + 3*pBegin;
+	const double *m = mOwned + pBegin;
 	const double *v = volumeOverlap;
-	const double *thetaN = dilatationOwnedN;
-	const double *thetaNp1 = dilatationOwnedNp1;
-	double *fOwned = fInternalOverlap;
+	const double *thetaN = dilatationOwnedN + pBegin;
+	const double *thetaNp1 = dilatationOwnedNp1 + pBegin;
+	double *fOwned = fInternalOverlap + 3*pBegin;
 
-	const int *neighPtr = localNeighborList;
 	double cellVolume, dx, dy, dz, zeta, dYN, dYNp1, t, ti, td, edN, edNp1, delta_ed;
-	for(int p=0;p<numOwnedPoints;p++, xOwned +=3, yNOwned +=3, yNP1Owned +=3, fOwned+=3, m++, thetaN++, thetaNp1++){
+	for(int p=pBegin;p<pEnd;p++, xOwned +=3, yNOwned +=3, yNP1Owned +=3, fOwned+=3, m++, thetaN++, thetaNp1++){
 
 		int numNeigh = *neighPtr; neighPtr++;
 		const double *X = xOwned;
@@ -199,5 +205,70 @@ void computeInternalForceViscoelasticStandardLinearSolid
 	}
 }
 
+void computeInternalForceViscoelasticStandardLinearSolid
+  (
+   double delta_t,
+   const double *xOverlap,
+   const double *yNOverlap,
+   const double *yNP1Overlap,
+   const double *mOwned,
+   const double* volumeOverlap,
+   const double* dilatationOwnedN,
+   const double* dilatationOwnedNp1,
+   const double* bondDamage,
+   const double *edbN,
+   double *edbNP1,
+   double *fInternalOverlap,
+   const int*  localNeighborList,
+   int numOwnedPoints,
+   double BULK_MODULUS,
+   double SHEAR_MODULUS,
+   double m_lambda_i,
+   double m_tau_b_i
+)
+{
+	computeInternalForceViscoelasticStandardLinearSolidRange(0,numOwnedPoints,localNeighborList,
+	                                                         delta_t,xOverlap,yNOverlap,yNP1Overlap,mOwned,volumeOverlap,
+	                                                         dilatationOwnedN,dilatationOwnedNp1,bondDamage,edbN,edbNP1,
+	                                                         fInternalOverlap,BULK_MODULUS,SHEAR_MODULUS,m_lambda_i,m_tau_b_i);
+}
+
+void computeInternalForceViscoelasticStandardLinearSolidThreaded
+  (
+   double delta_t,
+   const double *xOverlap,
+   const double *yNOverlap,
+   const double *yNP1Overlap,
+   const double *mOwned,
+   const double* volumeOverlap,
+   const double* dilatationOwnedN,
+   const double* dilatationOwnedNp1,
+   const double* bondDamage,
+   const double *edbN,
+   double *edbNP1,
+   double *fInternalOverlap,
+   const int*  localNeighborList,
+   int numOwnedPoints,
+   int numOverlapPoints,
+   double BULK_MODULUS,
+   double SHEAR_MODULUS,
+   double m_lambda_i,
+   double m_tau_b_i,
+   bool deterministic,
+   ThreadScratch& scratch
+)
+{
+	// The back extension state is bond data of owned points and is updated in place;
+	// only the force goes through the per-partition buffers.
+	evaluateThreadParallel(localNeighborList, numOwnedPoints, 3*numOverlapPoints, fInternalOverlap, deterministic, scratch,
+	                       [&](int pBegin, int pEnd, const int* neighPtr, int bondOffset, double* fTarget){
+	                         computeInternalForceViscoelasticStandardLinearSolidRange(pBegin,pEnd,neighPtr,
+	                                                                                  delta_t,xOverlap,yNOverlap,yNP1Overlap,mOwned,volumeOverlap,
+	                                                                                  dilatationOwnedN,dilatationOwnedNp1,bondDamage+bondOffset,
+	                                                                                  edbN+bondOffset,edbNP1+bondOffset,
+	                                                                                  fTarget,BULK_MODULUS,SHEAR_MODULUS,m_lambda_i,m_tau_b_i);
+	                       });
+}
+
 }
 
@@ -48,6 +48,8 @@
 #ifndef VISCOELASTIC_H
 #define VISCOELASTIC_H
 
+#include "thread_parallel.h"
+
 namespace MATERIAL_EVALUATION {
 
 /**
@@ -78,6 +80,31 @@ void computeInternalForceViscoelasticStandardLinearSolid
    double m_tau_b_i
    );
 
+//! Thread-parallel variant of computeInternalForceViscoelasticStandardLinearSolid(); see evaluateThreadParallel().
+void computeInternalForceViscoelasticStandardLinearSolidThreaded
+  (double delta_t,
+   const double *xOverlap,
+   const double *yNOverlap,
+   const double *yNP1Overlap,
+   const double *mOwned,
+   const double* volumeOverlap,
+   const double* dilatationOwnedN,
+   const double* dilatationOwnedNp1,
+   const double* bondDamage,
+   const double *edbN,
+   double *edbNP1,
+   double *fInternalOverlap,
+   const int*  localNeighborList,
+   int numOwnedPoints,
+   int numOverlapPoints,
+   double m_bulkModulus,
+   double m_shearModulus,
+   double m_lambda_i,
+   double m_tau_b_i,
+   bool deterministic,
+   ThreadScratch& scratch
+   );
+
 }
 
 #endif // VISCOELASTIC_H
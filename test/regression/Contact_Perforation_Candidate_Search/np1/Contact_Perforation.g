@@ -0,0 +1 @@
+../../Contact_Perforation/Contact_Perforation.g
\ No newline at end of file
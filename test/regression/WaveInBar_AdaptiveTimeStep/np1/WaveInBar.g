@@ -0,0 +1 @@
+../../WaveInBar/WaveInBar.g
\ No newline at end of file